@@ -20,6 +20,7 @@
 #include <unordered_map>
 
 #include "neural_network_runtime/neural_network_runtime_type.h"
+#include "neural_network_runtime_inner.h"
 #include "cpp_type.h"
 
 namespace OHOS {
@@ -57,6 +58,10 @@ public:
     {
         return false;
     }
+    virtual OH_NN_ReturnCode GetMemoryStatistics(OH_NN_MemoryStatistics& statistics) const
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
 };
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
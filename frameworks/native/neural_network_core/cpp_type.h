@@ -47,6 +47,14 @@ struct Buffer {
     int fd = -1;
 };
 
+// How a model released by the idle auto unload is loaded again.
+enum class ReloadPolicy {
+    // Reloaded synchronously by the first execution after the unload.
+    ON_DEMAND = 0,
+    // Reloaded in the background shortly before the executions are predicted to return.
+    PREDICTIVE
+};
+
 struct ExtensionConfig {
     Buffer quantBuffer;
     std::string modelName;
@@ -59,6 +67,9 @@ struct ExtensionConfig {
     bool isNpuFmShared = false;
     bool isExceedRamLimit = false;
     std::string aippPath;
+    ReloadPolicy reloadPolicy {ReloadPolicy::ON_DEMAND};
+    // Grows the output tensors which are too small for the run and runs once more.
+    bool isOutputRegrowEnabled = false;
 };
 
 struct ModelConfig {
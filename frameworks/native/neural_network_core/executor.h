@@ -16,16 +16,32 @@
 #ifndef NEURAL_NETWORK_RUNTIME_EXECUTOR_H
 #define NEURAL_NETWORK_RUNTIME_EXECUTOR_H
 
+#include <atomic>
+#include <functional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "compiler.h"
 #include "tensor_desc.h"
 #include "executor_config.h"
 #include "neural_network_runtime/neural_network_runtime_type.h"
+#include "neural_network_runtime_inner.h"
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
+// State of one execution context, reused by its runs one after another. The output shapes of the last run stay in
+// outputsDims, they are set to the output tensors from there instead of to the shapes recorded in the executor.
+struct ExecutionContext {
+    std::vector<NN_Tensor*> inputTensors;
+    std::vector<NN_Tensor*> outputTensors;
+    std::vector<std::vector<int32_t>> outputsDims;
+    std::vector<bool> isSufficientDataBuffer;
+    // Input dimension ranges of the model, the device overwrites the ones of the previous run.
+    std::vector<std::vector<uint32_t>> minInputDims;
+    std::vector<std::vector<uint32_t>> maxInputDims;
+};
+
 class Executor {
 public:
     Executor() = default;
@@ -59,6 +75,29 @@ public:
     virtual size_t GetBackendID() = 0;
     virtual OH_NN_ReturnCode SetExtensionConfig(const std::unordered_map<std::string, std::vector<char>>& configs) = 0;
     virtual ExecutorConfig* GetExecutorConfig() const = 0;
+    // Typed counterpart of the "isNeedModelLatency" extension config, which is cheap enough for the execution path.
+    virtual OH_NN_ReturnCode SetNeedModelLatency(bool isNeedModelLatency)
+    {
+        ExecutorConfig* config = GetExecutorConfig();
+        if (config == nullptr) {
+            return OH_NN_INVALID_PARAMETER;
+        }
+        config->isNeedModelLatency.store(isNeedModelLatency);
+        return OH_NN_SUCCESS;
+    }
+    virtual OH_NN_ReturnCode GetStatistics(OH_NN_ExecutorStatistics& statistics) const
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    virtual OH_NN_ReturnCode GetMemoryStatistics(OH_NN_MemoryStatistics& statistics) const
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    // Lets the output share the buffer of the input, i.e. the same tensor is passed as both of them to the runs.
+    virtual OH_NN_ReturnCode SetOutputAlias(size_t outputIndex, size_t inputIndex)
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
     virtual bool DeinitModel(std::string mode)
     {
         return true;
@@ -86,10 +125,26 @@ public:
         return OH_NN_SUCCESS;
     }
 
+    // Unlike RunSync, executions may run concurrently with each other, each one in its own context. The output shapes
+    // are kept in the context and set to the output tensors, the shapes recorded in the executor are left untouched.
+    virtual OH_NN_ReturnCode RunSyncInContext(ExecutionContext& context,
+                                              NN_Tensor* inputTensors[],
+                                              size_t inputSize,
+                                              NN_Tensor* outputTensors[],
+                                              size_t outputSize)
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    // Calls run, an execution of the executor, and accounts it as OH_NNExecutor_RunSync does: the inference count,
+    // the sampled latency and the latency report requested by the "isNeedModelLatency" extension config.
+    OH_NN_ReturnCode RunWithStatistics(const std::function<OH_NN_ReturnCode()>& run);
+
     bool isAddSession = false;
-    int modelInferenceCount {0};
-    size_t modelInferenceTotalTime {0};
-    int32_t tempLatencyAccumulator {0};
+    // Updated with atomics on the execution path and sampled by the report thread in neural_network_core.
+    std::atomic<int> modelInferenceCount {0};
+    std::atomic<size_t> modelInferenceTotalTime {0};
+    std::atomic<int32_t> tempLatencyAccumulator {0};
     size_t nnrtModelId {0};
 };
 }  // namespace NeuralNetworkRuntime
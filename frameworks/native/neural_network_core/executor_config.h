@@ -16,10 +16,14 @@
 #ifndef NEURAL_NETWORK_RUNTIME_EXECUTOR_CONFIG_H
 #define NEURAL_NETWORK_RUNTIME_EXECUTOR_CONFIG_H
 
+#include <atomic>
+#include <cstdint>
+
 namespace OHOS {
 namespace NeuralNetworkRuntime {
 struct ExecutorConfig {
-    bool isNeedModelLatency {false};
+    // Set by the scheduling and the extension config, taken by the one run which posts the latency report.
+    std::atomic<bool> isNeedModelLatency {false};
     int32_t callingPid {-1};
     uint32_t hiaiModelId {0};
 };
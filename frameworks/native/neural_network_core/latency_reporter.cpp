@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "latency_reporter.h"
+
+#include "log.h"
+#include "nnrt_client.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+LatencyReporter::LatencyReporter()
+{
+    m_worker = std::thread(&LatencyReporter::ReportLoop, this);
+}
+
+LatencyReporter& LatencyReporter::GetInstance()
+{
+    static LatencyReporter instance;
+    return instance;
+}
+
+LatencyReporter::~LatencyReporter()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_isStopped = true;
+    }
+    m_cv.notify_one();
+
+    if (m_worker.joinable()) {
+        m_worker.join();
+    }
+}
+
+bool LatencyReporter::Post(uint32_t hiaiModelId, int32_t modelLatency)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (m_size == MAX_PENDING_LATENCY_NUM) {
+            LOGW("LatencyReporter drops the latency of hiaiModelId %{public}u, too many pending reports.",
+                hiaiModelId);
+            return false;
+        }
+        m_events[(m_head + m_size) % MAX_PENDING_LATENCY_NUM] = {hiaiModelId, modelLatency};
+        ++m_size;
+    }
+    m_cv.notify_one();
+    return true;
+}
+
+void LatencyReporter::ReportLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    while (true) {
+        m_cv.wait(lock, [this] { return m_isStopped || m_size != 0; });
+        if (m_isStopped) {
+            break;
+        }
+
+        LatencyEvent event = m_events[m_head];
+        m_head = (m_head + 1) % MAX_PENDING_LATENCY_NUM;
+        --m_size;
+        lock.unlock();
+
+        NNRtServiceApi& nnrtService = NNRtServiceApi::GetInstance();
+        if (!nnrtService.IsServiceAvaliable()) {
+            LOGW("UpdateModelLatency failed, fail to get nnrt service, skip update model latency.");
+        } else if (nnrtService.UpdateModelLatency == nullptr) {
+            LOGE("UpdateModelLatency failed, nnrtService UpdateModelLatency func is nullptr.");
+        } else {
+            LOGD("UpdateModelLatency, hiaiModelId: %{public}u, modelLatency: %{public}d.",
+                event.hiaiModelId, event.modelLatency);
+            int ret = nnrtService.UpdateModelLatency(event.hiaiModelId, event.modelLatency);
+            if (ret != static_cast<int>(OH_NN_SUCCESS)) {
+                LOGE("UpdateModelLatency failed, nnrtService is not exist, jump over UpdateModelLatency.");
+            }
+        }
+
+        lock.lock();
+    }
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
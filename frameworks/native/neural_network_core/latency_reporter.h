@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_CORE_LATENCY_REPORTER_H
+#define NEURAL_NETWORK_CORE_LATENCY_REPORTER_H
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// Sends the measured model latencies to the nnrt service from a single background worker.
+// Post() only copies the latency into a fixed ring, it never creates a thread or allocates on the execution path.
+class LatencyReporter {
+public:
+    ~LatencyReporter();
+
+    // Returns false if the ring is full, the latency is dropped in that case.
+    bool Post(uint32_t hiaiModelId, int32_t modelLatency);
+
+    // Defined in the core library, so that it is shared with the runtime library.
+    static LatencyReporter& GetInstance();
+
+private:
+    LatencyReporter();
+    LatencyReporter(const LatencyReporter&) = delete;
+    LatencyReporter& operator=(const LatencyReporter&) = delete;
+
+    void ReportLoop();
+
+private:
+    static constexpr size_t MAX_PENDING_LATENCY_NUM = 32;
+
+    struct LatencyEvent {
+        uint32_t hiaiModelId {0};
+        int32_t modelLatency {0};
+    };
+
+    std::array<LatencyEvent, MAX_PENDING_LATENCY_NUM> m_events;
+    size_t m_head {0};
+    size_t m_size {0};
+    bool m_isStopped {false};
+    std::mutex m_mtx;
+    std::condition_variable m_cv;
+    std::thread m_worker;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_CORE_LATENCY_REPORTER_H
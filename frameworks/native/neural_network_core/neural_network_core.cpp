@@ -22,7 +22,6 @@
 #include <unordered_map>
 #include <future>
 #include <thread>
-#include <queue>
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
@@ -34,7 +33,9 @@
 #include "tensor.h"
 #include "compilation.h"
 #include "backend_manager.h"
+#include "latency_reporter.h"
 #include "nnrt_client.h"
+#include "run_sync_reporter.h"
 
 using namespace OHOS::NeuralNetworkRuntime;
 #define NNRT_API __attribute__((visibility("default")))
@@ -46,68 +47,8 @@ constexpr size_t TWO = 2;
 constexpr size_t END = 1;
 constexpr unsigned char MASK = 0x0F;
 constexpr size_t CALCULATE_INVOKE_TIME = 5;
-constexpr size_t REPORT_QUEUE_MAX_SIZE = 100;
 
 namespace {
-struct RunSyncEvent {
-    size_t nnrtModelId;
-    int modelInferenceCount;
-    size_t modelInferenceTotalTime;
-};
-
-std::queue<RunSyncEvent> g_reportQueue;
-std::mutex g_reportMutex;
-std::condition_variable g_reportCv;
-std::atomic<bool> g_stopReportThread {false};
-
-void ReportThreadLoop()
-{
-    while (true) {
-        RunSyncEvent event;
-        {
-            std::unique_lock<std::mutex> lock(g_reportMutex);
-            g_reportCv.wait(lock, [] {return !g_reportQueue.empty() || g_stopReportThread.load(); });
-            if (g_stopReportThread.load() && g_reportQueue.empty()) {
-                break;
-            }
-            if (g_reportQueue.empty()) {
-                continue;
-            }
-            event = g_reportQueue.front();
-            g_reportQueue.pop();
-        }
-        NNRtServiceApi& nnrtService = NNRtServiceApi::GetInstance();
-        if (!nnrtService.IsServiceAvaliable()) {
-            LOGW("ReportThreadLoop nnrt service unavailable, skip report.");
-            continue;
-        }
-        if (nnrtService.RunSyncReport == nullptr) {
-            LOGW("ReportThreadLoop RunSyncReport func is nullptr");
-            continue;
-        }
-        int ret = nnrtService.RunSyncReport(event.nnrtModelId, event.modelInferenceCount,
-            event.modelInferenceTotalTime);
-        if (ret != static_cast<int>(OH_NN_SUCCESS)) {
-            LOGW("ReportThreadLoop RunSyncReport failed");
-        }
-    }
-}
-
-std::thread g_reportThread(ReportThreadLoop);
-class ReportThreadGuard {
-public:
-    ~ReportThreadGuard()
-    {
-        g_stopReportThread.store(true);
-        g_reportCv.notify_one();
-        if (g_reportThread.joinable()) {
-            g_reportThread.join();
-        }
-    }
-};
-
-static ReportThreadGuard g_reportThreadGuard;
-
 std::string Sha256(const std::vector<void*>& dataList, const std::vector<size_t>& sizeList, bool isUpper)
 {
     unsigned char hash[SHA256_DIGEST_LENGTH * TWO + END] = "";
@@ -1607,6 +1548,7 @@ NNRT_API OH_NNExecutor *OH_NNExecutor_Construct(OH_NNCompilation *compilation)
         return nullptr;
     }
 
+    RunSyncReporter::GetInstance().Register(executorImpl);
     OH_NNExecutor *executor = reinterpret_cast<OH_NNExecutor *>(executorImpl);
     return executor;
 }
@@ -1660,6 +1602,8 @@ NNRT_API void OH_NNExecutor_Destroy(OH_NNExecutor **executor)
         return;
     }
 
+    // Unregistered before the final counters are sent by Unload, no report may follow them.
+    RunSyncReporter::GetInstance().Unregister(executorImpl);
     OH_NN_ReturnCode ret = Unload(executorImpl->GetExecutorConfig(), executorImpl->nnrtModelId,
         executorImpl->modelInferenceCount, executorImpl->modelInferenceTotalTime);
     if (ret != OH_NN_SUCCESS) {
@@ -1817,96 +1761,49 @@ NNRT_API OH_NN_ReturnCode OH_NNExecutor_SetOnServiceDied(OH_NNExecutor *executor
     return executorImpl->SetOnServiceDied(onServiceDied);
 }
 
-OH_NN_ReturnCode UpdateModelLatency(const ExecutorConfig* config, int32_t modelLatency)
+OH_NN_ReturnCode Executor::RunWithStatistics(const std::function<OH_NN_ReturnCode()>& run)
 {
-    if (config == nullptr) {
-        LOGE("UpdateModelLatency failed, config is nullptr.");
-        return OH_NN_INVALID_PARAMETER;
-    }
-
-    NNRtServiceApi& nnrtService = NNRtServiceApi::GetInstance();
-    if (!nnrtService.IsServiceAvaliable()) {
-        LOGW("UpdateModelLatency failed, fail to get nnrt service, skip update model latency.");
-        return OH_NN_SUCCESS;
-    }
-
-    if (nnrtService.UpdateModelLatency == nullptr) {
-        LOGE("UpdateModelLatency failed, nnrtService UpdateModelLatency func is nullptr.");
-        return OH_NN_INVALID_PARAMETER;
-    }
-
-    LOGD("UpdateModelLatency, hiaiModelId: %{public}u, modelLatency: %{public}d.", config->hiaiModelId, modelLatency);
-
-    int ret = nnrtService.UpdateModelLatency(config->hiaiModelId, modelLatency);
-    if (ret != static_cast<int>(OH_NN_SUCCESS)) {
-        LOGE("UpdateModelLatency failed, nnrtService is not exist, jump over UpdateModelLatency.");
-        return static_cast<OH_NN_ReturnCode>(ret);
-    }
-
-    return OH_NN_SUCCESS;
-}
-
-OH_NN_ReturnCode RunSync(Executor *executor,
-                         NN_Tensor *inputTensor[],
-                         size_t inputCount,
-                         NN_Tensor *outputTensor[],
-                         size_t outputCount)
-{
-    ExecutorConfig* configPtr = executor->GetExecutorConfig();
+    ExecutorConfig* configPtr = GetExecutorConfig();
     if (configPtr == nullptr) {
         LOGE("RunSync failed, executor config is nullptr.");
         return OH_NN_INVALID_PARAMETER;
     }
 
+    int inferenceCount = modelInferenceCount.load(std::memory_order_relaxed);
+    bool isSampledRun = (inferenceCount % CALCULATE_INVOKE_TIME == 0);
+    // Concurrent runs of an ExecutorPool read the flag too, only the run which takes it posts the report.
+    bool isNeedModelLatency = configPtr->isNeedModelLatency.load();
     long timeStart = 0;
-    if (configPtr->isNeedModelLatency || executor->modelInferenceCount % CALCULATE_INVOKE_TIME == 0) {
+    if (isNeedModelLatency || isSampledRun) {
         timeStart = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now().time_since_epoch()).count();
+            std::chrono::steady_clock::now().time_since_epoch()).count();
     }
 
-    OH_NN_ReturnCode ret = executor->RunSync(inputTensor, inputCount, outputTensor, outputCount);
+    OH_NN_ReturnCode ret = run();
     if (ret != OH_NN_SUCCESS) {
         LOGE("OH_NNExecutor_RunSync failed, fail to run executor.");
         return ret;
     }
 
     int32_t modelLatency = 0;
-    if (configPtr->isNeedModelLatency || executor->modelInferenceCount % CALCULATE_INVOKE_TIME == 0) {
+    if (isNeedModelLatency || isSampledRun) {
         long timeEnd = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now().time_since_epoch()).count();
+            std::chrono::steady_clock::now().time_since_epoch()).count();
         modelLatency = static_cast<int32_t>((timeEnd - timeStart));
     }
 
-    if (executor->modelInferenceCount % CALCULATE_INVOKE_TIME == 0) {
-        executor->tempLatencyAccumulator = modelLatency;
-    }
-
-    executor->modelInferenceCount++;
-    executor->modelInferenceTotalTime += static_cast<size_t>(executor->tempLatencyAccumulator);
-
-    {
-        std::lock_guard<std::mutex> lock(g_reportMutex);
-        if (g_reportQueue.size() < REPORT_QUEUE_MAX_SIZE) {
-            g_reportQueue.push({executor->nnrtModelId, executor->modelInferenceCount,
-                executor->modelInferenceTotalTime});
-        }
+    if (isSampledRun) {
+        tempLatencyAccumulator.store(modelLatency, std::memory_order_relaxed);
     }
-    g_reportCv.notify_one();
-
-    if (configPtr->isNeedModelLatency) {
-        std::thread t(UpdateModelLatency, configPtr, modelLatency);
-        t.detach();
 
-        configPtr->isNeedModelLatency = false;
-        std::unordered_map<std::string, std::vector<char>> configMap;
-        std::vector<char> vecNeedLatency = { static_cast<char>(configPtr->isNeedModelLatency) };
-        configMap["isNeedModelLatency"] = vecNeedLatency;
+    // Sampled by the RunSyncReporter, the count is sequentially consistent with its notification.
+    modelInferenceTotalTime.fetch_add(
+        static_cast<size_t>(tempLatencyAccumulator.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+    modelInferenceCount.fetch_add(1);
+    RunSyncReporter::GetInstance().NotifyRun();
 
-        ret = executor->SetExtensionConfig(configMap);
-        if (ret != OH_NN_SUCCESS) {
-            LOGE("OH_NNExecutor_RunSync failed, fail update executor config.");
-            return ret;
-        }
+    if (isNeedModelLatency && configPtr->isNeedModelLatency.exchange(false)) {
+        (void)LatencyReporter::GetInstance().Post(configPtr->hiaiModelId, modelLatency);
     }
 
     return OH_NN_SUCCESS;
@@ -1944,7 +1841,9 @@ NNRT_API OH_NN_ReturnCode OH_NNExecutor_RunSync(OH_NNExecutor *executor,
 
     AddSessionId(executorImpl);
 
-    return RunSync(executorImpl, inputTensor, inputCount, outputTensor, outputCount);
+    return executorImpl->RunWithStatistics([executorImpl, inputTensor, inputCount, outputTensor, outputCount]() {
+        return executorImpl->RunSync(inputTensor, inputCount, outputTensor, outputCount);
+    });
 }
 
 NNRT_API OH_NN_ReturnCode OH_NNExecutor_RunAsync(OH_NNExecutor *executor,
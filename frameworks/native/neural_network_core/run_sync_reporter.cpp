@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "run_sync_reporter.h"
+
+#include <chrono>
+#include <utility>
+
+#include "log.h"
+#include "nnrt_client.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+constexpr int64_t REPORT_INTERVAL_MS = 1000;
+
+void SendRunSyncReport(size_t nnrtModelId, int modelInferenceCount, size_t modelInferenceTotalTime)
+{
+    NNRtServiceApi& nnrtService = NNRtServiceApi::GetInstance();
+    if (!nnrtService.IsServiceAvaliable()) {
+        LOGW("RunSyncReporter nnrt service unavailable, skip report.");
+        return;
+    }
+    if (nnrtService.RunSyncReport == nullptr) {
+        LOGW("RunSyncReporter RunSyncReport func is nullptr");
+        return;
+    }
+
+    int ret = nnrtService.RunSyncReport(nnrtModelId, modelInferenceCount, modelInferenceTotalTime);
+    if (ret != static_cast<int>(OH_NN_SUCCESS)) {
+        LOGW("RunSyncReporter RunSyncReport failed");
+    }
+}
+} // namespace
+
+RunSyncReporter::RunSyncReporter(ReportFunc reportFunc, int64_t reportIntervalMs)
+    : m_reportFunc(std::move(reportFunc)), m_reportIntervalMs(reportIntervalMs)
+{
+    m_worker = std::thread(&RunSyncReporter::ReportLoop, this);
+}
+
+RunSyncReporter& RunSyncReporter::GetInstance()
+{
+    static RunSyncReporter instance(SendRunSyncReport, REPORT_INTERVAL_MS);
+    return instance;
+}
+
+RunSyncReporter::~RunSyncReporter()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_isStopped = true;
+    }
+    m_cv.notify_one();
+
+    if (m_worker.joinable()) {
+        m_worker.join();
+    }
+}
+
+void RunSyncReporter::Register(Executor* executor)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_executors.emplace(executor, executor->modelInferenceCount.load());
+}
+
+void RunSyncReporter::Unregister(Executor* executor)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_executors.erase(executor);
+}
+
+void RunSyncReporter::NotifyRun()
+{
+    // Sequentially consistent with the count of the execution and with the sample of the worker: either the worker
+    // clears the flag after this load and reads the count, or the flag is set again and the worker is woken up.
+    if (m_hasPendingRun.load() || m_hasPendingRun.exchange(true)) {
+        return;
+    }
+
+    // Taken so that the worker either sees the flag or is already waiting for the notification.
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+    }
+    m_cv.notify_one();
+}
+
+size_t RunSyncReporter::GetSampleCount() const
+{
+    return m_sampleCount.load(std::memory_order_relaxed);
+}
+
+void RunSyncReporter::ReportLoop()
+{
+    std::vector<RunSyncEvent> events;
+    std::unique_lock<std::mutex> lock(m_mtx);
+    while (true) {
+        m_cv.wait(lock, [this] { return m_isStopped || m_hasPendingRun.load(); });
+        if (m_isStopped) {
+            break;
+        }
+        if (m_cv.wait_for(lock, std::chrono::milliseconds(m_reportIntervalMs), [this] { return m_isStopped; })) {
+            break;
+        }
+
+        // Cleared before the counters are read, an execution counted after the sample notifies the worker again.
+        m_hasPendingRun.store(false);
+        m_sampleCount.fetch_add(1, std::memory_order_relaxed);
+        events.clear();
+        for (auto& [executor, reportedCount] : m_executors) {
+            int count = executor->modelInferenceCount.load();
+            if (count == reportedCount) {
+                continue;
+            }
+            reportedCount = count;
+            events.push_back({executor->nnrtModelId, count,
+                executor->modelInferenceTotalTime.load(std::memory_order_relaxed)});
+        }
+        if (events.empty()) {
+            continue;
+        }
+
+        lock.unlock();
+        for (const RunSyncEvent& event : events) {
+            m_reportFunc(event.nnrtModelId, event.modelInferenceCount, event.modelInferenceTotalTime);
+        }
+        lock.lock();
+    }
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
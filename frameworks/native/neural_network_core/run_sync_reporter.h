@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_CORE_RUN_SYNC_REPORTER_H
+#define NEURAL_NETWORK_CORE_RUN_SYNC_REPORTER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "executor.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// Sends the inference counters of the registered executors to the nnrt service from a single background worker.
+// The worker sleeps until an execution is notified, then waits for the report interval so that the executions that
+// follow are coalesced into one report per executor. While no executor runs, the worker is never woken up.
+class RunSyncReporter {
+public:
+    using ReportFunc = std::function<void(size_t nnrtModelId, int modelInferenceCount,
+        size_t modelInferenceTotalTime)>;
+
+    RunSyncReporter(ReportFunc reportFunc, int64_t reportIntervalMs);
+    ~RunSyncReporter();
+
+    // An executor is unregistered before it is destroyed, the worker reads its counters until then.
+    void Register(Executor* executor);
+    void Unregister(Executor* executor);
+
+    // Called once an execution has updated the counters of its executor. Only the first execution after a sample
+    // wakes the worker, the others only read an atomic flag.
+    void NotifyRun();
+
+    // The number of times the worker has sampled the counters of the executors.
+    size_t GetSampleCount() const;
+
+    // Defined in the core library, reports to the nnrt service once a second at most.
+    static RunSyncReporter& GetInstance();
+
+private:
+    RunSyncReporter(const RunSyncReporter&) = delete;
+    RunSyncReporter& operator=(const RunSyncReporter&) = delete;
+
+    void ReportLoop();
+
+private:
+    struct RunSyncEvent {
+        size_t nnrtModelId {0};
+        int modelInferenceCount {0};
+        size_t modelInferenceTotalTime {0};
+    };
+
+    ReportFunc m_reportFunc;
+    int64_t m_reportIntervalMs {0};
+    // Registered executors, mapped to the inference count last reported for them.
+    std::unordered_map<Executor*, int> m_executors;
+    std::atomic<bool> m_hasPendingRun {false};
+    std::atomic<size_t> m_sampleCount {0};
+    bool m_isStopped {false};
+    std::mutex m_mtx;
+    std::condition_variable m_cv;
+    std::thread m_worker;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_CORE_RUN_SYNC_REPORTER_H
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "async_run_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "log.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+constexpr size_t ASYNC_RUN_MAX_WORKERS = 4;
+constexpr size_t ASYNC_RUN_QUEUE_MAX_SIZE = 256;
+// Each ParallelFor queues at most one helper per worker, this bounds the helpers of concurrent calls.
+constexpr size_t PARALLEL_FOR_QUEUE_MAX_SIZE = ASYNC_RUN_MAX_WORKERS * ASYNC_RUN_MAX_WORKERS;
+
+namespace {
+// Shared with the workers, one of them may only start after the call has returned.
+struct ParallelForState {
+    size_t taskNum {0};
+    const std::function<void(size_t)>* task {nullptr};
+    std::atomic<size_t> nextIndex {0};
+    std::atomic<size_t> finishedNum {0};
+    bool isFinished {false};
+    std::mutex mtx;
+    std::condition_variable cv;
+};
+} // namespace
+
+AsyncRunPool::~AsyncRunPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_isStopped = true;
+    }
+    m_taskCv.notify_all();
+    m_timerCv.notify_all();
+
+    for (auto& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    if (m_timer.joinable()) {
+        m_timer.join();
+    }
+}
+
+void AsyncRunPool::StartThreadsLocked()
+{
+    if (m_isStarted) {
+        return;
+    }
+
+    size_t workerNum = std::thread::hardware_concurrency();
+    workerNum = (workerNum == 0) ? 1 : std::min(workerNum, ASYNC_RUN_MAX_WORKERS);
+    for (size_t i = 0; i < workerNum; ++i) {
+        m_workers.emplace_back(&AsyncRunPool::WorkerLoop, this);
+    }
+    m_timer = std::thread(&AsyncRunPool::TimerLoop, this);
+    m_isStarted = true;
+    LOGI("AsyncRunPool started with %{public}zu workers.", workerNum);
+}
+
+OH_NN_ReturnCode AsyncRunPool::PostTask(AsyncTask&& task)
+{
+    if (task == nullptr) {
+        LOGE("AsyncRunPool::PostTask failed, task is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (m_isStopped) {
+            LOGE("AsyncRunPool::PostTask failed, pool has been stopped.");
+            return OH_NN_OPERATION_FORBIDDEN;
+        }
+        if (m_tasks.size() >= ASYNC_RUN_QUEUE_MAX_SIZE) {
+            LOGE("AsyncRunPool::PostTask failed, too many pending tasks, the limit is %{public}zu.",
+                ASYNC_RUN_QUEUE_MAX_SIZE);
+            return OH_NN_FAILED;
+        }
+        StartThreadsLocked();
+        m_tasks.emplace(std::move(task));
+    }
+    m_taskCv.notify_one();
+    return OH_NN_SUCCESS;
+}
+
+bool AsyncRunPool::PostHelperTask(AsyncTask&& task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (m_isStopped || m_helperTasks.size() >= PARALLEL_FOR_QUEUE_MAX_SIZE) {
+            return false;
+        }
+        StartThreadsLocked();
+        m_helperTasks.emplace(std::move(task));
+    }
+    m_taskCv.notify_one();
+    return true;
+}
+
+OH_NN_ReturnCode AsyncRunPool::PostTimerTask(AsyncTask&& task, int32_t delayMs, uint64_t& timerId)
+{
+    if (task == nullptr) {
+        LOGE("AsyncRunPool::PostTimerTask failed, task is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (delayMs < 0) {
+        LOGE("AsyncRunPool::PostTimerTask failed, delay %{public}d is negative.", delayMs);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(delayMs);
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (m_isStopped) {
+            LOGE("AsyncRunPool::PostTimerTask failed, pool has been stopped.");
+            return OH_NN_OPERATION_FORBIDDEN;
+        }
+        StartThreadsLocked();
+        timerId = ++m_nextTimerId;
+        m_timerTasks.emplace(TimerKey(deadline, timerId), std::move(task));
+        m_timerDeadlines.emplace(timerId, deadline);
+    }
+    m_timerCv.notify_one();
+    return OH_NN_SUCCESS;
+}
+
+bool AsyncRunPool::RemoveTimerTask(uint64_t timerId)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto iter = m_timerDeadlines.find(timerId);
+    if (iter == m_timerDeadlines.end()) {
+        return false;
+    }
+    m_timerTasks.erase(TimerKey(iter->second, timerId));
+    m_timerDeadlines.erase(iter);
+    return true;
+}
+
+void AsyncRunPool::ParallelFor(size_t taskNum, const std::function<void(size_t)>& task)
+{
+    if (taskNum == 0 || task == nullptr) {
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>();
+    state->taskNum = taskNum;
+    state->task = &task;
+    // The task is only dereferenced for an index below taskNum, the call is still waiting for it then.
+    auto runTasks = [state]() {
+        for (size_t index = state->nextIndex++; index < state->taskNum; index = state->nextIndex++) {
+            (*state->task)(index);
+            if (++state->finishedNum == state->taskNum) {
+                std::lock_guard<std::mutex> lock(state->mtx);
+                state->isFinished = true;
+                state->cv.notify_all();
+            }
+        }
+    };
+
+    // A helper which starts after the caller has done all the work returns at once.
+    size_t helperNum = std::min(taskNum - 1, ASYNC_RUN_MAX_WORKERS);
+    for (size_t i = 0; i < helperNum; ++i) {
+        if (!PostHelperTask(AsyncTask(runTasks))) {
+            break;
+        }
+    }
+    runTasks();
+
+    std::unique_lock<std::mutex> lock(state->mtx);
+    state->cv.wait(lock, [&state] { return state->isFinished; });
+}
+
+void AsyncRunPool::WorkerLoop()
+{
+    while (true) {
+        AsyncTask task;
+        {
+            std::unique_lock<std::mutex> lock(m_mtx);
+            m_taskCv.wait(lock, [this] { return !m_tasks.empty() || !m_helperTasks.empty() || m_isStopped; });
+            if (m_isStopped && m_tasks.empty() && m_helperTasks.empty()) {
+                break;
+            }
+            // Helpers first, a caller of ParallelFor is waiting for them.
+            std::queue<AsyncTask>& tasks = m_helperTasks.empty() ? m_tasks : m_helperTasks;
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+        task();
+    }
+}
+
+void AsyncRunPool::TimerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    while (!m_isStopped) {
+        if (m_timerTasks.empty()) {
+            m_timerCv.wait(lock);
+            continue;
+        }
+
+        auto iter = m_timerTasks.begin();
+        if (std::chrono::steady_clock::now() < iter->first.first) {
+            m_timerCv.wait_until(lock, iter->first.first);
+            continue;
+        }
+
+        AsyncTask task = std::move(iter->second);
+        m_timerDeadlines.erase(iter->first.second);
+        m_timerTasks.erase(iter);
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
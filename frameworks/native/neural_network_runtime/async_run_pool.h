@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_ASYNC_RUN_POOL_H
+#define NEURAL_NETWORK_RUNTIME_ASYNC_RUN_POOL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "neural_network_runtime/neural_network_runtime_type.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+using AsyncTask = std::function<void()>;
+
+// Process-wide worker pool which serves the asynchronous executions of all executors.
+// Worker threads are created on the first posted task, so processes which never call RunAsync pay nothing.
+class AsyncRunPool {
+public:
+    ~AsyncRunPool();
+
+    OH_NN_ReturnCode PostTask(AsyncTask&& task);
+    // The task is invoked on the timer thread once delayMs has elapsed, unless removed before by RemoveTimerTask.
+    OH_NN_ReturnCode PostTimerTask(AsyncTask&& task, int32_t delayMs, uint64_t& timerId);
+    // Returns false if the task has already been invoked or removed.
+    bool RemoveTimerTask(uint64_t timerId);
+    // Invokes task with every index below taskNum and returns once all of them have finished.
+    // The calling thread takes part, so the call completes even if all workers are busy.
+    void ParallelFor(size_t taskNum, const std::function<void(size_t)>& task);
+
+    static AsyncRunPool* GetInstance()
+    {
+        static AsyncRunPool instance;
+        return &instance;
+    }
+
+private:
+    AsyncRunPool() {};
+    AsyncRunPool(const AsyncRunPool&) = delete;
+    AsyncRunPool& operator=(const AsyncRunPool&) = delete;
+
+    void StartThreadsLocked();
+    // Helpers of ParallelFor are queued apart, so they neither take nor wait for the slots of RunAsync.
+    bool PostHelperTask(AsyncTask&& task);
+    void WorkerLoop();
+    void TimerLoop();
+
+private:
+    using TimerKey = std::pair<std::chrono::steady_clock::time_point, uint64_t>;
+
+    std::vector<std::thread> m_workers;
+    std::thread m_timer;
+    std::queue<AsyncTask> m_tasks;
+    std::queue<AsyncTask> m_helperTasks;
+    std::map<TimerKey, AsyncTask> m_timerTasks;
+    // key: timer id, value: deadline of the timer task
+    std::unordered_map<uint64_t, std::chrono::steady_clock::time_point> m_timerDeadlines;
+    uint64_t m_nextTimerId {0};
+    bool m_isStarted {false};
+    bool m_isStopped {false};
+    std::mutex m_mtx;
+    std::condition_variable m_taskCv;
+    std::condition_variable m_timerCv;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_ASYNC_RUN_POOL_H
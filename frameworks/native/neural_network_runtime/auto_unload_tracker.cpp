@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "auto_unload_tracker.h"
+
+#include <algorithm>
+
+#include "log.h"
+#include "shared_buffer_pool.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+constexpr int64_t NANOSECONDS_PER_MILLISECOND = 1000 * 1000;
+// An entry which has been handled is polled every 1/10 of its timeout, so it is unloaded at most 10% late.
+constexpr int64_t IDLE_POLL_DIVISOR = 10;
+
+AutoUnloadTracker::~AutoUnloadTracker()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_isStopped = true;
+    }
+    m_sweepCv.notify_all();
+
+    if (m_sweeper.joinable()) {
+        m_sweeper.join();
+    }
+}
+
+uint64_t AutoUnloadTracker::Register(const std::atomic<int64_t>& lastUsedTime, int64_t idleTimeoutMs,
+    IdleCallback&& onIdle)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    uint64_t id = ++m_nextId;
+    IdleEntry& entry = m_entries[id];
+    entry.lastUsedTime = &lastUsedTime;
+    entry.idleTimeout = std::max<int64_t>(idleTimeoutMs, 1) * NANOSECONDS_PER_MILLISECOND;
+    entry.onIdle = std::move(onIdle);
+
+    if (!m_sweeper.joinable()) {
+        m_sweeper = std::thread(&AutoUnloadTracker::SweepLoop, this);
+    }
+    m_sweepCv.notify_all();
+    return id;
+}
+
+void AutoUnloadTracker::Unregister(uint64_t id)
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    auto iter = m_entries.find(id);
+    if (iter != m_entries.end() && iter->second.isLoaded) {
+        m_loadedBytes -= iter->second.modelSize;
+        --m_loadedCount;
+    }
+    m_entries.erase(id);
+    // Waiting from inside the callback would never return.
+    if (m_sweeper.get_id() == std::this_thread::get_id()) {
+        return;
+    }
+    m_invokeCv.wait(lock, [this, id] { return m_invokingId != id; });
+}
+
+void AutoUnloadTracker::Suppress(uint64_t id)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto iter = m_entries.find(id);
+    if (iter != m_entries.end()) {
+        iter->second.handledTime = iter->second.lastUsedTime->load(std::memory_order_relaxed);
+    }
+}
+
+void AutoUnloadTracker::TrackMemory(uint64_t id, size_t modelSize, EvictCallback&& onEvict)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto iter = m_entries.find(id);
+    if (iter == m_entries.end() || iter->second.modelSize != 0) {
+        return;
+    }
+    IdleEntry& entry = iter->second;
+    entry.modelSize = modelSize;
+    entry.onEvict = std::move(onEvict);
+    entry.isLoaded = true;
+    entry.loadedTime = Now();
+    m_loadedBytes += modelSize;
+    ++m_loadedCount;
+    m_sweepCv.notify_all();
+}
+
+void AutoUnloadTracker::SetLoaded(uint64_t id, bool isLoaded)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto iter = m_entries.find(id);
+    if (iter == m_entries.end() || iter->second.modelSize == 0 || iter->second.isLoaded == isLoaded) {
+        return;
+    }
+    IdleEntry& entry = iter->second;
+    entry.isLoaded = isLoaded;
+    if (isLoaded) {
+        entry.isEvictable = true;
+        entry.loadedTime = Now();
+        m_loadedBytes += entry.modelSize;
+        ++m_loadedCount;
+        m_sweepCv.notify_all();
+    } else {
+        m_loadedBytes -= entry.modelSize;
+        --m_loadedCount;
+    }
+}
+
+void AutoUnloadTracker::SetMemoryBudget(size_t budget)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_memoryBudget = budget;
+    for (auto& [id, entry] : m_entries) {
+        entry.isEvictable = true;
+    }
+    m_sweepCv.notify_all();
+}
+
+void AutoUnloadTracker::GetMemoryStatistics(OH_NN_ModelMemoryStatistics& statistics)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    statistics.budget = m_memoryBudget;
+    statistics.loadedBytes = m_loadedBytes;
+    statistics.loadedCount = m_loadedCount;
+    statistics.pooledBytes = SharedBufferPool::GetTotalCachedBytes();
+    statistics.evictCount = m_evictCount;
+}
+
+void AutoUnloadTracker::TrimBufferPoolsLocked(std::unique_lock<std::mutex>& lock)
+{
+    if (m_memoryBudget == 0 || m_loadedBytes + SharedBufferPool::GetTotalCachedBytes() <= m_memoryBudget) {
+        return;
+    }
+
+    // The idle shared buffers go first, getting them back costs an allocation instead of a model reload.
+    size_t poolLimit = m_memoryBudget > m_loadedBytes ? m_memoryBudget - m_loadedBytes : 0;
+    // Trimmed unlocked, the buffers are released to the devices.
+    lock.unlock();
+    SharedBufferPool::TrimAll(poolLimit);
+    lock.lock();
+}
+
+bool AutoUnloadTracker::IsOverBudgetLocked() const
+{
+    // The idle shared buffers have been trimmed, the models are evicted only for the overage they cause.
+    return m_memoryBudget != 0 && m_loadedBytes > m_memoryBudget;
+}
+
+uint64_t AutoUnloadTracker::FindEvictionLocked() const
+{
+    // The last loaded model is kept even if it exceeds the budget alone, it would only be reloaded by its next run.
+    if (m_loadedCount <= 1) {
+        return 0;
+    }
+    uint64_t evictId = 0;
+    int64_t evictUsedTime = INT64_MAX;
+    for (const auto& [id, entry] : m_entries) {
+        if (!entry.isLoaded || !entry.isEvictable) {
+            continue;
+        }
+        int64_t usedTime = std::max(entry.lastUsedTime->load(std::memory_order_relaxed), entry.loadedTime);
+        if (usedTime < evictUsedTime) {
+            evictUsedTime = usedTime;
+            evictId = id;
+        }
+    }
+    return evictId;
+}
+
+void AutoUnloadTracker::InvokeLocked(std::unique_lock<std::mutex>& lock, uint64_t id,
+    const std::function<void()>& callback)
+{
+    // Invoked unlocked, so that the entry can be unregistered meanwhile, even by the callback itself.
+    m_invokingId = id;
+    lock.unlock();
+    callback();
+    lock.lock();
+    m_invokingId = 0;
+    m_invokeCv.notify_all();
+}
+
+void AutoUnloadTracker::SweepLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    while (!m_isStopped) {
+        TrimBufferPoolsLocked(lock);
+        uint64_t evictId = IsOverBudgetLocked() ? FindEvictionLocked() : 0;
+        if (evictId != 0) {
+            // Invoked on a copy, the callback reports the unload with SetLoaded itself.
+            EvictCallback onEvict = m_entries[evictId].onEvict;
+            bool isUnloaded = false;
+            InvokeLocked(lock, evictId, [&onEvict, &isUnloaded]() { isUnloaded = onEvict(); });
+            auto iter = m_entries.find(evictId);
+            if (isUnloaded) {
+                ++m_evictCount;
+            } else if (iter != m_entries.end()) {
+                iter->second.isEvictable = false;
+            }
+            continue;
+        }
+
+        int64_t now = Now();
+        int64_t nextSweepTime = INT64_MAX;
+        uint64_t idleId = 0;
+        for (auto& [id, entry] : m_entries) {
+            int64_t lastUsedTime = entry.lastUsedTime->load(std::memory_order_relaxed);
+            if (lastUsedTime == entry.handledTime) {
+                // A later use is only seen by polling, the hot path does not notify the sweeper.
+                nextSweepTime = std::min(nextSweepTime, now + entry.idleTimeout / IDLE_POLL_DIVISOR);
+                continue;
+            }
+            if (now - lastUsedTime >= entry.idleTimeout) {
+                entry.handledTime = lastUsedTime;
+                idleId = id;
+                break;
+            }
+            nextSweepTime = std::min(nextSweepTime, lastUsedTime + entry.idleTimeout);
+        }
+
+        if (idleId != 0) {
+            // Invoked on a copy, the entry may be unregistered by the callback.
+            IdleCallback onIdle = m_entries[idleId].onIdle;
+            InvokeLocked(lock, idleId, onIdle);
+            continue;
+        }
+
+        if (nextSweepTime == INT64_MAX) {
+            m_sweepCv.wait(lock);
+        } else {
+            m_sweepCv.wait_for(lock, std::chrono::nanoseconds(std::max<int64_t>(nextSweepTime - now, 0)));
+        }
+    }
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_AUTO_UNLOAD_TRACKER_H
+#define NEURAL_NETWORK_RUNTIME_AUTO_UNLOAD_TRACKER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "neural_network_runtime_inner.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+using IdleCallback = std::function<void()>;
+// Returns whether the model has been unloaded.
+using EvictCallback = std::function<bool()>;
+
+// Process-wide tracker which unloads the models of idle executors.
+// An executor publishes the time of its last use with one relaxed atomic store, a single sweeper thread compares
+// it with the idle timeout and invokes the callback once per period of idleness.
+// The same thread keeps the loaded models and the idle shared buffers within the memory budget. The idle buffers are
+// trimmed first, then the least recently used model is evicted while the models alone exceed the budget.
+class AutoUnloadTracker {
+public:
+    ~AutoUnloadTracker();
+
+    // lastUsedTime must outlive the registration, it is written by the owner with StoreNow().
+    uint64_t Register(const std::atomic<int64_t>& lastUsedTime, int64_t idleTimeoutMs, IdleCallback&& onIdle);
+    // Returns after the callback of the entry has finished if it is being invoked.
+    void Unregister(uint64_t id);
+    // Skips the current period of idleness, the entry is tracked again after the next use.
+    void Suppress(uint64_t id);
+
+    // Counts the model of the entry in the memory budget from now on, it is loaded.
+    void TrackMemory(uint64_t id, size_t modelSize, EvictCallback&& onEvict);
+    // Called by the owner whenever its model is unloaded or loaded again, also after onEvict.
+    void SetLoaded(uint64_t id, bool isLoaded);
+    // Budget of the loaded models and the idle shared buffers in bytes, 0 means unlimited.
+    void SetMemoryBudget(size_t budget);
+    void GetMemoryStatistics(OH_NN_ModelMemoryStatistics& statistics);
+
+    static int64_t Now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static void StoreNow(std::atomic<int64_t>& lastUsedTime)
+    {
+        lastUsedTime.store(Now(), std::memory_order_relaxed);
+    }
+
+    static AutoUnloadTracker* GetInstance()
+    {
+        static AutoUnloadTracker instance;
+        return &instance;
+    }
+
+private:
+    AutoUnloadTracker() {};
+    AutoUnloadTracker(const AutoUnloadTracker&) = delete;
+    AutoUnloadTracker& operator=(const AutoUnloadTracker&) = delete;
+
+    void SweepLoop();
+    // Trims the idle shared buffers to what the loaded models leave of the budget.
+    void TrimBufferPoolsLocked(std::unique_lock<std::mutex>& lock);
+    bool IsOverBudgetLocked() const;
+    // Returns 0 if no loaded model can be evicted.
+    uint64_t FindEvictionLocked() const;
+    void InvokeLocked(std::unique_lock<std::mutex>& lock, uint64_t id, const std::function<void()>& callback);
+
+private:
+    struct IdleEntry {
+        const std::atomic<int64_t>* lastUsedTime {nullptr};
+        // in nanoseconds, the same unit as lastUsedTime
+        int64_t idleTimeout {0};
+        // The last use which the callback has been invoked or suppressed for.
+        int64_t handledTime {INT64_MIN};
+        IdleCallback onIdle;
+        // Only tracked in the memory budget once modelSize is set.
+        size_t modelSize {0};
+        bool isLoaded {false};
+        // Cleared if the eviction has failed, until the model is loaded again.
+        bool isEvictable {true};
+        // The eviction order also counts a reload as a use, the first run after it has not finished yet.
+        int64_t loadedTime {0};
+        EvictCallback onEvict;
+    };
+
+    std::unordered_map<uint64_t, IdleEntry> m_entries;
+    uint64_t m_nextId {0};
+    // Id of the entry whose callback is being invoked, 0 if there is none.
+    uint64_t m_invokingId {0};
+    std::thread m_sweeper;
+    bool m_isStopped {false};
+    size_t m_memoryBudget {0};
+    size_t m_loadedBytes {0};
+    size_t m_loadedCount {0};
+    uint64_t m_evictCount {0};
+    std::mutex m_mtx;
+    std::condition_variable m_sweepCv;
+    std::condition_variable m_invokeCv;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_AUTO_UNLOAD_TRACKER_H
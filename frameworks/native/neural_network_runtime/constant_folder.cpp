@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "constant_folder.h"
+
+#include <cmath>
+#include <type_traits>
+#include <unordered_map>
+
+#include "securec.h"
+
+#include "log.h"
+#include "transform.h"
+
+namespace MSLITE = mindspore::lite;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+struct FoldedTensor {
+    MSLITE::DataType dataType {MSLITE::DATA_TYPE_UNKNOWN};
+    std::vector<int32_t> dims;
+    // Empty if the tensor is not a constant.
+    std::vector<uint8_t> data;
+};
+
+using FoldFunc = bool (*)(const MSLITE::LiteGraph::Node& node, const std::vector<FoldedTensor>& inputs,
+    FoldedTensor& output);
+
+struct FoldRule {
+    FoldFunc fold {nullptr};
+    // Shape and Range only read the dims of their inputs or their attributes.
+    bool isDataRequired {true};
+};
+
+// Calls visitor with a value of the C++ type of the data type, float16 is not evaluated on the host.
+template <typename Visitor>
+bool VisitDataType(MSLITE::DataType dataType, Visitor&& visitor)
+{
+    switch (dataType) {
+        case MSLITE::DATA_TYPE_BOOL:
+            return visitor(bool());
+        case MSLITE::DATA_TYPE_INT8:
+            return visitor(int8_t());
+        case MSLITE::DATA_TYPE_INT16:
+            return visitor(int16_t());
+        case MSLITE::DATA_TYPE_INT32:
+            return visitor(int32_t());
+        case MSLITE::DATA_TYPE_INT64:
+            return visitor(int64_t());
+        case MSLITE::DATA_TYPE_UINT8:
+            return visitor(uint8_t());
+        case MSLITE::DATA_TYPE_UINT16:
+            return visitor(uint16_t());
+        case MSLITE::DATA_TYPE_UINT32:
+            return visitor(uint32_t());
+        case MSLITE::DATA_TYPE_UINT64:
+            return visitor(uint64_t());
+        case MSLITE::DATA_TYPE_FLOAT32:
+            return visitor(float());
+        case MSLITE::DATA_TYPE_FLOAT64:
+            return visitor(double());
+        default:
+            return false;
+    }
+}
+
+bool GetElementCount(const std::vector<int32_t>& dims, size_t& count)
+{
+    count = 1;
+    for (int32_t dim : dims) {
+        if (dim < 0) {
+            return false;
+        }
+        count *= static_cast<size_t>(dim);
+        if (count > CONSTANT_FOLDING_MAX_SIZE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ReadIntegers(const FoldedTensor& tensor, std::vector<int64_t>& values)
+{
+    return VisitDataType(tensor.dataType, [&tensor, &values](auto type) {
+        using T = decltype(type);
+        if constexpr (!std::is_integral_v<T>) {
+            return false;
+        } else {
+            values.resize(tensor.data.size() / sizeof(T));
+            for (size_t i = 0; i < values.size(); ++i) {
+                T value {};
+                (void)memcpy_s(&value, sizeof(T), tensor.data.data() + i * sizeof(T), sizeof(T));
+                values[i] = static_cast<int64_t>(value);
+            }
+            return true;
+        }
+    });
+}
+
+template <typename Source>
+bool WriteValues(const std::vector<Source>& values, MSLITE::DataType dataType, std::vector<uint8_t>& data)
+{
+    return VisitDataType(dataType, [&values, &data](auto type) {
+        using T = decltype(type);
+        data.resize(values.size() * sizeof(T));
+        for (size_t i = 0; i < values.size(); ++i) {
+            T value = static_cast<T>(values[i]);
+            (void)memcpy_s(data.data() + i * sizeof(T), sizeof(T), &value, sizeof(T));
+        }
+        return true;
+    });
+}
+
+bool ConvertValues(const FoldedTensor& input, MSLITE::DataType dataType, std::vector<uint8_t>& data)
+{
+    return VisitDataType(input.dataType, [&input, dataType, &data](auto sourceType) {
+        using S = decltype(sourceType);
+        return VisitDataType(dataType, [&input, &data](auto targetType) {
+            using T = decltype(targetType);
+            size_t count = input.data.size() / sizeof(S);
+            data.resize(count * sizeof(T));
+            for (size_t i = 0; i < count; ++i) {
+                S source {};
+                (void)memcpy_s(&source, sizeof(S), input.data.data() + i * sizeof(S), sizeof(S));
+                T target = static_cast<T>(source);
+                (void)memcpy_s(data.data() + i * sizeof(T), sizeof(T), &target, sizeof(T));
+            }
+            return true;
+        });
+    });
+}
+
+// Dims of a shape tensor, each one of them may be -1 if count is given, it is inferred from count then.
+bool ReadShape(const FoldedTensor& tensor, std::vector<int32_t>& dims, size_t count = SIZE_MAX)
+{
+    std::vector<int64_t> values;
+    if (!ReadIntegers(tensor, values)) {
+        return false;
+    }
+    dims.clear();
+    size_t knownCount {1};
+    size_t inferredPos {SIZE_MAX};
+    for (int64_t value : values) {
+        if (value == -1 && count != SIZE_MAX && inferredPos == SIZE_MAX) {
+            inferredPos = dims.size();
+            dims.emplace_back(0);
+            continue;
+        }
+        if (value < 0 || value > INT32_MAX) {
+            return false;
+        }
+        dims.emplace_back(static_cast<int32_t>(value));
+        knownCount *= static_cast<size_t>(value);
+        if (knownCount > CONSTANT_FOLDING_MAX_SIZE) {
+            return false;
+        }
+    }
+    if (inferredPos != SIZE_MAX) {
+        if (knownCount == 0 || count % knownCount != 0) {
+            return false;
+        }
+        dims[inferredPos] = static_cast<int32_t>(count / knownCount);
+    }
+    return true;
+}
+
+bool FoldShape(const MSLITE::LiteGraph::Node& node, const std::vector<FoldedTensor>& inputs, FoldedTensor& output)
+{
+    if (inputs.empty() || (output.dataType != MSLITE::DATA_TYPE_INT32 && output.dataType != MSLITE::DATA_TYPE_INT64)) {
+        return false;
+    }
+    for (int32_t dim : inputs[0].dims) {
+        if (dim < 0) {
+            return false;
+        }
+    }
+    output.dims = {static_cast<int32_t>(inputs[0].dims.size())};
+    std::vector<int64_t> values(inputs[0].dims.begin(), inputs[0].dims.end());
+    return WriteValues(values, output.dataType, output.data);
+}
+
+bool FoldRange(const MSLITE::LiteGraph::Node& node, const std::vector<FoldedTensor>& inputs, FoldedTensor& output)
+{
+    // NNRt's Range takes one input, a Range given more inputs reads start, limit and delta from them instead.
+    if (inputs.size() > 1) {
+        return false;
+    }
+    int64_t start = MSLITE::MindIR_Range_GetStart(node.primitive_);
+    int64_t limit = MSLITE::MindIR_Range_GetLimit(node.primitive_);
+    int64_t delta = MSLITE::MindIR_Range_GetDelta(node.primitive_);
+    if (delta == 0) {
+        return false;
+    }
+    // The count is computed in double, the int64 difference of the attributes may overflow.
+    double steps = (static_cast<double>(limit) - static_cast<double>(start)) / static_cast<double>(delta);
+    if (steps > static_cast<double>(CONSTANT_FOLDING_MAX_SIZE)) {
+        return false;
+    }
+    size_t count = steps > 0 ? static_cast<size_t>(std::ceil(steps)) : 0;
+    std::vector<int64_t> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = start + static_cast<int64_t>(i) * delta;
+    }
+    output.dims = {static_cast<int32_t>(count)};
+    return WriteValues(values, output.dataType, output.data);
+}
+
+bool FoldFill(const MSLITE::LiteGraph::Node& node, const std::vector<FoldedTensor>& inputs, FoldedTensor& output)
+{
+    const size_t fillInputNum = 2;
+    if (inputs.size() < fillInputNum || inputs[0].dataType != output.dataType ||
+        !ReadShape(inputs[1], output.dims)) {
+        return false;
+    }
+    size_t count {0};
+    uint32_t typeSize = GetTypeSize(MSToNN::TransformDataType(output.dataType));
+    if (!GetElementCount(output.dims, count) || typeSize == 0 || inputs[0].data.size() != typeSize) {
+        return false;
+    }
+    output.data.resize(count * typeSize);
+    for (size_t i = 0; i < count; ++i) {
+        (void)memcpy_s(output.data.data() + i * typeSize, typeSize, inputs[0].data.data(), typeSize);
+    }
+    return true;
+}
+
+bool FoldConstantOfShape(const MSLITE::LiteGraph::Node& node, const std::vector<FoldedTensor>& inputs,
+    FoldedTensor& output)
+{
+    if (inputs.empty() || !ReadShape(inputs[0], output.dims)) {
+        return false;
+    }
+    size_t count {0};
+    if (!GetElementCount(output.dims, count)) {
+        return false;
+    }
+    std::vector<float> value = MSLITE::MindIR_ConstantOfShape_GetValue(node.primitive_);
+    std::vector<float> values(count, value.empty() ? 0.0f : value[0]);
+    return WriteValues(values, output.dataType, output.data);
+}
+
+bool FoldCast(const MSLITE::LiteGraph::Node& node, const std::vector<FoldedTensor>& inputs, FoldedTensor& output)
+{
+    if (inputs.empty()) {
+        return false;
+    }
+    output.dims = inputs[0].dims;
+    return ConvertValues(inputs[0], output.dataType, output.data);
+}
+
+bool FoldGather(const MSLITE::LiteGraph::Node& node, const std::vector<FoldedTensor>& inputs, FoldedTensor& output)
+{
+    const size_t gatherInputNum = 3;
+    std::vector<int64_t> indices;
+    std::vector<int64_t> axes;
+    if (inputs.size() < gatherInputNum || inputs[0].dataType != output.dataType ||
+        !ReadIntegers(inputs[1], indices) || !ReadIntegers(inputs[2], axes) || axes.size() != 1) {
+        return false;
+    }
+    const FoldedTensor& input = inputs[0];
+    int64_t rank = static_cast<int64_t>(input.dims.size());
+    int64_t axis = axes[0] < 0 ? axes[0] + rank : axes[0];
+    if (axis < 0 || axis >= rank) {
+        return false;
+    }
+
+    size_t outerCount {1};
+    size_t innerCount {1};
+    for (int64_t i = 0; i < rank; ++i) {
+        if (i < axis) {
+            outerCount *= static_cast<size_t>(input.dims[i]);
+        } else if (i > axis) {
+            innerCount *= static_cast<size_t>(input.dims[i]);
+        }
+    }
+    int64_t axisDim = input.dims[axis];
+    uint32_t typeSize = GetTypeSize(MSToNN::TransformDataType(input.dataType));
+    size_t sliceSize = innerCount * typeSize;
+    if (typeSize == 0 || input.data.size() != outerCount * static_cast<size_t>(axisDim) * sliceSize) {
+        return false;
+    }
+    // Checked before the result is allocated, the indices may repeat a slice far more often than the input holds it.
+    size_t indexedSize = outerCount * sliceSize;
+    if (indexedSize != 0 && indices.size() > CONSTANT_FOLDING_MAX_SIZE / indexedSize) {
+        return false;
+    }
+
+    output.dims.assign(input.dims.begin(), input.dims.begin() + axis);
+    output.dims.insert(output.dims.end(), inputs[1].dims.begin(), inputs[1].dims.end());
+    output.dims.insert(output.dims.end(), input.dims.begin() + axis + 1, input.dims.end());
+    output.data.resize(outerCount * indices.size() * sliceSize);
+    uint8_t* dst = output.data.data();
+    for (size_t outer = 0; outer < outerCount; ++outer) {
+        for (int64_t index : indices) {
+            index = index < 0 ? index + axisDim : index;
+            if (index < 0 || index >= axisDim) {
+                return false;
+            }
+            const uint8_t* src = input.data.data() + (outer * static_cast<size_t>(axisDim) +
+                static_cast<size_t>(index)) * sliceSize;
+            (void)memcpy_s(dst, sliceSize, src, sliceSize);
+            dst += sliceSize;
+        }
+    }
+    return true;
+}
+
+bool FoldReshape(const MSLITE::LiteGraph::Node& node, const std::vector<FoldedTensor>& inputs, FoldedTensor& output)
+{
+    const size_t reshapeInputNum = 2;
+    size_t count {0};
+    if (inputs.size() < reshapeInputNum || inputs[0].dataType != output.dataType ||
+        !GetElementCount(inputs[0].dims, count) || !ReadShape(inputs[1], output.dims, count)) {
+        return false;
+    }
+    size_t outputCount {0};
+    if (!GetElementCount(output.dims, outputCount) || outputCount != count) {
+        return false;
+    }
+    output.data = inputs[0].data;
+    return true;
+}
+
+const std::unordered_map<MSLITE::NodeType, FoldRule> FOLD_RULES = {
+    {MSLITE::NODE_TYPE_SHAPE, {FoldShape, false}},
+    {MSLITE::NODE_TYPE_RANGE, {FoldRange, false}},
+    {MSLITE::NODE_TYPE_FILL, {FoldFill, true}},
+    {MSLITE::NODE_TYPE_CONSTANT_OF_SHAPE, {FoldConstantOfShape, true}},
+    {MSLITE::NODE_TYPE_CAST, {FoldCast, true}},
+    {MSLITE::NODE_TYPE_GATHER, {FoldGather, true}},
+    {MSLITE::NODE_TYPE_RESHAPE, {FoldReshape, true}},
+};
+} // namespace
+
+void ConstantFolder::Fold(LiteGraphRewriter& rewriter, GraphPassSummary& summary) const
+{
+    const MSLITE::LiteGraph* liteGraph = rewriter.GetLiteGraph();
+    uint32_t nodeCount = static_cast<uint32_t>(liteGraph->all_nodes_.size());
+    std::vector<uint32_t> foldedTensors;
+    // The nodes are not sorted, a sweep which folds a node may enable the folding of its consumers before it.
+    bool isFolded = true;
+    while (isFolded) {
+        isFolded = false;
+        for (uint32_t i = 0; i < nodeCount; ++i) {
+            if (!rewriter.IsRemoved(i) && FoldNode(rewriter, i)) {
+                foldedTensors.emplace_back(liteGraph->all_nodes_[i]->output_indices_[0]);
+                ++summary.foldedCount;
+                isFolded = true;
+            }
+        }
+    }
+
+    // Only the results which are still read by the device are kept as constants, the others are removed.
+    std::vector<bool> isRead(liteGraph->all_tensors_.size(), false);
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        if (!rewriter.IsRemoved(i)) {
+            for (uint32_t index : liteGraph->all_nodes_[i]->input_indices_) {
+                isRead[index] = true;
+            }
+        }
+    }
+    for (uint32_t index : foldedTensors) {
+        size_t size {0};
+        if (isRead[index] && GetTensorSize(liteGraph->all_tensors_[index], size)) {
+            summary.foldedBytes += size;
+        }
+    }
+}
+
+bool ConstantFolder::FoldNode(LiteGraphRewriter& rewriter, uint32_t nodeIndex) const
+{
+    MSLITE::LiteGraph* liteGraph = rewriter.GetLiteGraph();
+    const MSLITE::LiteGraph::Node* node = liteGraph->all_nodes_[nodeIndex];
+    if (node->primitive_ == nullptr) {
+        return false;
+    }
+    auto iter = FOLD_RULES.find(MSLITE::MindIR_Primitive_GetType(node->primitive_));
+    if (iter == FOLD_RULES.end() || node->output_indices_.size() != 1 ||
+        rewriter.IsGraphOutput(node->output_indices_[0])) {
+        return false;
+    }
+    const FoldRule& rule = iter->second;
+
+    for (uint32_t index : node->input_indices_) {
+        if (rule.isDataRequired && (rewriter.GetProducer(index) != LiteGraphRewriter::NO_NODE ||
+            rewriter.IsGraphInput(index))) {
+            return false;
+        }
+        if (!MSLITE::MindIR_Tensor_GetQuantParams(liteGraph->all_tensors_[index]).empty()) {
+            return false;
+        }
+    }
+    MSLITE::TensorPtr& outputTensor = liteGraph->all_tensors_[node->output_indices_[0]];
+    if (!MSLITE::MindIR_Tensor_GetQuantParams(outputTensor).empty()) {
+        return false;
+    }
+
+    std::vector<FoldedTensor> inputs(node->input_indices_.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        MSLITE::TensorPtr tensor = liteGraph->all_tensors_[node->input_indices_[i]];
+        inputs[i].dataType = MSLITE::MindIR_Tensor_GetDataType(tensor);
+        inputs[i].dims = MSLITE::MindIR_Tensor_GetDims(tensor);
+        if (!rule.isDataRequired) {
+            continue;
+        }
+        // Checked before the data is copied out of the tensor, a large constant is never folded.
+        size_t size {0};
+        if (!GetTensorSize(tensor, size) || size == 0 || size > CONSTANT_FOLDING_MAX_SIZE) {
+            return false;
+        }
+        inputs[i].data = MSLITE::MindIR_Tensor_GetData(tensor);
+        if (inputs[i].data.size() != size) {
+            return false;
+        }
+    }
+
+    FoldedTensor output;
+    output.dataType = MSLITE::MindIR_Tensor_GetDataType(outputTensor);
+    // An empty result would not be a constant, the tensor is told from an intermediate one by its data.
+    if (!rule.fold(*node, inputs, output) || output.data.empty() || output.data.size() > CONSTANT_FOLDING_MAX_SIZE) {
+        return false;
+    }
+
+    MSLITE::MindIR_Tensor_SetDims(&outputTensor, output.dims);
+    MSLITE::MindIR_Tensor_SetData(&outputTensor, output.data);
+    rewriter.RemoveNode(nodeIndex);
+    return true;
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
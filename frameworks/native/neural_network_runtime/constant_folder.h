@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_CONSTANT_FOLDER_H
+#define NEURAL_NETWORK_RUNTIME_CONSTANT_FOLDER_H
+
+#include "lite_graph_rewriter.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// Larger results are left to the device rather than stored in the model, e.g. a Fill of a whole feature map.
+constexpr size_t CONSTANT_FOLDING_MAX_SIZE = 1024 * 1024;
+
+// Evaluates the nodes of a lite graph whose results are known before execution on the host, e.g. the
+// Shape->Gather->Reshape chains of exported graphs. A node is folded if:
+// 1. it is a Shape of a tensor of static dims, or a Range, or a Cast, ConstantOfShape, Fill, Gather or Reshape of
+//    constant tensors;
+// 2. its result is not an output of the graph, and takes at most CONSTANT_FOLDING_MAX_SIZE bytes;
+// 3. none of its tensors is quantized.
+// The result becomes a constant tensor and the node is removed, so it is neither sent to the device nor executed by
+// each run. Nodes are folded until a fixed point, the results of folded nodes are constants for their consumers.
+class ConstantFolder {
+public:
+    void Fold(LiteGraphRewriter& rewriter, GraphPassSummary& summary) const;
+
+private:
+    bool FoldNode(LiteGraphRewriter& rewriter, uint32_t nodeIndex) const;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_CONSTANT_FOLDER_H
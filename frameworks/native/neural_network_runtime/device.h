@@ -21,6 +21,7 @@
 #include <memory>
 
 #include "neural_network_runtime/neural_network_runtime_type.h"
+#include "neural_network_runtime_inner.h"
 #include "cpp_type.h"
 #include "tensor_desc.h"
 #include "prepared_model.h"
@@ -70,6 +71,22 @@ public:
     virtual OH_NN_ReturnCode AllocateBuffer(size_t length, int& fd) = 0;
     virtual OH_NN_ReturnCode ReleaseBuffer(int fd, size_t length) = 0;
     virtual OH_NN_ReturnCode ReadOpVersion(int& currentOpVersion) = 0;
+
+    // Allocates a buffer with its mapping, which is owned by the device and must not be unmapped by the caller.
+    // The buffer is released with ReleaseBuffer(fd, length).
+    virtual OH_NN_ReturnCode AllocateMappedBuffer(size_t length, int& fd, void*& data)
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    virtual OH_NN_ReturnCode SetBufferPoolHighWaterMark(size_t highWaterMark)
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    virtual OH_NN_ReturnCode GetBufferPoolStatistics(OH_NN_BufferPoolStatistics& statistics) const
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
 };
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
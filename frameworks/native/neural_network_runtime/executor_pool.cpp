@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "executor_pool.h"
+
+#include "log.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+ExecutorPool::ExecutorPool(Executor* executor, size_t contextNum)
+    : m_executor(executor), m_contextNum(contextNum), m_contexts(contextNum)
+{
+    m_idleContexts.reserve(contextNum);
+    for (size_t i = contextNum; i > 0; --i) {
+        m_idleContexts.emplace_back(i - 1);
+    }
+}
+
+Executor* ExecutorPool::GetExecutor() const
+{
+    return m_executor;
+}
+
+size_t ExecutorPool::GetContextNum() const
+{
+    return m_contextNum;
+}
+
+size_t ExecutorPool::AcquireContext()
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    m_idleCv.wait(lock, [this] { return !m_idleContexts.empty(); });
+    size_t contextIndex = m_idleContexts.back();
+    m_idleContexts.pop_back();
+    return contextIndex;
+}
+
+void ExecutorPool::ReleaseContext(size_t contextIndex)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_idleContexts.emplace_back(contextIndex);
+    }
+    m_idleCv.notify_one();
+}
+
+OH_NN_ReturnCode ExecutorPool::RunSync(NN_Tensor* inputTensors[], size_t inputSize,
+    NN_Tensor* outputTensors[], size_t outputSize)
+{
+    if (m_executor == nullptr) {
+        LOGE("ExecutorPool::RunSync failed, executor is nullptr.");
+        return OH_NN_NULL_PTR;
+    }
+    if (m_contextNum == 0) {
+        LOGE("ExecutorPool::RunSync failed, there is no execution context.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    size_t contextIndex = AcquireContext();
+    ExecutionContext& context = m_contexts[contextIndex];
+    OH_NN_ReturnCode ret = m_executor->RunWithStatistics(
+        [this, &context, inputTensors, inputSize, outputTensors, outputSize]() {
+            return m_executor->RunSyncInContext(context, inputTensors, inputSize, outputTensors, outputSize);
+        });
+    ReleaseContext(contextIndex);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("ExecutorPool::RunSync failed, failed to run in context %{public}zu.", contextIndex);
+        return ret;
+    }
+
+    return OH_NN_SUCCESS;
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
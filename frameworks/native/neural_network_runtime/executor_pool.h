@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_EXECUTOR_POOL_H
+#define NEURAL_NETWORK_RUNTIME_EXECUTOR_POOL_H
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "executor.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// Serves concurrent RunSync requests with one executor, so that the prepared model, the tensor descriptions,
+// the scheduling and the callbacks registered by ExecutorPrepare are shared by all execution contexts.
+// The number of contexts bounds how many executions are submitted to the device at the same time. Each context keeps
+// the run vectors and the output shapes of its executions, the IO tensor bindings are taken by the run from the
+// prepared model. The executions are accounted as the ones of OH_NNExecutor_RunSync, in the inference counters and
+// latencies of the executor.
+class ExecutorPool {
+public:
+    ExecutorPool(Executor* executor, size_t contextNum);
+    ~ExecutorPool() = default;
+
+    OH_NN_ReturnCode RunSync(NN_Tensor* inputTensors[],
+                             size_t inputSize,
+                             NN_Tensor* outputTensors[],
+                             size_t outputSize);
+    Executor* GetExecutor() const;
+    size_t GetContextNum() const;
+
+private:
+    size_t AcquireContext();
+    void ReleaseContext(size_t contextIndex);
+
+private:
+    Executor* m_executor {nullptr};
+    size_t m_contextNum {0};
+    // Used by one execution at a time, the ones which are not are listed in m_idleContexts.
+    std::vector<ExecutionContext> m_contexts;
+    std::vector<size_t> m_idleContexts;
+    std::mutex m_mtx;
+    std::condition_variable m_idleCv;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_EXECUTOR_POOL_H
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "graph_eliminator.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "lite_graph_to_hdi_model_v2_1.h"
+
+namespace MSLITE = mindspore::lite;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+template<typename T>
+void AppendKey(std::string& key, const T& value)
+{
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+void AppendKey(std::string& key, const std::vector<T>& values)
+{
+    AppendKey(key, values.size());
+    key.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+bool HasSingleSubGraph(const MSLITE::LiteGraph& liteGraph)
+{
+    return liteGraph.sub_graphs_.size() <= 1;
+}
+} // namespace
+
+void GraphEliminator::EliminateDeadNodes(LiteGraphRewriter& rewriter, GraphPassSummary& summary) const
+{
+    MSLITE::LiteGraph* liteGraph = rewriter.GetLiteGraph();
+    if (!HasSingleSubGraph(*liteGraph)) {
+        return;
+    }
+
+    uint32_t nodeCount = static_cast<uint32_t>(liteGraph->all_nodes_.size());
+    std::vector<bool> isLive(nodeCount, false);
+    std::vector<uint32_t> pendingNodes;
+    auto markLive = [&isLive, &pendingNodes](uint32_t nodeIndex) {
+        if (nodeIndex != LiteGraphRewriter::NO_NODE && !isLive[nodeIndex]) {
+            isLive[nodeIndex] = true;
+            pendingNodes.emplace_back(nodeIndex);
+        }
+    };
+    for (uint32_t index : liteGraph->output_indices_) {
+        markLive(rewriter.GetProducer(index));
+    }
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        const MSLITE::LiteGraph::Node* node = liteGraph->all_nodes_[i];
+        if (!rewriter.IsRemoved(i) && (node->output_indices_.empty() || (node->primitive_ != nullptr &&
+            MSLITE::MindIR_Primitive_GetType(node->primitive_) == MSLITE::NODE_TYPE_ASSERT))) {
+            markLive(i);
+        }
+    }
+    while (!pendingNodes.empty()) {
+        uint32_t nodeIndex = pendingNodes.back();
+        pendingNodes.pop_back();
+        for (uint32_t index : liteGraph->all_nodes_[nodeIndex]->input_indices_) {
+            markLive(rewriter.GetProducer(index));
+        }
+    }
+
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        if (!isLive[i] && !rewriter.IsRemoved(i)) {
+            rewriter.RemoveNode(i);
+            ++summary.eliminatedCount;
+        }
+    }
+}
+
+void GraphEliminator::MergeCommonNodes(LiteGraphRewriter& rewriter, GraphPassSummary& summary) const
+{
+    MSLITE::LiteGraph* liteGraph = rewriter.GetLiteGraph();
+    if (!HasSingleSubGraph(*liteGraph)) {
+        return;
+    }
+
+    // The nodes which read the outputs of a merged node may be merged in turn. They follow it in a graph of
+    // topological order and are merged by the same sweep, otherwise by the next one.
+    uint32_t nodeCount = static_cast<uint32_t>(liteGraph->all_nodes_.size());
+    bool isMerged {true};
+    while (isMerged) {
+        isMerged = false;
+        std::unordered_map<std::string, uint32_t> keptNodes;
+        for (uint32_t i = 0; i < nodeCount; ++i) {
+            std::string key;
+            if (rewriter.IsRemoved(i) || !GetNodeKey(rewriter, i, key)) {
+                continue;
+            }
+            auto iter = keptNodes.find(key);
+            if (iter == keptNodes.end()) {
+                keptNodes.emplace(std::move(key), i);
+                continue;
+            }
+            const std::vector<uint32_t>& outputs = liteGraph->all_nodes_[i]->output_indices_;
+            if (std::none_of(outputs.begin(), outputs.end(), [&rewriter](uint32_t index) {
+                return rewriter.IsGraphOutput(index);
+            })) {
+                rewriter.MergeNode(iter->second, i);
+                ++summary.mergedCount;
+                isMerged = true;
+            }
+        }
+    }
+}
+
+bool GraphEliminator::GetNodeKey(const LiteGraphRewriter& rewriter, uint32_t nodeIndex, std::string& key) const
+{
+    const MSLITE::LiteGraph* liteGraph = rewriter.GetLiteGraph();
+    const MSLITE::LiteGraph::Node* node = liteGraph->all_nodes_[nodeIndex];
+    std::vector<int8_t> attributes;
+    if (node->primitive_ == nullptr || node->output_indices_.empty() ||
+        !NNRt_V2_1::SerializeAttributes(node->primitive_, attributes)) {
+        return false;
+    }
+
+    AppendKey(key, static_cast<int32_t>(MSLITE::MindIR_Primitive_GetType(node->primitive_)));
+    AppendKey(key, node->quant_type_);
+    AppendKey(key, attributes);
+    AppendKey(key, node->input_indices_);
+    // The outputs of the merged node take the declaration of the kept ones.
+    AppendKey(key, node->output_indices_.size());
+    for (uint32_t index : node->output_indices_) {
+        MSLITE::TensorPtr tensor = liteGraph->all_tensors_[index];
+        AppendKey(key, static_cast<int32_t>(MSLITE::MindIR_Tensor_GetDataType(tensor)));
+        AppendKey(key, static_cast<int32_t>(MSLITE::MindIR_Tensor_GetFormat(tensor)));
+        AppendKey(key, MSLITE::MindIR_Tensor_GetDims(tensor));
+        std::vector<MSLITE::QuantParam> quantParams = MSLITE::MindIR_Tensor_GetQuantParams(tensor);
+        AppendKey(key, quantParams.size());
+        for (const MSLITE::QuantParam& param : quantParams) {
+            AppendKey(key, param.numBits);
+            AppendKey(key, param.zeroPoint);
+            AppendKey(key, param.scale);
+        }
+    }
+    return true;
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
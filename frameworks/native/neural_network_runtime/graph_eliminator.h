@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_GRAPH_ELIMINATOR_H
+#define NEURAL_NETWORK_RUNTIME_GRAPH_ELIMINATOR_H
+
+#include <string>
+
+#include "lite_graph_rewriter.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// Removes the nodes whose results are not needed by the graph, and the nodes which compute the same results as
+// another one. Both of them skip a graph of several subgraphs, whose control flow may read any tensor.
+class GraphEliminator {
+public:
+    // Removes the nodes from which no output of the graph is reachable. A node which has no output or asserts a
+    // condition is kept, it is run for its effect.
+    void EliminateDeadNodes(LiteGraphRewriter& rewriter, GraphPassSummary& summary) const;
+    // Merges the nodes of the same primitive type, serialized attributes and input indices into the first of them,
+    // if their outputs are declared alike and none of the merged ones is an output of the graph.
+    void MergeCommonNodes(LiteGraphRewriter& rewriter, GraphPassSummary& summary) const;
+
+private:
+    // Fails if the node cannot be merged, e.g. its type has no serialized attributes.
+    bool GetNodeKey(const LiteGraphRewriter& rewriter, uint32_t nodeIndex, std::string& key) const;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_GRAPH_ELIMINATOR_H
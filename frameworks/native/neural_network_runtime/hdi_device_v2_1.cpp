@@ -124,7 +124,29 @@ OH_NN_ReturnCode IsOfflineModel(std::shared_ptr<const mindspore::lite::LiteGraph
 }
 }  // unamed namespace
 
-HDIDeviceV2_1::HDIDeviceV2_1(OHOS::sptr<V2_1::INnrtDevice> device) : m_iDevice(device)
+HDIDeviceV2_1::HDIDeviceV2_1(OHOS::sptr<V2_1::INnrtDevice> device)
+    : m_iDevice(device),
+      m_bufferPool([this](size_t length, int& fd) { return AllocateDeviceBuffer(length, fd); },
+                   [this](int fd, size_t length) { return ReleaseDeviceBuffer(fd, length); }),
+      // Not bound to this, a blob may be released after the device is destroyed.
+      m_weightStore(
+          [device](size_t length, int& fd) {
+              V2_1::SharedBuffer buffer {INVALID_FD, 0, 0, 0};
+              auto ret = device->AllocateBuffer(length, buffer);
+              if (ret != V2_1::NNRT_ReturnCode::NNRT_SUCCESS || buffer.fd == INVALID_FD) {
+                  return CheckReturnCode_V2_1(ret, OH_NN_MEMORY_ERROR, "Allocate weight buffer error");
+              }
+              fd = buffer.fd;
+              return OH_NN_SUCCESS;
+          },
+          [device](int fd, size_t length) {
+              V2_1::SharedBuffer buffer {fd, length, 0, length};
+              auto ret = device->ReleaseBuffer(buffer);
+              if (ret != V2_1::NNRT_ReturnCode::NNRT_SUCCESS) {
+                  return CheckReturnCode_V2_1(ret, OH_NN_FAILED, "Release weight buffer error");
+              }
+              return OH_NN_SUCCESS;
+          })
 {}
 
 OH_NN_ReturnCode HDIDeviceV2_1::GetDeviceName(std::string& name)
@@ -200,30 +222,19 @@ OH_NN_ReturnCode HDIDeviceV2_1::GetSupportedOperation(std::shared_ptr<const mind
         return OH_NN_SUCCESS;
     }
 
-    OHOS::HDI::Nnrt::V2_1::SharedBuffer tensorBuffer {INVALID_FD, 0, 0, 0};
-    size_t tensorSize = mindspore::lite::MindIR_LiteGraph_GetConstTensorSize(model.get());
-    int32_t ret {0};
-    if (tensorSize > 0) {
-        ret = m_iDevice->AllocateBuffer(tensorSize, tensorBuffer);
-        if (ret != V2_1::NNRT_ReturnCode::NNRT_SUCCESS || tensorBuffer.fd == INVALID_FD) {
-            return CheckReturnCode_V2_1(ret, OH_NN_FAILED, "Allocate tensor buffer error when get supported operation");
-        }
-    }
-
-    auto iModel = NNRt_V2_1::LiteGraph_To_HDIModel(model.get(), tensorBuffer);
+    std::shared_ptr<const WeightBlob> weights;
+    auto iModel = ConvertToHDIModel(model.get(), weights);
     if (iModel == nullptr) {
         LOGE("Parse litegraph to hdi model failed.");
-        ReleaseSharedBuffer(tensorBuffer);
         return OH_NN_FAILED;
     }
 
-    ret = m_iDevice->GetSupportedOperation(*iModel, ops);
+    int32_t ret = m_iDevice->GetSupportedOperation(*iModel, ops);
 
     NNRt_V2_1::HDIModel_Destroy(&iModel);
-    innerRet = ReleaseSharedBuffer(tensorBuffer);
-    if (innerRet != OH_NN_SUCCESS) {
-        LOGE("Release tensorBuffer failed.");
-        return OH_NN_FAILED;
+    {
+        std::lock_guard<std::mutex> lock(m_queriedWeightsMutex);
+        m_queriedWeights = std::move(weights);
     }
     if (ret != V2_1::NNRT_ReturnCode::NNRT_SUCCESS) {
         return CheckReturnCode_V2_1(ret, OH_NN_UNAVAILABLE_DEVICE, "Get supported operation failed");
@@ -284,20 +295,10 @@ OH_NN_ReturnCode HDIDeviceV2_1::PrepareModel(std::shared_ptr<const mindspore::li
         return OH_NN_INVALID_PARAMETER;
     }
 
-    OHOS::HDI::Nnrt::V2_1::SharedBuffer tensorBuffer {INVALID_FD, 0, 0, 0};
-    size_t tensorSize = mindspore::lite::MindIR_LiteGraph_GetConstTensorSize(model.get());
-    int32_t ret {0};
-    if (tensorSize > 0) {
-        ret = m_iDevice->AllocateBuffer(tensorSize, tensorBuffer);
-        if (ret != V2_1::NNRT_ReturnCode::NNRT_SUCCESS || tensorBuffer.fd == INVALID_FD) {
-            return CheckReturnCode_V2_1(ret, OH_NN_FAILED, "Allocate tensor buffer error when prepare model");
-        }
-    }
-
-    V2_1::Model* iModel = NNRt_V2_1::LiteGraph_To_HDIModel(model.get(), tensorBuffer);
+    std::shared_ptr<const WeightBlob> weights;
+    V2_1::Model* iModel = ConvertToHDIModel(model.get(), weights);
     if (iModel == nullptr) {
         LOGE("Parse litegraph to hdi model failed.");
-        ReleaseSharedBuffer(tensorBuffer);
         return OH_NN_FAILED;
     }
 
@@ -307,19 +308,19 @@ OH_NN_ReturnCode HDIDeviceV2_1::PrepareModel(std::shared_ptr<const mindspore::li
     iModelConfig.priority = TransPriority(config.priority);
     OHOS::sptr<V2_1::IPreparedModel> iPreparedModel;
 
-    ret = m_iDevice->PrepareModel(*iModel, iModelConfig, iPreparedModel);
+    auto ret = m_iDevice->PrepareModel(*iModel, iModelConfig, iPreparedModel);
 
     NNRt_V2_1::HDIModel_Destroy(&iModel);
-    auto innerRet = ReleaseSharedBuffer(tensorBuffer);
-    if (innerRet != OH_NN_SUCCESS) {
-        LOGE("Release tensorBuffer failed.");
-        return OH_NN_FAILED;
+    {
+        std::lock_guard<std::mutex> lock(m_queriedWeightsMutex);
+        m_queriedWeights.reset();
     }
     if (ret != V2_1::NNRT_ReturnCode::NNRT_SUCCESS || iPreparedModel == nullptr) {
         return CheckReturnCode_V2_1(ret, OH_NN_FAILED, "Prepare model failed");
     }
 
-    preparedModel = CreateSharedPtr<HDIPreparedModelV2_1>(iPreparedModel);
+    // The prepared model pins the weights, the other prepares of the same weights share them while it is alive.
+    preparedModel = CreateSharedPtr<HDIPreparedModelV2_1>(iPreparedModel, weights);
     if (preparedModel == nullptr) {
         LOGE("Prepare model failed, because fail to create preparedModel instance.");
         return OH_NN_MEMORY_ERROR;
@@ -375,17 +376,21 @@ void* HDIDeviceV2_1::AllocateBuffer(size_t length)
         return nullptr;
     }
 
-    V2_1::SharedBuffer buffer;
-    auto ret = m_iDevice->AllocateBuffer(length, buffer);
-    if (ret != V2_1::NNRT_ReturnCode::NNRT_SUCCESS) {
-        return CheckReturnCode_V2_1(ret, nullptr, "Allocate buffer error");
+    int fd = INVALID_FD;
+    void* addr = nullptr;
+    auto ret = m_bufferPool.AllocateMapped(length, fd, addr);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("Allocate buffer error.");
+        return nullptr;
     }
 
+    // The mapping is kept by the pool, the memory manager only knows it while the buffer is allocated.
     auto memManager = MemoryManager::GetInstance();
-    auto addr = memManager->MapMemory(buffer.fd, length);
-    if (addr == nullptr) {
-        LOGE("Map fd to address failed.");
-        m_iDevice->ReleaseBuffer(buffer);
+    ret = memManager->AddPooledMemory(fd, addr, length);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("Add the mapped buffer to the memory manager failed.");
+        m_bufferPool.Release(fd, length);
+        return nullptr;
     }
     return addr;
 }
@@ -397,6 +402,21 @@ OH_NN_ReturnCode HDIDeviceV2_1::AllocateBuffer(size_t length, int& fd)
         return OH_NN_INVALID_PARAMETER;
     }
 
+    return m_bufferPool.Allocate(length, fd);
+}
+
+OH_NN_ReturnCode HDIDeviceV2_1::AllocateMappedBuffer(size_t length, int& fd, void*& data)
+{
+    if (length == 0) {
+        LOGE("The length param is invalid, length=0");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    return m_bufferPool.AllocateMapped(length, fd, data);
+}
+
+OH_NN_ReturnCode HDIDeviceV2_1::AllocateDeviceBuffer(size_t length, int& fd)
+{
     V2_1::SharedBuffer buffer;
     auto ret = m_iDevice->AllocateBuffer(length, buffer);
     if (ret != V2_1::NNRT_ReturnCode::NNRT_SUCCESS) {
@@ -408,6 +428,11 @@ OH_NN_ReturnCode HDIDeviceV2_1::AllocateBuffer(size_t length, int& fd)
 }
 
 OH_NN_ReturnCode HDIDeviceV2_1::ReleaseBuffer(int fd, size_t length)
+{
+    return m_bufferPool.Release(fd, length);
+}
+
+OH_NN_ReturnCode HDIDeviceV2_1::ReleaseDeviceBuffer(int fd, size_t length)
 {
     V2_1::SharedBuffer hdiBuffer {fd, length, 0, length};
     auto deviceResult = m_iDevice->ReleaseBuffer(hdiBuffer);
@@ -434,43 +459,50 @@ OH_NN_ReturnCode HDIDeviceV2_1::ReleaseBuffer(const void* buffer)
         return OH_NN_INVALID_PARAMETER;
     }
 
+    // Removed first, the buffer may be allocated again by another thread as soon as it is back in the pool.
     auto memManager = MemoryManager::GetInstance();
     Memory memory;
-    auto ret = memManager->GetMemory(buffer, memory);
+    auto ret = memManager->RemovePooledMemory(buffer, memory);
     if (ret != OH_NN_SUCCESS) {
         LOGE("Invalid Buffer, it is not NNRt buffer.");
         return ret;
     }
 
-    V2_1::SharedBuffer hdiBuffer {memory.fd, memory.length, 0, memory.length};
-    auto deviceResult = m_iDevice->ReleaseBuffer(hdiBuffer);
-    if (deviceResult != V2_1::NNRT_ReturnCode::NNRT_SUCCESS) {
-        return CheckReturnCode_V2_1(deviceResult, OH_NN_FAILED, "Device release buffer error");
-    }
-
-    ret = memManager->UnMapMemory(buffer);
+    ret = m_bufferPool.Release(memory.fd, memory.length);
     if (ret != OH_NN_SUCCESS) {
-        LOGE("Unmap memory failed.");
+        LOGE("Device release buffer error.");
         return ret;
     }
 
     return OH_NN_SUCCESS;
 }
 
-OH_NN_ReturnCode HDIDeviceV2_1::ReleaseSharedBuffer(const V2_1::SharedBuffer& buffer)
+OH_NN_ReturnCode HDIDeviceV2_1::SetBufferPoolHighWaterMark(size_t highWaterMark)
 {
-    if (buffer.fd == INVALID_FD) {
-        LOGI("No need to release. fd=%{public}d", INVALID_FD);
-        return OH_NN_SUCCESS;
-    }
+    m_bufferPool.SetHighWaterMark(highWaterMark);
+    return OH_NN_SUCCESS;
+}
 
-    auto ret = m_iDevice->ReleaseBuffer(buffer);
-    if (ret != V2_1::NNRT_ReturnCode::NNRT_SUCCESS) {
-        return CheckReturnCode_V2_1(ret, OH_NN_FAILED, "Device release buffer error");
-    }
+OH_NN_ReturnCode HDIDeviceV2_1::GetBufferPoolStatistics(OH_NN_BufferPoolStatistics& statistics) const
+{
+    m_bufferPool.GetStatistics(statistics);
     return OH_NN_SUCCESS;
 }
 
+V2_1::Model* HDIDeviceV2_1::ConvertToHDIModel(const mindspore::lite::LiteGraph* model,
+    std::shared_ptr<const WeightBlob>& weights)
+{
+    OH_NN_ReturnCode ret = m_weightStore.Acquire(model, weights);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("Acquire the weight buffer failed.");
+        return nullptr;
+    }
+
+    V2_1::SharedBuffer tensorBuffer {weights->fd, static_cast<uint32_t>(weights->size), 0,
+        static_cast<uint32_t>(weights->size)};
+    return NNRt_V2_1::LiteGraph_To_HDIModel(model, tensorBuffer, weights->dataSizes);
+}
+
 OH_NN_ReturnCode HDIDeviceV2_1::GetOfflineModelFromLiteGraph(std::shared_ptr<const mindspore::lite::LiteGraph> graph,
                                                              std::vector<std::vector<uint8_t>>& offlineModels)
 {
@@ -16,12 +16,16 @@
 #ifndef NEURAL_NETWORK_RUNTIME_HDI_DEVICE_V2_1_H
 #define NEURAL_NETWORK_RUNTIME_HDI_DEVICE_V2_1_H
 
+#include <mutex>
+
 #include <v2_1/nnrt_types.h>
 #include <v2_1/innrt_device.h>
 #include <v2_1/iprepared_model.h>
 #include "refbase.h"
 
 #include "device.h"
+#include "shared_buffer_pool.h"
+#include "weight_store.h"
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
@@ -64,11 +68,18 @@ public:
     OH_NN_ReturnCode ReleaseBuffer(const void* buffer) override;
 
     OH_NN_ReturnCode AllocateBuffer(size_t length, int& fd) override;
+    OH_NN_ReturnCode AllocateMappedBuffer(size_t length, int& fd, void*& data) override;
     OH_NN_ReturnCode ReleaseBuffer(int fd, size_t length) override;
     OH_NN_ReturnCode ReadOpVersion(int& currentOpVersion) override;
 
+    OH_NN_ReturnCode SetBufferPoolHighWaterMark(size_t highWaterMark) override;
+    OH_NN_ReturnCode GetBufferPoolStatistics(OH_NN_BufferPoolStatistics& statistics) const override;
+
 private:
-    OH_NN_ReturnCode ReleaseSharedBuffer(const V2_1::SharedBuffer& buffer);
+    // Converts the model with its const tensors in a weight blob, which is shared with the identical weights.
+    V2_1::Model* ConvertToHDIModel(const mindspore::lite::LiteGraph* model, std::shared_ptr<const WeightBlob>& weights);
+    OH_NN_ReturnCode AllocateDeviceBuffer(size_t length, int& fd);
+    OH_NN_ReturnCode ReleaseDeviceBuffer(int fd, size_t length);
     OH_NN_ReturnCode GetOfflineModelFromLiteGraph(std::shared_ptr<const mindspore::lite::LiteGraph> graph,
                                                   std::vector<std::vector<uint8_t>>& offlineModels);
     OH_NN_ReturnCode AllocateDeviceBufferForOfflineModel(const std::vector<std::vector<uint8_t>>& offlineModels,
@@ -84,6 +95,13 @@ private:
     // first: major version, second: minor version
     std::pair<uint32_t, uint32_t> m_hdiVersion;
     OHOS::sptr<V2_1::INnrtDevice> m_iDevice {nullptr};
+    // Declared after m_iDevice, the idle buffers are released to the device when the pool is destroyed.
+    SharedBufferPool m_bufferPool;
+    WeightStore m_weightStore;
+    // Weights of the last GetSupportedOperation, NNCompiler::Build prepares the same graph right after it.
+    // Released by the next PrepareModel.
+    std::shared_ptr<const WeightBlob> m_queriedWeights {nullptr};
+    std::mutex m_queriedWeightsMutex;
 };
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
@@ -19,6 +19,7 @@
 #include "hdi_returncode_utils_v2_1.h"
 #include "memory_manager.h"
 #include "nntensor.h"
+#include "utils.h"
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
@@ -79,14 +80,16 @@ V2_1::IOTensor TransIOTensor(const IOTensor& tensor)
     if (tensor.data != nullptr) {
         auto memManager = MemoryManager::GetInstance();
         Memory memory;
-        auto ret = memManager->GetMemory(tensor.data, memory);
+        // The data may point into the middle of a shared buffer, it is passed to the device with its offset.
+        auto ret = memManager->FindMemory(tensor.data, memory);
         if (ret != OH_NN_SUCCESS) {
             LOGE("Invalid Tensor buffer, cannot transform to fd.");
         } else {
+            size_t offset = static_cast<const char*>(tensor.data) - static_cast<const char*>(memory.data);
             iBuffer.fd = memory.fd;
             iBuffer.bufferSize = memory.length;
-            iBuffer.offset = 0;
-            iBuffer.dataSize = memory.length;
+            iBuffer.offset = offset;
+            iBuffer.dataSize = memory.length - offset;
         }
     }
     iTensor.data = iBuffer;
@@ -108,15 +111,17 @@ OH_NN_ReturnCode TransIOTensor(const NN_Tensor* tensor, V2_1::IOTensor& ioTensor
         return OH_NN_NULL_PTR;
     }
 
-    // convert name
+    // convert name, the cached name is only replaced when it differs
     const char* tensorName = nullptr;
     OH_NN_ReturnCode ret = nnTensorDesc->GetName(&tensorName);
     if (ret != OH_NN_SUCCESS) {
         LOGE("TransIOTensor failed, failed to get name from desc.");
         return ret;
     }
-    ioTensor.name = tensorName;
-    
+    if (ioTensor.name != tensorName) {
+        ioTensor.name = tensorName;
+    }
+
     // convert data type
     OH_NN_DataType dataType;
     ret = nnTensorDesc->GetDataType(&dataType);
@@ -143,10 +148,8 @@ OH_NN_ReturnCode TransIOTensor(const NN_Tensor* tensor, V2_1::IOTensor& ioTensor
         LOGE("TransIOTensor failed, failed to get shape from desc.");
         return ret;
     }
-    ioTensor.dimensions.clear();
-    for (size_t i = 0; i < shapeNum; ++i) {
-        ioTensor.dimensions.emplace_back(shape[i]);
-    }
+    // assign() reuses the capacity of the cached dimensions
+    ioTensor.dimensions.assign(shape, shape + shapeNum);
 
     // convert data
     if (!nnTensor->CheckTensorData()) {
@@ -158,10 +161,30 @@ OH_NN_ReturnCode TransIOTensor(const NN_Tensor* tensor, V2_1::IOTensor& ioTensor
 
     return OH_NN_SUCCESS;
 }
+
+OH_NN_ReturnCode TransIOTensors(const std::vector<NN_Tensor*>& tensors, std::vector<V2_1::IOTensor>& ioTensors)
+{
+    // Keep the IOTensors of the previous run, so that unchanged fields are not converted again.
+    ioTensors.resize(tensors.size());
+    for (size_t i = 0; i < tensors.size(); ++i) {
+        auto returnCode = TransIOTensor(tensors[i], ioTensors[i]);
+        if (returnCode != OH_NN_SUCCESS) {
+            LOGE("Run failed, failed to transform to ioTensor.");
+            return OH_NN_FAILED;
+        }
+        if (ioTensors[i].data.fd == INVALID_FD) {
+            LOGE("Transform tensor failed, cannot find data file descriptor.");
+            return OH_NN_INVALID_PARAMETER;
+        }
+    }
+
+    return OH_NN_SUCCESS;
+}
 } // unamed namespace
 
-HDIPreparedModelV2_1::HDIPreparedModelV2_1(OHOS::sptr<V2_1::IPreparedModel> hdiPreparedModel)
-    : m_hdiPreparedModel(hdiPreparedModel)
+HDIPreparedModelV2_1::HDIPreparedModelV2_1(OHOS::sptr<V2_1::IPreparedModel> hdiPreparedModel,
+    std::shared_ptr<const WeightBlob> weights)
+    : m_hdiPreparedModel(hdiPreparedModel), m_weights(std::move(weights))
 {
     hdiPreparedModel->GetVersion(m_hdiVersion.first, m_hdiVersion.second);
 }
@@ -242,40 +265,44 @@ OH_NN_ReturnCode HDIPreparedModelV2_1::Run(const std::vector<IOTensor>& inputs,
     return OH_NN_SUCCESS;
 }
 
-OH_NN_ReturnCode HDIPreparedModelV2_1::Run(const std::vector<NN_Tensor*>& inputs,
-    const std::vector<NN_Tensor*>& outputs, std::vector<std::vector<int32_t>>& outputsDims,
-    std::vector<bool>& isOutputBufferEnough)
+std::unique_ptr<HDIPreparedModelV2_1::IOTensorBinding> HDIPreparedModelV2_1::AcquireBinding()
 {
-    V2_1::IOTensor iTensor;
-    std::vector<V2_1::IOTensor> iInputTensors;
-    for (const auto& input: inputs) {
-        auto returnCode = TransIOTensor(input, iTensor);
-        if (returnCode != OH_NN_SUCCESS) {
-            LOGE("Run failed, failed to transform to ioTensor.");
-            return OH_NN_FAILED;
+    {
+        std::lock_guard<std::mutex> lock(m_bindingMutex);
+        if (!m_idleBindings.empty()) {
+            std::unique_ptr<IOTensorBinding> binding = std::move(m_idleBindings.back());
+            m_idleBindings.pop_back();
+            return binding;
         }
-        if (iTensor.data.fd == INVALID_FD) {
-            LOGE("Transform inputs tensor failed, cannot find data file descriptor.");
-            return OH_NN_INVALID_PARAMETER;
-        }
-        iInputTensors.emplace_back(iTensor);
     }
 
-    std::vector<V2_1::IOTensor> iOutputTensors;
-    for (const auto& output: outputs) {
-        auto returnCode = TransIOTensor(output, iTensor);
-        if (returnCode != OH_NN_SUCCESS) {
-            LOGE("Run failed, failed to transform to ioTensor.");
-            return OH_NN_FAILED;
-        }
-        if (iTensor.data.fd == INVALID_FD) {
-            LOGE("Transform outputs tensor failed, cannot find data file descriptor.");
-            return OH_NN_INVALID_PARAMETER;
-        }
-        iOutputTensors.emplace_back(iTensor);
+    // Only reached by the first run, or when more runs than ever before are in flight at the same time.
+    return CreateUniquePtr<IOTensorBinding>();
+}
+
+void HDIPreparedModelV2_1::ReleaseBinding(std::unique_ptr<IOTensorBinding> binding)
+{
+    std::lock_guard<std::mutex> lock(m_bindingMutex);
+    m_idleBindings.emplace_back(std::move(binding));
+}
+
+OH_NN_ReturnCode HDIPreparedModelV2_1::RunWithBinding(IOTensorBinding& binding,
+    const std::vector<NN_Tensor*>& inputs, const std::vector<NN_Tensor*>& outputs,
+    std::vector<std::vector<int32_t>>& outputsDims)
+{
+    auto returnCode = TransIOTensors(inputs, binding.inputs);
+    if (returnCode != OH_NN_SUCCESS) {
+        LOGE("Transform inputs tensor failed.");
+        return returnCode;
     }
 
-    auto ret = m_hdiPreparedModel->Run(iInputTensors, iOutputTensors, outputsDims);
+    returnCode = TransIOTensors(outputs, binding.outputs);
+    if (returnCode != OH_NN_SUCCESS) {
+        LOGE("Transform outputs tensor failed.");
+        return returnCode;
+    }
+
+    auto ret = m_hdiPreparedModel->Run(binding.inputs, binding.outputs, outputsDims);
     if (ret != V2_1::NNRT_ReturnCode::NNRT_SUCCESS) {
         return CheckReturnCode_V2_1(ret, OH_NN_UNAVAILABLE_DEVICE, "Run model failed");
     }
@@ -287,6 +314,21 @@ OH_NN_ReturnCode HDIPreparedModelV2_1::Run(const std::vector<NN_Tensor*>& inputs
     return OH_NN_SUCCESS;
 }
 
+OH_NN_ReturnCode HDIPreparedModelV2_1::Run(const std::vector<NN_Tensor*>& inputs,
+    const std::vector<NN_Tensor*>& outputs, std::vector<std::vector<int32_t>>& outputsDims,
+    std::vector<bool>& isOutputBufferEnough)
+{
+    std::unique_ptr<IOTensorBinding> binding = AcquireBinding();
+    if (binding == nullptr) {
+        LOGE("Run failed, failed to create IOTensor binding.");
+        return OH_NN_MEMORY_ERROR;
+    }
+
+    OH_NN_ReturnCode ret = RunWithBinding(*binding, inputs, outputs, outputsDims);
+    ReleaseBinding(std::move(binding));
+    return ret;
+}
+
 OH_NN_ReturnCode HDIPreparedModelV2_1::GetInputDimRanges(std::vector<std::vector<uint32_t>>& minInputDims,
                                                          std::vector<std::vector<uint32_t>>& maxInputDims)
 {
@@ -17,6 +17,8 @@
 #ifndef NEURAL_NETWORK_RUNTIME_HDI_PREPARED_MODEL_V2_1_H
 #define NEURAL_NETWORK_RUNTIME_HDI_PREPARED_MODEL_V2_1_H
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include <v2_1/innrt_device.h>
@@ -31,9 +33,13 @@ namespace V2_1 = OHOS::HDI::Nnrt::V2_1;
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
+struct WeightBlob;
+
 class HDIPreparedModelV2_1 : public PreparedModel {
 public:
-    explicit HDIPreparedModelV2_1(OHOS::sptr<V2_1::IPreparedModel> hdiPreparedModel);
+    // weights is the blob the model has been prepared from, nullptr if the model is restored from the cache.
+    explicit HDIPreparedModelV2_1(OHOS::sptr<V2_1::IPreparedModel> hdiPreparedModel,
+                                  std::shared_ptr<const WeightBlob> weights = nullptr);
     ~HDIPreparedModelV2_1() override;
 
     OH_NN_ReturnCode ExportModelCache(std::vector<Buffer>& modelCache) override;
@@ -57,11 +63,30 @@ public:
 
     OH_NN_ReturnCode SetAippString(const std::string& aippStrings) override;
 
+private:
+    // HDI IOTensors converted by a previous run. Only the fields which changed since then are patched, so a run
+    // with the same tensors does not allocate. A binding is used by one run at a time.
+    struct IOTensorBinding {
+        std::vector<V2_1::IOTensor> inputs;
+        std::vector<V2_1::IOTensor> outputs;
+    };
+
+    std::unique_ptr<IOTensorBinding> AcquireBinding();
+    void ReleaseBinding(std::unique_ptr<IOTensorBinding> binding);
+    OH_NN_ReturnCode RunWithBinding(IOTensorBinding& binding,
+                                    const std::vector<NN_Tensor*>& inputs,
+                                    const std::vector<NN_Tensor*>& outputs,
+                                    std::vector<std::vector<int32_t>>& outputsDims);
+
 private:
     // first: major version, second: minor version
     std::pair<uint32_t, uint32_t> m_hdiVersion;
     OHOS::sptr<V2_1::IPreparedModel> m_hdiPreparedModel {nullptr};
+    // Pinned while the model is alive, the next prepare of the same weights shares the blob instead of uploading.
+    std::shared_ptr<const WeightBlob> m_weights {nullptr};
     std::vector<void*> m_addrs;
+    std::vector<std::unique_ptr<IOTensorBinding>> m_idleBindings;
+    std::mutex m_bindingMutex;
 };
 } // namespace NeuralNetworkRuntime
 } // OHOS
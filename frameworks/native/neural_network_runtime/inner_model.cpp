@@ -18,6 +18,9 @@
 #include <new>
 #include <unordered_map>
 #include <vector>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "securec.h"
 
@@ -27,6 +30,10 @@
 #include "validation.h"
 #include "ops_builder.h"
 #include "ops_registry.h"
+#include "constant_folder.h"
+#include "graph_eliminator.h"
+#include "operator_fuser.h"
+#include "mapping_policy.h"
 #include "transform.h"
 #include "nnbackend.h"
 
@@ -147,6 +154,8 @@ OH_NN_ReturnCode InnerModel::BuildFromLiteGraph(const MSLITE::LiteGraph* liteGra
     m_liteGraph->name_ = LOADED_NNR_MODEL;
 
     m_extensionConfig = extensionConfig;
+    OptimizeGraph();
+    PlanMemory();
 
     return OH_NN_SUCCESS;
 }
@@ -269,56 +278,128 @@ OH_NN_ReturnCode InnerModel::SetTensorQuantParam(uint32_t index, const NN_QuantP
     return returnCode;
 }
 
-// DOTO: 圈复杂度待优化
 OH_NN_ReturnCode InnerModel::SetTensorValue(uint32_t index, const void* buffer, size_t length)
+{
+    OH_NN_ReturnCode returnCode = CheckTensorValue(index, length);
+    if (returnCode != OH_NN_SUCCESS) {
+        return returnCode;
+    }
+
+    if (buffer == nullptr) {
+        LOGW("SetTensorValue passed empty buffer, which makes no effect.");
+        return OH_NN_SUCCESS;
+    }
+
+    // Data will be released inside NNTensor if it is set inside NNTensor using SetBuffer().
+    void* data = new (std::nothrow) char[length];
+    if (data == nullptr) {
+        LOGE("SetTensorValue failed, please check whether it runs out of memory.");
+        return OH_NN_MEMORY_ERROR;
+    }
+
+    errno_t ret = memcpy_s(data, length, buffer, length);
+    if (ret != EOK) {
+        LOGE("SetTensorValue failed, please the information of error number %d from memcpy_s.", ret);
+        delete [] reinterpret_cast<char*>(data);
+        return OH_NN_FAILED;
+    }
+
+    m_allTensors[index]->SetBuffer(data, length);
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode InnerModel::CheckTensorValue(uint32_t index, size_t length) const
 {
     if (IsBuild()) {
-        LOGE("SetTensorValue failed, SetTensorValue is forbidden after model has been built.");
+        LOGE("CheckTensorValue failed, setting the value is forbidden after model has been built.");
         return OH_NN_OPERATION_FORBIDDEN;
     }
 
     if (index >= m_allTensors.size()) {
-        LOGE("SetTensorValue failed, passed index %u out of the number of added tensors.", index);
+        LOGE("CheckTensorValue failed, passed index %{public}u out of the number of added tensors.", index);
         return OH_NN_INVALID_PARAMETER;
     }
 
     const std::shared_ptr<NNTensor> tensor = m_allTensors[index];
     if (tensor->GetBuffer() != nullptr) {
-        LOGE("SetTensorValue failed, tensor has been set value twice. Tensor index: %u.", index);
+        LOGE("CheckTensorValue failed, tensor has been set value twice. Tensor index: %{public}u.", index);
         return OH_NN_INVALID_PARAMETER;
     }
 
-    if (buffer == nullptr) {
-        LOGW("SetTensorValue passed empty buffer, which makes no effect.");
-        return OH_NN_SUCCESS;
-    }
-
     if (tensor->IsDynamicShape()) {
-        LOGE("SetTensorValue failed, cannot set value to tensor with dynamic shape.");
+        LOGE("CheckTensorValue failed, cannot set value to tensor with dynamic shape.");
         return OH_NN_OPERATION_FORBIDDEN;
     }
 
     if (length != tensor->GetDataLength()) {
-        LOGE("SetTensorValue failed, get buffer length %zu different from the byte size of tensor %zu.",
-             length, tensor->GetDataLength());
+        LOGE("CheckTensorValue failed, get buffer length %{public}zu different from the byte size of tensor "
+             "%{public}zu.", length, tensor->GetDataLength());
         return OH_NN_INVALID_PARAMETER;
     }
+    return OH_NN_SUCCESS;
+}
 
-    // Data will be released inside NNTensor if it is set inside NNTensor using SetBuffer().
-    void* data = new (std::nothrow) char[length];
-    if (data == nullptr) {
-        LOGE("SetTensorValue failed, please check whether it runs out of memory.");
-        return OH_NN_MEMORY_ERROR;
+OH_NN_ReturnCode InnerModel::BorrowTensorValue(uint32_t index, const void* buffer, size_t length)
+{
+    if (buffer == nullptr) {
+        LOGE("BorrowTensorValue failed, passed nullptr to buffer.");
+        return OH_NN_INVALID_PARAMETER;
     }
 
-    errno_t ret = memcpy_s(data, length, buffer, length);
-    if (ret != EOK) {
-        LOGE("SetTensorValue failed, please the information of error number %d from memcpy_s.", ret);
-        delete [] reinterpret_cast<char*>(data);
+    OH_NN_ReturnCode ret = CheckTensorValue(index, length);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    // Without a releaser, the buffer is left to the caller when the tensor is destroyed.
+    m_allTensors[index]->SetBuffer(buffer, length, nullptr);
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode InnerModel::SetTensorValueFromFd(uint32_t index, int fd, size_t offset, size_t length)
+{
+    if (fd < 0) {
+        LOGE("SetTensorValueFromFd failed, fd %{public}d is invalid.", fd);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    OH_NN_ReturnCode ret = CheckTensorValue(index, length);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    // Reading beyond the end of a mapped file raises SIGBUS, the range is checked before it is mapped.
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0) {
+        LOGE("SetTensorValueFromFd failed, fstat fd %{public}d failed, errno %{public}d.", fd, errno);
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (S_ISREG(fileStat.st_mode) && (offset > static_cast<size_t>(fileStat.st_size) ||
+        length > static_cast<size_t>(fileStat.st_size) - offset)) {
+        LOGE("SetTensorValueFromFd failed, the range of %{public}zu bytes at %{public}zu exceeds the file size "
+             "%{public}lld.", length, offset, static_cast<long long>(fileStat.st_size));
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    long pageSize = sysconf(_SC_PAGESIZE);
+    if (pageSize <= 0) {
+        LOGE("SetTensorValueFromFd failed, get page size failed.");
         return OH_NN_FAILED;
     }
+    size_t pageOffset = offset % static_cast<size_t>(pageSize);
+    size_t mapLength = length + pageOffset;
+    void* mapped = MappingPolicy::Map(mapLength, PROT_READ, fd, static_cast<off_t>(offset - pageOffset));
+    if (mapped == MAP_FAILED) {
+        LOGE("SetTensorValueFromFd failed, map fd %{public}d failed, errno %{public}d.", fd, errno);
+        return OH_NN_MEMORY_ERROR;
+    }
 
-    tensor->SetBuffer(data, length);
+    m_allTensors[index]->SetBuffer(static_cast<uint8_t*>(mapped) + pageOffset, length,
+        [mapped, mapLength](void*, size_t) {
+            if (munmap(mapped, mapLength) != 0) {
+                LOGW("SetTensorValueFromFd unmap the tensor value failed.");
+            }
+        });
     return OH_NN_SUCCESS;
 }
 
@@ -552,6 +633,22 @@ OH_NN_ReturnCode InnerModel::SetInputsAndOutputsInfo(const OH_NN_TensorInfo* inp
     return OH_NN_SUCCESS;
 }
 
+OH_NN_ReturnCode InnerModel::SetGraphPasses(uint32_t passes)
+{
+    if (IsBuild()) {
+        LOGE("SetGraphPasses failed, the passes run when the model is built, it has been built before.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    if ((passes & ~static_cast<uint32_t>(OH_NN_GRAPH_PASS_ALL)) != 0) {
+        LOGE("SetGraphPasses failed, passes 0x%{public}x has an unknown bit.", passes);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    m_graphPasses = passes;
+    return OH_NN_SUCCESS;
+}
+
 OH_NN_ReturnCode InnerModel::Build()
 {
     NNRT_TRACE_NAME("Build model");
@@ -609,6 +706,100 @@ OH_NN_ReturnCode InnerModel::Build()
     }
     m_liteGraph->sub_graphs_.emplace_back(subGraph);
 
+    // The lite graph holds a copy of the tensor values, only the parameters are still read by the operations.
+    for (const auto& tensor : m_allTensors) {
+        if (!tensor->IsOpParameter()) {
+            tensor->ReleaseBuffer();
+        }
+    }
+    OptimizeGraph();
+    PlanMemory();
+
+    return OH_NN_SUCCESS;
+}
+
+void InnerModel::OptimizeGraph()
+{
+    NNRT_TRACE_NAME("Optimize graph");
+    m_graphPassSummary = GraphPassSummary();
+    m_graphPassSummary.originalNodeCount = static_cast<uint32_t>(m_liteGraph->all_nodes_.size());
+    m_graphPassSummary.nodeCount = m_graphPassSummary.originalNodeCount;
+    if (m_graphPasses == OH_NN_GRAPH_PASS_NONE) {
+        return;
+    }
+
+    LiteGraphRewriter rewriter;
+    if (rewriter.Init(m_liteGraph.get()) != OH_NN_SUCCESS) {
+        LOGW("Optimize the graph failed, it is built without the graph passes.");
+        return;
+    }
+
+    GraphEliminator eliminator;
+    bool isEliminating = (m_graphPasses & OH_NN_GRAPH_PASS_DEAD_CODE_ELIMINATION) != 0;
+    // The unused branches are pruned first, so that the other passes do not spend time on them.
+    if (isEliminating) {
+        eliminator.EliminateDeadNodes(rewriter, m_graphPassSummary);
+    }
+    // Merging before folding, the duplicated constant subgraphs would be folded into distinct tensors otherwise.
+    if ((m_graphPasses & OH_NN_GRAPH_PASS_COMMON_SUBEXPRESSION_ELIMINATION) != 0) {
+        eliminator.MergeCommonNodes(rewriter, m_graphPassSummary);
+    }
+    if ((m_graphPasses & OH_NN_GRAPH_PASS_CONSTANT_FOLDING) != 0) {
+        ConstantFolder().Fold(rewriter, m_graphPassSummary);
+    }
+    // Folding first, the parameters of a BatchNorm may be computed from constants.
+    if ((m_graphPasses & OH_NN_GRAPH_PASS_OPERATOR_FUSION) != 0) {
+        OperatorFuser().Fuse(rewriter, m_graphPassSummary);
+    }
+    // Again, a node may be left unused by folding the nodes which read its outputs.
+    if (isEliminating) {
+        eliminator.EliminateDeadNodes(rewriter, m_graphPassSummary);
+    }
+    rewriter.Commit(m_graphPassSummary);
+    m_nodeMap = rewriter.GetNodeMap();
+    LOGI("Graph passes reduce the nodes of the model from %{public}u to %{public}u, %{public}u of them are folded, "
+        "%{public}u are fused, %{public}u are eliminated, %{public}u are merged, %{public}u tensors of %{public}zu "
+        "bytes are removed, %{public}zu bytes of constants are added.", m_graphPassSummary.originalNodeCount,
+        m_graphPassSummary.nodeCount, m_graphPassSummary.foldedCount, m_graphPassSummary.fusedCount,
+        m_graphPassSummary.eliminatedCount, m_graphPassSummary.mergedCount, m_graphPassSummary.removedTensorCount,
+        m_graphPassSummary.removedBytes, m_graphPassSummary.foldedBytes);
+}
+
+OH_NN_ReturnCode InnerModel::GetGraphPassSummary(GraphPassSummary& summary) const
+{
+    if (!IsBuild()) {
+        LOGE("GetGraphPassSummary failed, the model has not been built.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    summary = m_graphPassSummary;
+    return OH_NN_SUCCESS;
+}
+
+void InnerModel::PlanMemory()
+{
+    // Only an estimate, a model whose intermediate tensors cannot be planned is still built.
+    MemoryPlanner planner;
+    m_isMemoryPlanned = (planner.Plan(m_liteGraph.get(), m_memoryPlan) == OH_NN_SUCCESS);
+    if (!m_isMemoryPlanned) {
+        LOGW("Plan the memory of the intermediate tensors failed.");
+        return;
+    }
+    LOGI("Intermediate tensors of the model take %{public}zu bytes in one arena instead of %{public}zu bytes, "
+        "%{public}u of them are not planned.", m_memoryPlan.arenaSize, m_memoryPlan.naiveSize,
+        m_memoryPlan.unplannedCount);
+}
+
+OH_NN_ReturnCode InnerModel::GetMemoryPlan(MemoryPlan& plan) const
+{
+    if (!IsBuild()) {
+        LOGE("GetMemoryPlan failed, the model has not been built.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    if (!m_isMemoryPlanned) {
+        LOGE("GetMemoryPlan failed, the memory of the model cannot be planned.");
+        return OH_NN_FAILED;
+    }
+    plan = m_memoryPlan;
     return OH_NN_SUCCESS;
 }
 
@@ -698,7 +889,16 @@ OH_NN_ReturnCode InnerModel::GetSupportedOperations(size_t deviceID, const bool*
     }
 
     m_supportedOperations.clear();
-    std::copy(supportedOperations.begin(), supportedOperations.end(), std::back_inserter(m_supportedOperations));
+    if (m_nodeMap.empty()) {
+        std::copy(supportedOperations.begin(), supportedOperations.end(), std::back_inserter(m_supportedOperations));
+    } else {
+        // An operation removed by the graph passes is computed on the host, by the node which replaces it, or its
+        // results are not needed.
+        for (uint32_t nodeIndex : m_nodeMap) {
+            m_supportedOperations.emplace_back(nodeIndex == LiteGraphRewriter::NO_NODE ||
+                (nodeIndex < supportedOperations.size() && supportedOperations[nodeIndex]));
+        }
+    }
 
     *isSupported = reinterpret_cast<bool*>(m_supportedOperations.data());
     opCount = m_supportedOperations.size();
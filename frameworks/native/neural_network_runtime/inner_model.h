@@ -19,6 +19,8 @@
 #include <memory>
 #include <unordered_map>
 
+#include "lite_graph_rewriter.h"
+#include "memory_planner.h"
 #include "mindir.h"
 #include "ops_builder.h"
 #include "tensor_desc.h"
@@ -40,6 +42,10 @@ public:
     OH_NN_ReturnCode SetTensorQuantParam(uint32_t index, const NN_QuantParam* quantParam);
     OH_NN_ReturnCode SetTensorType(uint32_t index, OH_NN_TensorType tensorType);
     OH_NN_ReturnCode SetTensorValue(uint32_t index, const void* buffer, size_t length);
+    // The buffer is used without a copy, the caller keeps it valid until the model is built or destroyed.
+    OH_NN_ReturnCode BorrowTensorValue(uint32_t index, const void* buffer, size_t length);
+    // The value is mapped read-only from the file, the pages are shared with the page cache instead of copied.
+    OH_NN_ReturnCode SetTensorValueFromFd(uint32_t index, int fd, size_t offset, size_t length);
     OH_NN_ReturnCode AddOperation(OH_NN_OperationType opType,
                                   const OH_NN_UInt32Array& paramIndices,
                                   const OH_NN_UInt32Array& inputIndices,
@@ -49,6 +55,8 @@ public:
         const OH_NN_UInt32Array& inputIndices, const OH_NN_UInt32Array& outputIndices);
     OH_NN_ReturnCode SetInputsAndOutputsInfo(const OH_NN_TensorInfo* inputsInfo, size_t inputSize,
         const OH_NN_TensorInfo* outputsInfo, size_t outputSize);
+    // Bitwise OR of OH_NN_GraphPass, the passes run by Build() and BuildFromLiteGraph(), all of them by default.
+    OH_NN_ReturnCode SetGraphPasses(uint32_t passes);
     OH_NN_ReturnCode Build();
     std::vector<std::shared_ptr<NNTensor>> GetInputTensors() const;
     std::vector<std::shared_ptr<NNTensor>> GetOutputTensors() const;
@@ -60,6 +68,9 @@ public:
     }
     void* GetMetaGraph() const;
     ExtensionConfig GetExtensionConfig() const;
+    // The plan of the intermediate tensors, made when the model is built from OH_NNModel or a lite graph.
+    OH_NN_ReturnCode GetMemoryPlan(MemoryPlan& plan) const;
+    OH_NN_ReturnCode GetGraphPassSummary(GraphPassSummary& summary) const;
 
 private:
     void AddTensorsToLiteGraph(std::unordered_map<uint32_t, uint32_t>& modelIDToGraphID);
@@ -68,6 +79,9 @@ private:
         const OH_NN_UInt32Array& inputIndices, const OH_NN_UInt32Array& outputIndices) const;
     OH_NN_ReturnCode ValidateTensorArray(const OH_NN_UInt32Array& indices) const;
     OH_NN_ReturnCode CheckParameters() const;
+    OH_NN_ReturnCode CheckTensorValue(uint32_t index, size_t length) const;
+    void OptimizeGraph();
+    void PlanMemory();
 
 private:
     std::vector<char> m_supportedOperations; // std::vector<bool> not support data(), use std::vector<char> instead.
@@ -80,6 +94,12 @@ private:
     std::shared_ptr<mindspore::lite::LiteGraph> m_liteGraph {nullptr};
     void* m_metaGraph {nullptr};
     ExtensionConfig m_extensionConfig;
+    MemoryPlan m_memoryPlan;
+    bool m_isMemoryPlanned {false};
+    uint32_t m_graphPasses {OH_NN_GRAPH_PASS_ALL};
+    GraphPassSummary m_graphPassSummary;
+    // Node of the optimized lite graph for each operation of the model, empty if the graph is not optimized.
+    std::vector<uint32_t> m_nodeMap;
 };
 }  // namespace NeuralNetworkRuntime
 }  // namespace OHOS
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "latency_histogram.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+constexpr uint64_t MAX_LATENCY = UINT32_MAX;
+constexpr uint64_t PERCENT_50 = 50;
+constexpr uint64_t PERCENT_90 = 90;
+constexpr uint64_t PERCENT_99 = 99;
+constexpr uint64_t PERCENT_100 = 100;
+constexpr int MSB_INDEX = 63;
+
+size_t LatencyHistogram::GetBucketIndex(uint64_t latency)
+{
+    if (latency < SUB_BUCKET_NUM) {
+        return static_cast<size_t>(latency);
+    }
+
+    // The highest bit selects the power of two, the following SUB_BUCKET_BITS bits select the bucket inside it.
+    size_t msb = static_cast<size_t>(MSB_INDEX - __builtin_clzll(latency));
+    size_t shift = msb - SUB_BUCKET_BITS;
+    return (msb - 1) * SUB_BUCKET_NUM + static_cast<size_t>((latency >> shift) & (SUB_BUCKET_NUM - 1));
+}
+
+uint64_t LatencyHistogram::GetBucketUpperBound(size_t index)
+{
+    if (index < SUB_BUCKET_NUM) {
+        return static_cast<uint64_t>(index);
+    }
+
+    size_t shift = index / SUB_BUCKET_NUM - 1;
+    uint64_t lowerBound = static_cast<uint64_t>(SUB_BUCKET_NUM + index % SUB_BUCKET_NUM) << shift;
+    return lowerBound + (static_cast<uint64_t>(1) << shift) - 1;
+}
+
+void LatencyHistogram::Record(int64_t latency)
+{
+    uint64_t value = std::min(static_cast<uint64_t>(std::max<int64_t>(latency, 0)), MAX_LATENCY);
+    m_buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t max = m_max.load(std::memory_order_relaxed);
+    while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+        // max has been reloaded by the failed exchange.
+    }
+}
+
+void LatencyHistogram::GetStatistics(OH_NN_LatencyStatistics& statistics) const
+{
+    // The buckets are read one by one while executions may go on, the count is taken from the same reads.
+    std::array<uint64_t, BUCKET_NUM> counts {};
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKET_NUM; ++i) {
+        counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    uint64_t max = m_max.load(std::memory_order_relaxed);
+
+    statistics = {total, 0, 0, 0, max};
+    if (total == 0) {
+        return;
+    }
+
+    statistics.p50 = std::min(GetPercentile(counts, total, PERCENT_50), max);
+    statistics.p90 = std::min(GetPercentile(counts, total, PERCENT_90), max);
+    statistics.p99 = std::min(GetPercentile(counts, total, PERCENT_99), max);
+}
+
+uint64_t LatencyHistogram::GetPercentile(const std::array<uint64_t, BUCKET_NUM>& counts, uint64_t total,
+    uint64_t percent)
+{
+    // The upper bound of the first bucket which reaches the rank ceil(total * percent / 100).
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < BUCKET_NUM; ++i) {
+        accumulated += counts[i];
+        if (accumulated * PERCENT_100 >= total * percent) {
+            return GetBucketUpperBound(i);
+        }
+    }
+    return GetBucketUpperBound(BUCKET_NUM - 1);
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_LATENCY_HISTOGRAM_H
+#define NEURAL_NETWORK_RUNTIME_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "neural_network_runtime_inner.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// Lock-free histogram of latencies in microseconds.
+// Every power of two is split into 4 buckets, so the percentiles are estimated with a relative error of at most 25%.
+class LatencyHistogram {
+public:
+    void Record(int64_t latency);
+    void GetStatistics(OH_NN_LatencyStatistics& statistics) const;
+
+    static int64_t Now()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+private:
+    static constexpr size_t SUB_BUCKET_BITS = 2;
+    static constexpr size_t SUB_BUCKET_NUM = 1 << SUB_BUCKET_BITS;
+    // Latencies are clamped to 32 bits, which is more than an hour.
+    static constexpr size_t BUCKET_NUM = 31 * SUB_BUCKET_NUM;
+
+    static size_t GetBucketIndex(uint64_t latency);
+    static uint64_t GetBucketUpperBound(size_t index);
+    static uint64_t GetPercentile(const std::array<uint64_t, BUCKET_NUM>& counts, uint64_t total, uint64_t percent);
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKET_NUM> m_buckets {};
+    std::atomic<uint64_t> m_max {0};
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_LATENCY_HISTOGRAM_H
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "lite_graph_conversion.h"
+
+#include "securec.h"
+#include "transform.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+bool LayoutTensorData(const mindspore::lite::LiteGraph* liteGraph, size_t bufferSize, std::vector<size_t>& offsets,
+    std::vector<size_t>& sizes)
+{
+    if (liteGraph == nullptr) {
+        return false;
+    }
+
+    size_t tensorNum = liteGraph->all_tensors_.size();
+    std::vector<bool> hasData(tensorNum, true);
+    for (uint32_t index : liteGraph->input_indices_) {
+        if (index < tensorNum) {
+            hasData[index] = false;
+        }
+    }
+    for (auto node : liteGraph->all_nodes_) {
+        if (node == nullptr) {
+            return false;
+        }
+        for (uint32_t index : node->output_indices_) {
+            if (index < tensorNum) {
+                hasData[index] = false;
+            }
+        }
+    }
+
+    offsets.assign(tensorNum, 0);
+    sizes.assign(tensorNum, 0);
+    size_t offset {0};
+    for (size_t i = 0; i < tensorNum; ++i) {
+        auto tensor = liteGraph->all_tensors_[i];
+        if (tensor == nullptr) {
+            return false;
+        }
+        offsets[i] = offset;
+        if (!hasData[i]) {
+            continue;
+        }
+        if (!GetTensorSize(tensor, sizes[i]) || sizes[i] > bufferSize - offset) {
+            return false;
+        }
+        offset += sizes[i];
+    }
+    return true;
+}
+
+bool CopyTensorData(const mindspore::lite::TensorPtr tensor, uint8_t* dst, size_t size)
+{
+    std::vector<uint8_t> data = mindspore::lite::MindIR_Tensor_GetData(tensor);
+    if (data.size() != size) {
+        return false;
+    }
+    if (size == 0) {
+        return true;
+    }
+    return memcpy_s(dst, size, data.data(), size) == EOK;
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
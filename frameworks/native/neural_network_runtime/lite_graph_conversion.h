@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_LITE_GRAPH_CONVERSION_H
+#define NEURAL_NETWORK_RUNTIME_LITE_GRAPH_CONVERSION_H
+
+#include <cstdint>
+#include <vector>
+
+#include "mindir.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// Below this size of the weights a graph is converted to an HDI model on the calling thread only.
+constexpr size_t PARALLEL_CONVERSION_MIN_SIZE = 16 * 1024 * 1024;
+// Graphs with fewer nodes have them converted on the calling thread only.
+constexpr size_t PARALLEL_CONVERSION_MIN_NODE_NUM = 512;
+// Number of nodes converted by one task of a parallel conversion.
+constexpr size_t PARALLEL_CONVERSION_NODE_NUM = 64;
+
+// Lays the data of the tensors out in the shared buffer the same way the sequential copy does, but from their
+// shapes, so that the data can be copied in any order. Only the tensors which are neither an input of the graph nor
+// an output of a node are expected to have data. Returns false if the layout cannot be known in advance.
+bool LayoutTensorData(const mindspore::lite::LiteGraph* liteGraph, size_t bufferSize, std::vector<size_t>& offsets,
+    std::vector<size_t>& sizes);
+// Copies the data of the tensor to dst, returns false unless the data has exactly the laid out size.
+bool CopyTensorData(const mindspore::lite::TensorPtr tensor, uint8_t* dst, size_t size);
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_LITE_GRAPH_CONVERSION_H
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "lite_graph_rewriter.h"
+
+#include <algorithm>
+
+#include "log.h"
+#include "transform.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+constexpr uint32_t NO_TENSOR = UINT32_MAX;
+
+bool CheckIndices(const std::vector<uint32_t>& indices, size_t count)
+{
+    for (uint32_t index : indices) {
+        if (index >= count) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Indices which are mapped to nothing are dropped.
+void RemapIndices(std::vector<uint32_t>& indices, const std::vector<uint32_t>& indexMap, uint32_t none)
+{
+    size_t count {0};
+    for (uint32_t index : indices) {
+        if (indexMap[index] != none) {
+            indices[count++] = indexMap[index];
+        }
+    }
+    indices.resize(count);
+}
+} // namespace
+
+OH_NN_ReturnCode LiteGraphRewriter::Init(mindspore::lite::LiteGraph* liteGraph)
+{
+    if (liteGraph == nullptr) {
+        LOGE("[LiteGraphRewriter] Init failed, lite graph is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    size_t tensorCount = liteGraph->all_tensors_.size();
+    size_t nodeCount = liteGraph->all_nodes_.size();
+    if (!CheckIndices(liteGraph->input_indices_, tensorCount) ||
+        !CheckIndices(liteGraph->output_indices_, tensorCount)) {
+        LOGE("[LiteGraphRewriter] Init failed, the graph has an invalid input or output.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    for (const auto* subGraph : liteGraph->sub_graphs_) {
+        if (subGraph == nullptr || !CheckIndices(subGraph->input_indices_, tensorCount) ||
+            !CheckIndices(subGraph->output_indices_, tensorCount) ||
+            !CheckIndices(subGraph->tensor_indices_, tensorCount) ||
+            !CheckIndices(subGraph->node_indices_, nodeCount)) {
+            LOGE("[LiteGraphRewriter] Init failed, the graph has an invalid subgraph.");
+            return OH_NN_INVALID_PARAMETER;
+        }
+    }
+
+    m_producers.assign(tensorCount, NO_NODE);
+    m_consumers.assign(tensorCount, {});
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        const auto* node = liteGraph->all_nodes_[i];
+        if (node == nullptr || !CheckIndices(node->input_indices_, tensorCount) ||
+            !CheckIndices(node->output_indices_, tensorCount)) {
+            LOGE("[LiteGraphRewriter] Init failed, node %{public}u is invalid.", i);
+            return OH_NN_INVALID_PARAMETER;
+        }
+        for (uint32_t index : node->output_indices_) {
+            m_producers[index] = i;
+        }
+        for (uint32_t index : node->input_indices_) {
+            m_consumers[index].emplace_back(i);
+        }
+    }
+
+    m_isGraphInput.assign(tensorCount, false);
+    for (uint32_t index : liteGraph->input_indices_) {
+        m_isGraphInput[index] = true;
+    }
+    m_isGraphOutput.assign(tensorCount, false);
+    for (uint32_t index : liteGraph->output_indices_) {
+        m_isGraphOutput[index] = true;
+    }
+    m_isRemoved.assign(nodeCount, false);
+    m_replacements.assign(nodeCount, NO_NODE);
+    m_nodeMap.clear();
+    m_liteGraph = liteGraph;
+    return OH_NN_SUCCESS;
+}
+
+bool LiteGraphRewriter::IsRemoved(uint32_t nodeIndex) const
+{
+    return nodeIndex < m_isRemoved.size() && m_isRemoved[nodeIndex];
+}
+
+bool LiteGraphRewriter::IsGraphInput(uint32_t tensorIndex) const
+{
+    return tensorIndex < m_isGraphInput.size() && m_isGraphInput[tensorIndex];
+}
+
+bool LiteGraphRewriter::IsGraphOutput(uint32_t tensorIndex) const
+{
+    return tensorIndex < m_isGraphOutput.size() && m_isGraphOutput[tensorIndex];
+}
+
+uint32_t LiteGraphRewriter::GetProducer(uint32_t tensorIndex) const
+{
+    return tensorIndex < m_producers.size() ? m_producers[tensorIndex] : NO_NODE;
+}
+
+const std::vector<uint32_t>& LiteGraphRewriter::GetConsumers(uint32_t tensorIndex) const
+{
+    static const std::vector<uint32_t> noConsumers;
+    return tensorIndex < m_consumers.size() ? m_consumers[tensorIndex] : noConsumers;
+}
+
+uint32_t LiteGraphRewriter::AddInput(uint32_t nodeIndex, mindspore::lite::TensorPtr tensor)
+{
+    uint32_t tensorIndex = static_cast<uint32_t>(m_liteGraph->all_tensors_.size());
+    m_liteGraph->all_tensors_.emplace_back(tensor);
+    m_producers.emplace_back(NO_NODE);
+    m_consumers.push_back({nodeIndex});
+    m_isGraphInput.emplace_back(false);
+    m_isGraphOutput.emplace_back(false);
+    m_liteGraph->all_nodes_[nodeIndex]->input_indices_.emplace_back(tensorIndex);
+    return tensorIndex;
+}
+
+void LiteGraphRewriter::RemoveNode(uint32_t nodeIndex, uint32_t replacement)
+{
+    if (nodeIndex >= m_isRemoved.size() || m_isRemoved[nodeIndex]) {
+        return;
+    }
+    m_isRemoved[nodeIndex] = true;
+    m_replacements[nodeIndex] = replacement;
+    const auto* node = m_liteGraph->all_nodes_[nodeIndex];
+    for (uint32_t index : node->output_indices_) {
+        if (m_producers[index] == nodeIndex) {
+            m_producers[index] = NO_NODE;
+        }
+    }
+    for (uint32_t index : node->input_indices_) {
+        auto& consumers = m_consumers[index];
+        consumers.erase(std::remove(consumers.begin(), consumers.end(), nodeIndex), consumers.end());
+    }
+}
+
+void LiteGraphRewriter::FuseNode(uint32_t nodeIndex, uint32_t fusedIndex)
+{
+    auto* node = m_liteGraph->all_nodes_[nodeIndex];
+    auto* fusedNode = m_liteGraph->all_nodes_[fusedIndex];
+    RemoveNode(fusedIndex, nodeIndex);
+    for (uint32_t index : node->output_indices_) {
+        m_producers[index] = NO_NODE;
+    }
+    node->output_indices_ = fusedNode->output_indices_;
+    for (uint32_t index : node->output_indices_) {
+        m_producers[index] = nodeIndex;
+    }
+}
+
+void LiteGraphRewriter::MergeNode(uint32_t nodeIndex, uint32_t mergedIndex)
+{
+    const auto* node = m_liteGraph->all_nodes_[nodeIndex];
+    const auto* mergedNode = m_liteGraph->all_nodes_[mergedIndex];
+    RemoveNode(mergedIndex, nodeIndex);
+    for (size_t i = 0; i < mergedNode->output_indices_.size(); ++i) {
+        uint32_t from = mergedNode->output_indices_[i];
+        uint32_t to = node->output_indices_[i];
+        for (uint32_t consumer : m_consumers[from]) {
+            auto& inputs = m_liteGraph->all_nodes_[consumer]->input_indices_;
+            std::replace(inputs.begin(), inputs.end(), from, to);
+        }
+        // A consumer which reads the tensor twice is listed twice, as many times as it reads it now.
+        m_consumers[to].insert(m_consumers[to].end(), m_consumers[from].begin(), m_consumers[from].end());
+        m_consumers[from].clear();
+    }
+}
+
+void LiteGraphRewriter::Commit(GraphPassSummary& summary)
+{
+    auto& nodes = m_liteGraph->all_nodes_;
+    uint32_t nodeCount = static_cast<uint32_t>(nodes.size());
+    std::vector<uint32_t> newNodeIndices(nodeCount, NO_NODE);
+    std::vector<mindspore::lite::LiteGraph::Node*> liveNodes;
+    liveNodes.reserve(nodeCount);
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        if (!m_isRemoved[i]) {
+            newNodeIndices[i] = static_cast<uint32_t>(liveNodes.size());
+            liveNodes.emplace_back(nodes[i]);
+            continue;
+        }
+        mindspore::lite::MindIR_Primitive_Destroy(&nodes[i]->primitive_);
+        delete nodes[i];
+    }
+    nodes.swap(liveNodes);
+
+    // A replacement may be removed later as well, the chain ends at a live node or at none.
+    m_nodeMap.assign(nodeCount, NO_NODE);
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        uint32_t nodeIndex = i;
+        for (uint32_t step = 0; nodeIndex != NO_NODE && m_isRemoved[nodeIndex] && step < nodeCount; ++step) {
+            nodeIndex = m_replacements[nodeIndex];
+        }
+        if (nodeIndex != NO_NODE && !m_isRemoved[nodeIndex]) {
+            m_nodeMap[i] = newNodeIndices[nodeIndex];
+        }
+    }
+    for (auto* subGraph : m_liteGraph->sub_graphs_) {
+        RemapIndices(subGraph->node_indices_, newNodeIndices, NO_NODE);
+    }
+
+    CompactTensors(summary);
+    summary.nodeCount = static_cast<uint32_t>(nodes.size());
+}
+
+void LiteGraphRewriter::CompactTensors(GraphPassSummary& summary)
+{
+    auto& tensors = m_liteGraph->all_tensors_;
+    size_t tensorCount = tensors.size();
+    std::vector<bool> isUsed(tensorCount, false);
+    auto markUsed = [&isUsed](const std::vector<uint32_t>& indices) {
+        for (uint32_t index : indices) {
+            isUsed[index] = true;
+        }
+    };
+    markUsed(m_liteGraph->input_indices_);
+    markUsed(m_liteGraph->output_indices_);
+    for (const auto* subGraph : m_liteGraph->sub_graphs_) {
+        markUsed(subGraph->input_indices_);
+        markUsed(subGraph->output_indices_);
+    }
+    for (const auto* node : m_liteGraph->all_nodes_) {
+        markUsed(node->input_indices_);
+        markUsed(node->output_indices_);
+    }
+
+    std::vector<uint32_t> newTensorIndices(tensorCount, NO_TENSOR);
+    std::vector<mindspore::lite::TensorPtr> liveTensors;
+    liveTensors.reserve(tensorCount);
+    for (size_t i = 0; i < tensorCount; ++i) {
+        if (isUsed[i]) {
+            newTensorIndices[i] = static_cast<uint32_t>(liveTensors.size());
+            liveTensors.emplace_back(tensors[i]);
+            continue;
+        }
+        size_t size {0};
+        if (GetTensorSize(tensors[i], size)) {
+            summary.removedBytes += size;
+        }
+        ++summary.removedTensorCount;
+        mindspore::lite::MindIR_Tensor_Destroy(&tensors[i]);
+    }
+    tensors.swap(liveTensors);
+    if (tensors.size() == tensorCount) {
+        return;
+    }
+
+    RemapIndices(m_liteGraph->input_indices_, newTensorIndices, NO_TENSOR);
+    RemapIndices(m_liteGraph->output_indices_, newTensorIndices, NO_TENSOR);
+    for (auto* subGraph : m_liteGraph->sub_graphs_) {
+        RemapIndices(subGraph->input_indices_, newTensorIndices, NO_TENSOR);
+        RemapIndices(subGraph->output_indices_, newTensorIndices, NO_TENSOR);
+        RemapIndices(subGraph->tensor_indices_, newTensorIndices, NO_TENSOR);
+    }
+    for (auto* node : m_liteGraph->all_nodes_) {
+        RemapIndices(node->input_indices_, newTensorIndices, NO_TENSOR);
+        RemapIndices(node->output_indices_, newTensorIndices, NO_TENSOR);
+    }
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_LITE_GRAPH_REWRITER_H
+#define NEURAL_NETWORK_RUNTIME_LITE_GRAPH_REWRITER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "mindir.h"
+#include "neural_network_runtime/neural_network_runtime_type.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+struct GraphPassSummary {
+    // Nodes of the graph before and after the passes.
+    uint32_t originalNodeCount {0};
+    uint32_t nodeCount {0};
+    // Nodes evaluated on the host by constant folding.
+    uint32_t foldedCount {0};
+    // Nodes absorbed into the node which produces their input by operator fusion.
+    uint32_t fusedCount {0};
+    // Nodes which no output of the graph needs, and nodes merged into an identical node by their elimination.
+    uint32_t eliminatedCount {0};
+    uint32_t mergedCount {0};
+    // Tensors dropped with the removed nodes, and their bytes if their shapes are known.
+    uint32_t removedTensorCount {0};
+    size_t removedBytes {0};
+    // Bytes of the constant tensors which hold the results of the folded nodes read by the remaining ones.
+    size_t foldedBytes {0};
+};
+
+// Rewrites a lite graph in place for the graph passes of a model. The passes mark the nodes to remove while they
+// change the others, Commit() then deletes the marked nodes with the tensors which are used no more, and compacts
+// the indices of the graph.
+class LiteGraphRewriter {
+public:
+    static constexpr uint32_t NO_NODE = UINT32_MAX;
+
+    // Fails if the graph has an invalid index, it is not changed then.
+    OH_NN_ReturnCode Init(mindspore::lite::LiteGraph* liteGraph);
+
+    mindspore::lite::LiteGraph* GetLiteGraph() const
+    {
+        return m_liteGraph;
+    }
+    bool IsRemoved(uint32_t nodeIndex) const;
+    bool IsGraphInput(uint32_t tensorIndex) const;
+    bool IsGraphOutput(uint32_t tensorIndex) const;
+    // The live node which produces the tensor, NO_NODE for the inputs and the constants of the graph.
+    uint32_t GetProducer(uint32_t tensorIndex) const;
+    // The live nodes which read the tensor, a node which reads it twice is listed twice.
+    const std::vector<uint32_t>& GetConsumers(uint32_t tensorIndex) const;
+    // Appends a new tensor to the graph as the last input of the node, the graph takes the ownership of it.
+    uint32_t AddInput(uint32_t nodeIndex, mindspore::lite::TensorPtr tensor);
+    // The results of the node are computed by replacement afterwards, by no node of the graph if it is NO_NODE.
+    void RemoveNode(uint32_t nodeIndex, uint32_t replacement = NO_NODE);
+    // The node writes the outputs of the fused node, which reads the output of the node, and the fused node is
+    // removed. The caller has changed the node to compute the results of both of them.
+    void FuseNode(uint32_t nodeIndex, uint32_t fusedIndex);
+    // The merged node computes the same results as the node, its consumers read the outputs of the node instead and
+    // it is removed. Both of them have as many outputs, none of which is an output of the graph.
+    void MergeNode(uint32_t nodeIndex, uint32_t mergedIndex);
+    void Commit(GraphPassSummary& summary);
+    // Valid after Commit(): the node which computes each node of the original graph, NO_NODE if none does.
+    const std::vector<uint32_t>& GetNodeMap() const
+    {
+        return m_nodeMap;
+    }
+
+private:
+    void CompactTensors(GraphPassSummary& summary);
+
+private:
+    mindspore::lite::LiteGraph* m_liteGraph {nullptr};
+    std::vector<uint32_t> m_producers;
+    std::vector<std::vector<uint32_t>> m_consumers;
+    std::vector<bool> m_isGraphInput;
+    std::vector<bool> m_isGraphOutput;
+    std::vector<bool> m_isRemoved;
+    std::vector<uint32_t> m_replacements;
+    std::vector<uint32_t> m_nodeMap;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_LITE_GRAPH_REWRITER_H
@@ -16,8 +16,12 @@
 #include "lite_graph_to_hdi_model_v2_0.h"
 #include <vector>
 #include <algorithm>
+#include <atomic>
 #include <sys/mman.h>
+#include "async_run_pool.h"
+#include "lite_graph_conversion.h"
 #include "log.h"
+#include "mapping_policy.h"
 #include "message_parcel.h"
 #include "nnrt/v2_0/nnrt_types.h"
 #include "nnrt/v2_0/node_attr_types.h"
@@ -930,8 +934,9 @@ std::unordered_map<NodeType, std::vector<int8_t>(*)(PrimitivePtr)> convertOpMap
 
 std::vector<int8_t> Convert(NodeType type, PrimitivePtr primitive)
 {
-    if (convertOpMap.find(type) != convertOpMap.end()) {
-        return convertOpMap[type](primitive);
+    auto iter = convertOpMap.find(type);
+    if (iter != convertOpMap.end()) {
+        return iter->second(primitive);
     }
     LOGE("MindIR_LiteGraph_To_Model v2_0 failed, nodeType invalid, type =%d", type);
     return {};
@@ -998,6 +1003,111 @@ OHOS::HDI::Nnrt::V2_0::SharedBuffer Copy_MindIR_Tensor_Data_To_HDIBuffer(const T
     return result;
 }
 
+namespace {
+bool ConvertLiteGraphNode(const mindspore::lite::LiteGraph::Node *node, OHOS::HDI::Nnrt::V2_0::Node &result)
+{
+    if (node == nullptr) {
+        LOGE("MindIR_LiteGraph_To_Model v2 failed, node is nullptr.");
+        return false;
+    }
+    result.name = node->name_;
+    if (node->primitive_ == nullptr) {
+        LOGE("MindIR_LiteGraph_To_Model v2 failed, node primitive is nullptr.");
+        return false;
+    }
+    result.nodeType = static_cast<NodeType>(mindspore::lite::MindIR_Primitive_GetType(node->primitive_));
+    result.nodeAttr = Convert(result.nodeType, node->primitive_);
+    result.inputIndex = node->input_indices_;
+    result.outputIndex = node->output_indices_;
+    result.quantType = static_cast<QuantType>(node->quant_type_);
+    return true;
+}
+
+bool ConvertLiteGraphNodes(const mindspore::lite::LiteGraph *liteGraph,
+    std::vector<OHOS::HDI::Nnrt::V2_0::Node> &nodes)
+{
+    size_t nodeNum = liteGraph->all_nodes_.size();
+    nodes.resize(nodeNum);
+    if (nodeNum < PARALLEL_CONVERSION_MIN_NODE_NUM) {
+        for (size_t i = 0; i < nodeNum; ++i) {
+            if (!ConvertLiteGraphNode(liteGraph->all_nodes_[i], nodes[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // The nodes are independent, each task converts a range of them.
+    std::atomic<bool> isConverted {true};
+    size_t taskNum = (nodeNum + PARALLEL_CONVERSION_NODE_NUM - 1) / PARALLEL_CONVERSION_NODE_NUM;
+    AsyncRunPool::GetInstance()->ParallelFor(taskNum, [liteGraph, nodeNum, &nodes, &isConverted](size_t task) {
+        size_t end = std::min(nodeNum, (task + 1) * PARALLEL_CONVERSION_NODE_NUM);
+        for (size_t i = task * PARALLEL_CONVERSION_NODE_NUM; i < end && isConverted; ++i) {
+            if (!ConvertLiteGraphNode(liteGraph->all_nodes_[i], nodes[i])) {
+                isConverted = false;
+            }
+        }
+    });
+    return isConverted;
+}
+
+OHOS::HDI::Nnrt::V2_0::Tensor ConvertLiteGraphTensor(const TensorPtr tensor)
+{
+    OHOS::HDI::Nnrt::V2_0::Tensor tmp;
+    tmp.name = mindspore::lite::MindIR_Tensor_GetName(tensor);
+    tmp.dataType = static_cast<DataType>(mindspore::lite::MindIR_Tensor_GetDataType(tensor));
+    tmp.dims = mindspore::lite::MindIR_Tensor_GetDims(tensor);
+    tmp.format = static_cast<Format>(mindspore::lite::MindIR_Tensor_GetFormat(tensor));
+    tmp.quantParams = MindIR_Tensor_GetQuantParams_OHOS(tensor);
+    return tmp;
+}
+
+void ConvertLiteGraphTensors(const mindspore::lite::LiteGraph *liteGraph,
+    const OHOS::HDI::Nnrt::V2_0::SharedBuffer &buffer, uint8_t *mmapPtr,
+    std::vector<OHOS::HDI::Nnrt::V2_0::Tensor> &allTensors)
+{
+    allTensors.reserve(liteGraph->all_tensors_.size());
+    unsigned int tensorBufferOffset = 0;
+    for (auto tensor : liteGraph->all_tensors_) {
+        OHOS::HDI::Nnrt::V2_0::Tensor tmp = ConvertLiteGraphTensor(tensor);
+        tmp.data = Copy_MindIR_Tensor_Data_To_HDIBuffer(tensor, buffer, mmapPtr, tensorBufferOffset);
+        tensorBufferOffset = tmp.data.offset + tmp.data.dataSize;
+        allTensors.emplace_back(std::move(tmp));
+    }
+}
+
+// Returns false without converting any tensor if the data does not match the layout from the shapes.
+bool ConvertLiteGraphTensorsParallel(const mindspore::lite::LiteGraph *liteGraph,
+    const OHOS::HDI::Nnrt::V2_0::SharedBuffer &buffer, uint8_t *mmapPtr,
+    std::vector<OHOS::HDI::Nnrt::V2_0::Tensor> &allTensors)
+{
+    std::vector<size_t> offsets;
+    std::vector<size_t> sizes;
+    if (!LayoutTensorData(liteGraph, buffer.bufferSize, offsets, sizes)) {
+        return false;
+    }
+
+    allTensors.resize(liteGraph->all_tensors_.size());
+    std::atomic<bool> isLaidOut {true};
+    AsyncRunPool::GetInstance()->ParallelFor(allTensors.size(), [&](size_t i) {
+        auto tensor = liteGraph->all_tensors_[i];
+        if (!isLaidOut || !CopyTensorData(tensor, mmapPtr + offsets[i], sizes[i])) {
+            isLaidOut = false;
+            return;
+        }
+        allTensors[i] = ConvertLiteGraphTensor(tensor);
+        allTensors[i].data = {(sizes[i] != 0) ? buffer.fd : -1, buffer.bufferSize,
+            static_cast<uint32_t>(offsets[i]), static_cast<uint32_t>(sizes[i])};
+    });
+    if (!isLaidOut) {
+        LOGW("MindIR_LiteGraph_To_Model v2, tensor data differs from the shapes, it is copied sequentially.");
+        allTensors.clear();
+        return false;
+    }
+    return true;
+}
+} // namespace
+
 OHOS::HDI::Nnrt::V2_0::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteGraph *liteGraph,
     const OHOS::HDI::Nnrt::V2_0::SharedBuffer &buffer)
 {
@@ -1011,46 +1121,24 @@ OHOS::HDI::Nnrt::V2_0::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteG
     std::vector<OHOS::HDI::Nnrt::V2_0::SubGraph> subGraph;
 
     // nodes
-    for (auto node : liteGraph->all_nodes_) {
-        if (node == nullptr) {
-            LOGE("MindIR_LiteGraph_To_Model v2 failed, node is nullptr.");
-            return nullptr;
-        }
-        OHOS::HDI::Nnrt::V2_0::Node tmp;
-        tmp.name = node->name_;
-        if (node->primitive_ == nullptr) {
-            LOGE("MindIR_LiteGraph_To_Model v2 failed, node primitive is nullptr.");
-            return nullptr;
-        }
-        tmp.nodeType = static_cast<NodeType>(mindspore::lite::MindIR_Primitive_GetType(node->primitive_));
-        tmp.nodeAttr = Convert(tmp.nodeType, node->primitive_);
-        tmp.inputIndex = node->input_indices_;
-        tmp.outputIndex = node->output_indices_;
-        tmp.quantType = static_cast<QuantType>(node->quant_type_);
-        nodes.emplace_back(tmp);
+    if (!ConvertLiteGraphNodes(liteGraph, nodes)) {
+        return nullptr;
     }
 
     // Tensor
-    unsigned int tensorBufferOffset = 0;
     uint8_t *mmapPtr = nullptr;
     if (buffer.fd != -1) {
         mmapPtr =
-          static_cast<uint8_t *>(mmap(nullptr, buffer.bufferSize, PROT_READ | PROT_WRITE, MAP_SHARED, buffer.fd, 0));
+          static_cast<uint8_t *>(MappingPolicy::Map(buffer.bufferSize, PROT_READ | PROT_WRITE, buffer.fd, 0));
         if (mmapPtr == MAP_FAILED) {
             LOGE("MindIR_LiteGraph_To_Model v2 failed, mmap failed.");
             return nullptr;
         }
     }
-    for (auto tensor : liteGraph->all_tensors_) {
-        OHOS::HDI::Nnrt::V2_0::Tensor tmp;
-        tmp.name = mindspore::lite::MindIR_Tensor_GetName(tensor);
-        tmp.dataType = static_cast<DataType>(mindspore::lite::MindIR_Tensor_GetDataType(tensor));
-        tmp.dims = mindspore::lite::MindIR_Tensor_GetDims(tensor);
-        tmp.format = static_cast<Format>(mindspore::lite::MindIR_Tensor_GetFormat(tensor));
-        tmp.data = Copy_MindIR_Tensor_Data_To_HDIBuffer(tensor, buffer, mmapPtr, tensorBufferOffset);
-        tmp.quantParams = MindIR_Tensor_GetQuantParams_OHOS(tensor);
-        allTensors.emplace_back(tmp);
-        tensorBufferOffset = tmp.data.offset + tmp.data.dataSize;
+    // Large weights are copied in parallel, to offsets laid out from the shapes of the tensors beforehand.
+    bool isParallel = (mmapPtr != nullptr && buffer.bufferSize >= PARALLEL_CONVERSION_MIN_SIZE);
+    if (!isParallel || !ConvertLiteGraphTensorsParallel(liteGraph, buffer, mmapPtr, allTensors)) {
+        ConvertLiteGraphTensors(liteGraph, buffer, mmapPtr, allTensors);
     }
     if (buffer.fd != -1) {
         auto munmapRes = munmap(mmapPtr, buffer.bufferSize);
@@ -1061,13 +1149,14 @@ OHOS::HDI::Nnrt::V2_0::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteG
     }
 
     // SubGraph
+    subGraph.reserve(liteGraph->sub_graphs_.size());
     for (auto graph : liteGraph->sub_graphs_) {
         OHOS::HDI::Nnrt::V2_0::SubGraph tmp;
         tmp.name = graph->name_;
-        tmp.inputIndices = std::vector<uint32_t>(graph->input_indices_);
-        tmp.outputIndices = std::vector<uint32_t>(graph->output_indices_);
-        tmp.nodeIndices = std::vector<uint32_t>(graph->node_indices_);
-        subGraph.emplace_back(tmp);
+        tmp.inputIndices = graph->input_indices_;
+        tmp.outputIndices = graph->output_indices_;
+        tmp.nodeIndices = graph->node_indices_;
+        subGraph.emplace_back(std::move(tmp));
     }
 
     auto *retModel = new (std::nothrow) Model();
@@ -1078,9 +1167,9 @@ OHOS::HDI::Nnrt::V2_0::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteG
     retModel->name = liteGraph->name_;
     retModel->inputIndex = liteGraph->input_indices_;
     retModel->outputIndex = liteGraph->output_indices_;
-    retModel->nodes = nodes;
-    retModel->allTensors = allTensors;
-    retModel->subGraph = subGraph;
+    retModel->nodes = std::move(nodes);
+    retModel->allTensors = std::move(allTensors);
+    retModel->subGraph = std::move(subGraph);
     return retModel;
 }
 
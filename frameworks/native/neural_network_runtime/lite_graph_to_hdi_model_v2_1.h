@@ -16,6 +16,8 @@
 #ifndef NEURAL_NETWORK_RUNTIME_LITEGRAPH_TO_HDIMODEL_V2_1_H
 #define NEURAL_NETWORK_RUNTIME_LITEGRAPH_TO_HDIMODEL_V2_1_H
 
+#include <vector>
+
 #include "mindir.h"
 #include "nnrt/v2_1/model_types.h"
 
@@ -25,6 +27,11 @@ namespace NNRt_V2_1 {
 void HDIModel_Destroy(OHOS::HDI::Nnrt::V2_1::Model **model);
 OHOS::HDI::Nnrt::V2_1::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteGraph *liteGraph,
     const OHOS::HDI::Nnrt::V2_1::SharedBuffer &buffer);
+// The data of the tensors has been copied to buffer already, dataSizes holds the data size of each tensor.
+OHOS::HDI::Nnrt::V2_1::Model *LiteGraph_To_HDIModel(const mindspore::lite::LiteGraph *liteGraph,
+    const OHOS::HDI::Nnrt::V2_1::SharedBuffer &buffer, const std::vector<size_t> &dataSizes);
+// Attributes of the primitive as they are sent to the device, fails if the type of the primitive is unknown.
+bool SerializeAttributes(const mindspore::lite::PrimitivePtr primitive, std::vector<int8_t> &attributes);
 } // NNRt_V2_1
 } // NeuralNetworkRuntime
 } // OHOS
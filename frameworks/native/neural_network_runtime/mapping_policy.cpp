@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mapping_policy.h"
+
+#include <sys/mman.h>
+
+#include "log.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+constexpr uint32_t MAPPING_FLAG_MASK = OH_NN_MAPPING_PREFAULT | OH_NN_MAPPING_HUGE_PAGE;
+} // namespace
+
+std::atomic<uint32_t> MappingPolicy::s_flags {OH_NN_MAPPING_DEFAULT};
+std::atomic<size_t> MappingPolicy::s_threshold {0};
+
+OH_NN_ReturnCode MappingPolicy::Set(uint32_t flags, size_t threshold)
+{
+    if ((flags & ~MAPPING_FLAG_MASK) != 0) {
+        LOGE("[MappingPolicy] Set failed, unknown flags 0x%{public}x.", flags);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    // Read without ordering by the mappings, a mapping racing with the change may use either policy.
+    s_threshold.store(threshold, std::memory_order_relaxed);
+    s_flags.store(flags, std::memory_order_relaxed);
+    return OH_NN_SUCCESS;
+}
+
+void MappingPolicy::Get(uint32_t& flags, size_t& threshold)
+{
+    flags = s_flags.load(std::memory_order_relaxed);
+    threshold = s_threshold.load(std::memory_order_relaxed);
+}
+
+void* MappingPolicy::Map(size_t length, int prot, int fd, off_t offset)
+{
+    uint32_t flags {OH_NN_MAPPING_DEFAULT};
+    size_t threshold {0};
+    Get(flags, threshold);
+    if (flags == OH_NN_MAPPING_DEFAULT || length < threshold) {
+        return mmap(nullptr, length, prot, MAP_SHARED, fd, offset);
+    }
+
+    bool isPrefault = (flags & OH_NN_MAPPING_PREFAULT) != 0;
+    bool isHugePage = (flags & OH_NN_MAPPING_HUGE_PAGE) != 0;
+    // The pages populated by mmap are faulted in before any advice, so they could never be huge pages.
+    int mapFlags = (isPrefault && !isHugePage) ? (MAP_SHARED | MAP_POPULATE) : MAP_SHARED;
+    void* addr = mmap(nullptr, length, prot, mapFlags, fd, offset);
+    if (addr == MAP_FAILED) {
+        return addr;
+    }
+
+    if (isHugePage && madvise(addr, length, MADV_HUGEPAGE) != 0) {
+        LOGD("[MappingPolicy] Advise huge pages for %{public}zu bytes failed.", length);
+    }
+    if (!isPrefault) {
+        return addr;
+    }
+#ifdef MADV_POPULATE_WRITE
+    if (isHugePage) {
+        int advice = ((static_cast<unsigned int>(prot) & PROT_WRITE) != 0) ? MADV_POPULATE_WRITE : MADV_POPULATE_READ;
+        if (madvise(addr, length, advice) != 0) {
+            LOGD("[MappingPolicy] Populate %{public}zu bytes failed.", length);
+        }
+    }
+#endif
+    if (madvise(addr, length, MADV_WILLNEED) != 0) {
+        LOGD("[MappingPolicy] Advise the pages of %{public}zu bytes to be read ahead failed.", length);
+    }
+    return addr;
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_MAPPING_POLICY_H
+#define NEURAL_NETWORK_RUNTIME_MAPPING_POLICY_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <sys/types.h>
+
+#include "neural_network_runtime_inner.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// Process-wide policy of mapping the shared buffers of tensors, weights and model caches.
+// The buffers of at least the threshold are prefaulted and advised to use huge pages, as configured by the flags.
+class MappingPolicy {
+public:
+    static OH_NN_ReturnCode Set(uint32_t flags, size_t threshold);
+    static void Get(uint32_t& flags, size_t& threshold);
+
+    // Maps a shared buffer the way mmap with MAP_SHARED does, and returns MAP_FAILED if it fails.
+    // A failed advice does not fail the mapping, it only costs the page faults the policy is meant to save.
+    static void* Map(size_t length, int prot, int fd, off_t offset);
+
+private:
+    static std::atomic<uint32_t> s_flags;
+    static std::atomic<size_t> s_threshold;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_MAPPING_POLICY_H
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "memory_account.h"
+
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <unordered_set>
+
+#include "log.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+const char* const CATEGORY_NAMES[] = {"weights", "ioTensors", "cacheMappings", "staging"};
+
+struct AccountRegistry {
+    std::mutex mtx;
+    std::unordered_set<const MemoryAccount*> accounts;
+};
+
+AccountRegistry& GetRegistry()
+{
+    // Never destroyed, accounts of static objects may still be removed at exit.
+    static AccountRegistry* registry = new AccountRegistry();
+    return *registry;
+}
+
+void FillUsage(OH_NN_MemoryUsage& usage, const std::atomic<size_t>& liveBytes, const std::atomic<size_t>& peakBytes)
+{
+    usage.liveBytes = liveBytes.load(std::memory_order_relaxed);
+    usage.peakBytes = peakBytes.load(std::memory_order_relaxed);
+}
+
+
+std::string MakeName(const char* kind, const void* owner)
+{
+    std::ostringstream oss;
+    oss << kind << "@" << owner;
+    return oss.str();
+}
+} // namespace
+
+MemoryAccount::MemoryAccount(const char* kind, const void* owner)
+    : m_name(MakeName(kind, owner)), m_parent(&GetProcessAccount())
+{
+    AccountRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mtx);
+    registry.accounts.insert(this);
+}
+
+MemoryAccount::MemoryAccount(const std::string& name) : m_name(name) {}
+
+MemoryAccount::~MemoryAccount()
+{
+    if (m_parent == nullptr) {
+        return;
+    }
+
+    {
+        AccountRegistry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mtx);
+        registry.accounts.erase(this);
+    }
+
+    // The shared memory left is released, so that only the memory the owner holds alone is removed from the process.
+    std::unordered_map<const void*, SharedMemory> sharedMemories;
+    {
+        std::lock_guard<std::mutex> lock(m_sharedMutex);
+        sharedMemories.swap(m_sharedMemories);
+    }
+    std::array<size_t, CATEGORY_NUM> sharedBytes {};
+    for (const auto& [key, sharedMemory] : sharedMemories) {
+        sharedBytes[static_cast<size_t>(sharedMemory.category)] += sharedMemory.bytes;
+        m_parent->ReleaseShared(key);
+    }
+
+    for (size_t i = 0; i < CATEGORY_NUM; ++i) {
+        size_t liveBytes = m_liveBytes[i].load(std::memory_order_relaxed);
+        if (liveBytes != 0) {
+            LOGW("[MemoryAccount] %{public}s is destroyed with %{public}zu bytes of %{public}s.",
+                m_name.c_str(), liveBytes, CATEGORY_NAMES[i]);
+        }
+        if (liveBytes > sharedBytes[i]) {
+            m_parent->Sub(static_cast<MemoryCategory>(i), liveBytes - sharedBytes[i]);
+        }
+    }
+}
+
+void MemoryAccount::AddLiveBytes(MemoryCategory category, size_t bytes)
+{
+    size_t index = static_cast<size_t>(category);
+    size_t liveBytes = m_liveBytes[index].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    size_t peakBytes = m_peakBytes[index].load(std::memory_order_relaxed);
+    while (liveBytes > peakBytes &&
+        !m_peakBytes[index].compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed)) {}
+}
+
+void MemoryAccount::Add(MemoryCategory category, size_t bytes)
+{
+    AddLiveBytes(category, bytes);
+    if (m_parent != nullptr) {
+        m_parent->Add(category, bytes);
+    }
+}
+
+void MemoryAccount::Sub(MemoryCategory category, size_t bytes)
+{
+    m_liveBytes[static_cast<size_t>(category)].fetch_sub(bytes, std::memory_order_relaxed);
+    if (m_parent != nullptr) {
+        m_parent->Sub(category, bytes);
+    }
+}
+
+void MemoryAccount::AddShared(MemoryCategory category, const void* key, size_t bytes)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sharedMutex);
+        if (!m_sharedMemories.emplace(key, SharedMemory {category, bytes, 1}).second) {
+            LOGW("[MemoryAccount] %{public}s already holds the shared memory, it is counted once.", m_name.c_str());
+            return;
+        }
+    }
+
+    AddLiveBytes(category, bytes);
+    if (m_parent != nullptr) {
+        m_parent->AcquireShared(category, key, bytes);
+    }
+}
+
+void MemoryAccount::SubShared(const void* key)
+{
+    SharedMemory sharedMemory;
+    {
+        std::lock_guard<std::mutex> lock(m_sharedMutex);
+        auto iter = m_sharedMemories.find(key);
+        if (iter == m_sharedMemories.end()) {
+            return;
+        }
+        sharedMemory = iter->second;
+        m_sharedMemories.erase(iter);
+    }
+
+    m_liveBytes[static_cast<size_t>(sharedMemory.category)].fetch_sub(sharedMemory.bytes, std::memory_order_relaxed);
+    if (m_parent != nullptr) {
+        m_parent->ReleaseShared(key);
+    }
+}
+
+void MemoryAccount::AcquireShared(MemoryCategory category, const void* key, size_t bytes)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sharedMutex);
+        SharedMemory& sharedMemory = m_sharedMemories[key];
+        if (sharedMemory.ownerNum++ != 0) {
+            return;
+        }
+        sharedMemory.category = category;
+        sharedMemory.bytes = bytes;
+    }
+    Add(category, bytes);
+}
+
+void MemoryAccount::ReleaseShared(const void* key)
+{
+    SharedMemory sharedMemory;
+    {
+        std::lock_guard<std::mutex> lock(m_sharedMutex);
+        auto iter = m_sharedMemories.find(key);
+        if (iter == m_sharedMemories.end() || --iter->second.ownerNum != 0) {
+            return;
+        }
+        sharedMemory = iter->second;
+        m_sharedMemories.erase(iter);
+    }
+    Sub(sharedMemory.category, sharedMemory.bytes);
+}
+
+size_t MemoryAccount::GetLiveBytes(MemoryCategory category) const
+{
+    return m_liveBytes[static_cast<size_t>(category)].load(std::memory_order_relaxed);
+}
+
+void MemoryAccount::GetStatistics(OH_NN_MemoryStatistics& statistics) const
+{
+    FillUsage(statistics.weights, m_liveBytes[static_cast<size_t>(MemoryCategory::WEIGHTS)],
+        m_peakBytes[static_cast<size_t>(MemoryCategory::WEIGHTS)]);
+    FillUsage(statistics.ioTensors, m_liveBytes[static_cast<size_t>(MemoryCategory::IO_TENSORS)],
+        m_peakBytes[static_cast<size_t>(MemoryCategory::IO_TENSORS)]);
+    FillUsage(statistics.cacheMappings, m_liveBytes[static_cast<size_t>(MemoryCategory::CACHE_MAPPINGS)],
+        m_peakBytes[static_cast<size_t>(MemoryCategory::CACHE_MAPPINGS)]);
+    FillUsage(statistics.staging, m_liveBytes[static_cast<size_t>(MemoryCategory::STAGING)],
+        m_peakBytes[static_cast<size_t>(MemoryCategory::STAGING)]);
+}
+
+std::string MemoryAccount::ToString() const
+{
+    std::ostringstream oss;
+    oss << m_name;
+    for (size_t i = 0; i < CATEGORY_NUM; ++i) {
+        oss << " " << CATEGORY_NAMES[i] << "=" << m_liveBytes[i].load(std::memory_order_relaxed) << "/" <<
+            m_peakBytes[i].load(std::memory_order_relaxed);
+    }
+    return oss.str();
+}
+
+MemoryAccount& MemoryAccount::GetProcessAccount()
+{
+    // Never destroyed, tensors of static objects may still be released at exit.
+    static MemoryAccount* account = new MemoryAccount("process");
+    return *account;
+}
+
+OH_NN_ReturnCode MemoryAccount::Dump(const std::string& path)
+{
+    std::ofstream dumpStream(path, std::ios::out | std::ios::trunc);
+    if (!dumpStream.is_open()) {
+        LOGE("[MemoryAccount] Dump failed, fail to open the file.");
+        return OH_NN_INVALID_FILE;
+    }
+
+    dumpStream << GetProcessAccount().ToString() << "\n";
+    {
+        // Accounts unregister under the same lock before being destroyed.
+        AccountRegistry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mtx);
+        for (const MemoryAccount* account : registry.accounts) {
+            dumpStream << account->ToString() << "\n";
+        }
+    }
+
+    dumpStream.close();
+    if (dumpStream.fail()) {
+        LOGE("[MemoryAccount] Dump failed, fail to write the file.");
+        return OH_NN_INVALID_FILE;
+    }
+    return OH_NN_SUCCESS;
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_MEMORY_ACCOUNT_H
+#define NEURAL_NETWORK_RUNTIME_MEMORY_ACCOUNT_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "neural_network_runtime_inner.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+enum class MemoryCategory : size_t {
+    WEIGHTS = 0,
+    IO_TENSORS,
+    CACHE_MAPPINGS,
+    STAGING,
+    CATEGORY_NUM
+};
+
+// Live and peak bytes by category of the memory held by one compilation or executor.
+// Every change is also counted by the account of the process, which additionally holds the memory without an owner.
+// The counters are lock free, the accounts are only registered under a lock to be dumped.
+class MemoryAccount {
+public:
+    // Named after the kind and the address of the owner, which identify it in the dump.
+    MemoryAccount(const char* kind, const void* owner);
+    // The live bytes left are removed from the account of the process.
+    ~MemoryAccount();
+
+    void Add(MemoryCategory category, size_t bytes);
+    void Sub(MemoryCategory category, size_t bytes);
+    // Memory shared by several owners, identified by key, such as the weights of a prepared model held by the
+    // compilation and its executors. Every owner counts it, the process only counts it once while an owner holds it.
+    void AddShared(MemoryCategory category, const void* key, size_t bytes);
+    void SubShared(const void* key);
+    size_t GetLiveBytes(MemoryCategory category) const;
+    void GetStatistics(OH_NN_MemoryStatistics& statistics) const;
+
+    static MemoryAccount& GetProcessAccount();
+    // Writes one line for the process and one for every registered account.
+    static OH_NN_ReturnCode Dump(const std::string& path);
+
+private:
+    // Account of the process, which has no parent.
+    explicit MemoryAccount(const std::string& name);
+    MemoryAccount(const MemoryAccount&) = delete;
+    MemoryAccount& operator=(const MemoryAccount&) = delete;
+
+    std::string ToString() const;
+    void AddLiveBytes(MemoryCategory category, size_t bytes);
+    // Used on the account of the process, which counts the owners of every shared memory.
+    void AcquireShared(MemoryCategory category, const void* key, size_t bytes);
+    void ReleaseShared(const void* key);
+
+private:
+    static constexpr size_t CATEGORY_NUM = static_cast<size_t>(MemoryCategory::CATEGORY_NUM);
+
+    struct SharedMemory {
+        MemoryCategory category {MemoryCategory::WEIGHTS};
+        size_t bytes {0};
+        size_t ownerNum {0};
+    };
+
+    std::string m_name;
+    MemoryAccount* m_parent {nullptr};
+    std::array<std::atomic<size_t>, CATEGORY_NUM> m_liveBytes {};
+    std::array<std::atomic<size_t>, CATEGORY_NUM> m_peakBytes {};
+    // Shared memory held by an owner, or with its owner count in the account of the process.
+    std::unordered_map<const void*, SharedMemory> m_sharedMemories;
+    std::mutex m_sharedMutex;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_MEMORY_ACCOUNT_H
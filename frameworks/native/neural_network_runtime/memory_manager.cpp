@@ -21,6 +21,7 @@
 
 #include "cpp_type.h"
 #include "log.h"
+#include "mapping_policy.h"
 
 namespace OHOS {
 namespace NeuralNetworkRuntime {
@@ -36,15 +37,18 @@ void* MemoryManager::MapMemory(int fd, size_t length)
         return nullptr;
     }
 
-    void* addr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    void* addr = MappingPolicy::Map(length, PROT_READ | PROT_WRITE, fd, 0);
     if (addr == MAP_FAILED) {
         LOGE("Map fd to address failed.");
         return nullptr;
     }
 
-    std::lock_guard<std::mutex> lock(m_mtx);
     Memory memory {fd, addr, length};
-    m_memorys.emplace(addr, memory);
+    if (AddMemory(memory) != OH_NN_SUCCESS) {
+        LOGE("The mapped address is added already.");
+        munmap(addr, length);
+        return nullptr;
+    }
     return addr;
 }
 
@@ -55,22 +59,34 @@ OH_NN_ReturnCode MemoryManager::UnMapMemory(const void* buffer)
         return OH_NN_INVALID_PARAMETER;
     }
 
-    std::lock_guard<std::mutex> lock(m_mtx);
-    auto iter = m_memorys.find(buffer);
-    if (iter == m_memorys.end()) {
-        LOGE("This buffer is not found, cannot release.");
-        return OH_NN_INVALID_PARAMETER;
+    Memory memory;
+    {
+        Shard& shard = m_shards[GetShardIndex(reinterpret_cast<uintptr_t>(buffer))];
+        std::lock_guard<std::shared_mutex> lock(shard.mtx);
+        auto iter = shard.memorys.find(reinterpret_cast<uintptr_t>(buffer));
+        if (iter == shard.memorys.end()) {
+            LOGE("This buffer is not found, cannot release.");
+            return OH_NN_INVALID_PARAMETER;
+        }
+        if (iter->second.isImported) {
+            LOGE("This buffer is imported by the user, cannot release.");
+            return OH_NN_INVALID_PARAMETER;
+        }
+        if (iter->second.isPooled) {
+            LOGE("This buffer is mapped by a buffer pool, cannot release.");
+            return OH_NN_INVALID_PARAMETER;
+        }
+        memory = iter->second;
     }
 
-    auto& memory = m_memorys[buffer];
+    // Removed before unmapping, the address range may be mapped again by another thread right after munmap.
+    RemoveMemory(memory);
     auto unmapResult = munmap(const_cast<void*>(memory.data), memory.length);
     if (unmapResult != 0) {
         LOGE("Unmap memory failed. Please try again.");
+        AddMemory(memory);
         return OH_NN_MEMORY_ERROR;
     }
-    memory.data = nullptr;
-
-    m_memorys.erase(iter);
     return OH_NN_SUCCESS;
 }
 
@@ -81,18 +97,165 @@ OH_NN_ReturnCode MemoryManager::GetMemory(const void* buffer, Memory& memory)
         return OH_NN_NULL_PTR;
     }
 
-    std::lock_guard<std::mutex> lock(m_mtx);
-    auto iter = m_memorys.find(buffer);
-    if (iter == m_memorys.end()) {
+    Shard& shard = m_shards[GetShardIndex(reinterpret_cast<uintptr_t>(buffer))];
+    std::shared_lock<std::shared_mutex> lock(shard.mtx);
+    auto iter = shard.memorys.find(reinterpret_cast<uintptr_t>(buffer));
+    if (iter == shard.memorys.end()) {
         LOGE("Memory is not found.");
         return OH_NN_INVALID_PARAMETER;
     }
 
-    memory.fd = iter->second.fd;
-    memory.data = iter->second.data;
-    memory.length = iter->second.length;
+    memory = iter->second;
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode MemoryManager::FindMemory(const void* address, Memory& memory)
+{
+    if (address == nullptr) {
+        LOGE("Address is nullptr.");
+        return OH_NN_NULL_PTR;
+    }
+
+    uintptr_t target = reinterpret_cast<uintptr_t>(address);
+    Shard& shard = m_shards[GetShardIndex(target)];
+    std::shared_lock<std::shared_mutex> lock(shard.mtx);
+    // The last memory which starts at or before the address.
+    auto iter = shard.memorys.upper_bound(target);
+    if (iter == shard.memorys.begin()) {
+        LOGE("Memory is not found.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    --iter;
+    if (target - iter->first >= iter->second.length) {
+        LOGE("Memory is not found.");
+        return OH_NN_INVALID_PARAMETER;
+    }
 
+    memory = iter->second;
     return OH_NN_SUCCESS;
 }
+
+OH_NN_ReturnCode MemoryManager::ImportMemory(int fd, const void* buffer, size_t length)
+{
+    if (fd < 0) {
+        LOGE("Invalid fd, fd must greater than 0.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (buffer == nullptr) {
+        LOGE("Buffer is nullptr, cannot import.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (length == 0 || length > ALLOCATE_BUFFER_LIMIT) {
+        LOGE("Invalid buffer size, it must greater than 0 and less than 1Gb. length=%zu", length);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Memory memory {fd, buffer, length, true};
+    if (AddMemory(memory) != OH_NN_SUCCESS) {
+        LOGE("This buffer has been mapped or imported already.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode MemoryManager::RemoveImportedMemory(const void* buffer)
+{
+    if (buffer == nullptr) {
+        LOGE("Buffer is nullptr, no need to remove.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Memory memory;
+    {
+        Shard& shard = m_shards[GetShardIndex(reinterpret_cast<uintptr_t>(buffer))];
+        std::shared_lock<std::shared_mutex> lock(shard.mtx);
+        auto iter = shard.memorys.find(reinterpret_cast<uintptr_t>(buffer));
+        if (iter == shard.memorys.end() || !iter->second.isImported) {
+            LOGE("This buffer is not imported, cannot remove.");
+            return OH_NN_INVALID_PARAMETER;
+        }
+        memory = iter->second;
+    }
+
+    RemoveMemory(memory);
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode MemoryManager::AddPooledMemory(int fd, const void* buffer, size_t length)
+{
+    if (fd < 0 || buffer == nullptr || length == 0) {
+        LOGE("Invalid pooled buffer, fd=%{public}d, length=%{public}zu.", fd, length);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Memory memory {fd, buffer, length, false, true};
+    if (AddMemory(memory) != OH_NN_SUCCESS) {
+        LOGE("This buffer has been mapped or imported already.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode MemoryManager::RemovePooledMemory(const void* buffer, Memory& memory)
+{
+    if (buffer == nullptr) {
+        LOGE("Buffer is nullptr, no need to remove.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    {
+        Shard& shard = m_shards[GetShardIndex(reinterpret_cast<uintptr_t>(buffer))];
+        std::shared_lock<std::shared_mutex> lock(shard.mtx);
+        auto iter = shard.memorys.find(reinterpret_cast<uintptr_t>(buffer));
+        if (iter == shard.memorys.end() || !iter->second.isPooled) {
+            LOGE("This buffer is not pooled, cannot remove.");
+            return OH_NN_INVALID_PARAMETER;
+        }
+        memory = iter->second;
+    }
+
+    RemoveMemory(memory);
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode MemoryManager::AddMemory(const Memory& memory)
+{
+    uintptr_t start = reinterpret_cast<uintptr_t>(memory.data);
+    size_t firstChunk = start >> CHUNK_SHIFT;
+    size_t lastChunk = (start + memory.length - 1) >> CHUNK_SHIFT;
+    // The shard of the first chunk decides whether the address is added already, the locks are never nested.
+    {
+        Shard& shard = m_shards[GetShardIndex(start)];
+        std::lock_guard<std::shared_mutex> lock(shard.mtx);
+        if (!shard.memorys.emplace(start, memory).second) {
+            return OH_NN_INVALID_PARAMETER;
+        }
+    }
+    for (size_t chunk = firstChunk + 1; chunk <= lastChunk && chunk - firstChunk < SHARD_NUM; ++chunk) {
+        Shard& shard = m_shards[chunk % SHARD_NUM];
+        std::lock_guard<std::shared_mutex> lock(shard.mtx);
+        shard.memorys.emplace(start, memory);
+    }
+    return OH_NN_SUCCESS;
+}
+
+void MemoryManager::RemoveMemory(const Memory& memory)
+{
+    uintptr_t start = reinterpret_cast<uintptr_t>(memory.data);
+    size_t firstChunk = start >> CHUNK_SHIFT;
+    size_t lastChunk = (start + memory.length - 1) >> CHUNK_SHIFT;
+    // The shard of the first chunk is the last one, so the address cannot be added again before the others are clean.
+    for (size_t chunk = firstChunk + 1; chunk <= lastChunk && chunk - firstChunk < SHARD_NUM; ++chunk) {
+        Shard& shard = m_shards[chunk % SHARD_NUM];
+        std::lock_guard<std::shared_mutex> lock(shard.mtx);
+        shard.memorys.erase(start);
+    }
+
+    Shard& shard = m_shards[GetShardIndex(start)];
+    std::lock_guard<std::shared_mutex> lock(shard.mtx);
+    shard.memorys.erase(start);
+}
 } // NeuralNetworkRuntime
-} // OHOS
\ No newline at end of file
+} // OHOS
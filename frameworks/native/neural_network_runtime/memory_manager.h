@@ -16,8 +16,10 @@
 #ifndef NEURAL_NETWORK_RUNTIME_MEMORY_MANAGER_H
 #define NEURAL_NETWORK_RUNTIME_MEMORY_MANAGER_H
 
-#include <unordered_map>
-#include <mutex>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <shared_mutex>
 
 #include "neural_network_runtime/neural_network_runtime_type.h"
 
@@ -29,6 +31,10 @@ struct Memory {
     int fd;
     const void* data;
     size_t length;
+    // Mapped by the user and registered with ImportMemory(), it is never unmapped by the MemoryManager.
+    bool isImported {false};
+    // Mapped by the shared buffer pool of a device, which keeps it mapped after the buffer is released.
+    bool isPooled {false};
 };
 
 class MemoryManager {
@@ -38,6 +44,13 @@ public:
     void* MapMemory(int fd, size_t length);
     OH_NN_ReturnCode UnMapMemory(const void* buffer);
     OH_NN_ReturnCode GetMemory(const void* buffer, Memory& memory);
+    // Finds the memory which contains the address, the address may point into the middle of it.
+    OH_NN_ReturnCode FindMemory(const void* address, Memory& memory);
+    OH_NN_ReturnCode ImportMemory(int fd, const void* buffer, size_t length);
+    OH_NN_ReturnCode RemoveImportedMemory(const void* buffer);
+    // Adds and removes the mapping of an allocated pooled buffer, neither maps nor unmaps it.
+    OH_NN_ReturnCode AddPooledMemory(int fd, const void* buffer, size_t length);
+    OH_NN_ReturnCode RemovePooledMemory(const void* buffer, Memory& memory);
 
     static MemoryManager* GetInstance()
     {
@@ -50,10 +63,28 @@ private:
     MemoryManager(const MemoryManager&) = delete;
     MemoryManager& operator=(const MemoryManager&) = delete;
 
+    // Adds the memory to the shards of all chunks it overlaps, fails if its address is added already.
+    OH_NN_ReturnCode AddMemory(const Memory& memory);
+    void RemoveMemory(const Memory& memory);
+
 private:
-    // key: OH_NN_Memory, value: fd
-    std::unordered_map<const void*, Memory> m_memorys;
-    std::mutex m_mtx;
+    // The address space is divided into chunks, and chunk i is indexed by shard i % SHARD_NUM. A memory is added to the
+    // shard of every chunk it overlaps, so the shard of any address it contains knows it.
+    static constexpr size_t SHARD_NUM = 16;
+    static constexpr size_t CHUNK_SHIFT = 21;
+
+    struct Shard {
+        // key: start address of the memory
+        std::map<uintptr_t, Memory> memorys;
+        std::shared_mutex mtx;
+    };
+
+    static size_t GetShardIndex(uintptr_t address)
+    {
+        return (address >> CHUNK_SHIFT) % SHARD_NUM;
+    }
+
+    std::array<Shard, SHARD_NUM> m_shards;
 };
 } // namespace NeuralNetworkRuntime
 } // OHOS
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "memory_planner.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "log.h"
+#include "tensor_arena.h"
+#include "transform.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+constexpr int64_t UNUSED_POSITION = -1;
+
+size_t AlignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+} // namespace
+
+MemoryPlanner::MemoryPlanner(size_t alignment)
+    : m_alignment(alignment == 0 ? TENSOR_ARENA_DEFAULT_ALIGNMENT : alignment)
+{}
+
+OH_NN_ReturnCode MemoryPlanner::Plan(const mindspore::lite::LiteGraph* liteGraph, MemoryPlan& plan) const
+{
+    if (liteGraph == nullptr) {
+        LOGE("[MemoryPlanner] Plan failed, lite graph is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if ((m_alignment & (m_alignment - 1)) != 0) {
+        LOGE("[MemoryPlanner] Plan failed, alignment %{public}zu is not a power of 2.", m_alignment);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    plan = MemoryPlan();
+    OH_NN_ReturnCode ret = SortNodes(liteGraph, plan.executionOrder);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    size_t tensorCount = liteGraph->all_tensors_.size();
+    std::vector<int64_t> firstUses(tensorCount, UNUSED_POSITION);
+    std::vector<int64_t> lastUses(tensorCount, UNUSED_POSITION);
+    for (size_t position = 0; position < plan.executionOrder.size(); ++position) {
+        const auto* node = liteGraph->all_nodes_[plan.executionOrder[position]];
+        for (uint32_t index : node->output_indices_) {
+            if (index < tensorCount && firstUses[index] == UNUSED_POSITION) {
+                firstUses[index] = static_cast<int64_t>(position);
+            }
+            if (index < tensorCount) {
+                lastUses[index] = std::max(lastUses[index], static_cast<int64_t>(position));
+            }
+        }
+        for (uint32_t index : node->input_indices_) {
+            if (index < tensorCount) {
+                lastUses[index] = std::max(lastUses[index], static_cast<int64_t>(position));
+            }
+        }
+    }
+
+    // The inputs and outputs of the graph are held by the buffers of the caller.
+    std::unordered_set<uint32_t> graphTensors(liteGraph->input_indices_.begin(), liteGraph->input_indices_.end());
+    graphTensors.insert(liteGraph->output_indices_.begin(), liteGraph->output_indices_.end());
+    for (uint32_t index = 0; index < tensorCount; ++index) {
+        if (firstUses[index] == UNUSED_POSITION || graphTensors.count(index) != 0) {
+            continue;
+        }
+        auto tensor = liteGraph->all_tensors_[index];
+        if (!mindspore::lite::MindIR_Tensor_GetData(tensor).empty()) {
+            continue;
+        }
+
+        size_t size {0};
+        if (!GetTensorSize(tensor, size)) {
+            ++plan.unplannedCount;
+            continue;
+        }
+        if (size == 0) {
+            continue;
+        }
+        plan.placements.push_back({index, 0, size, static_cast<uint32_t>(firstUses[index]),
+            static_cast<uint32_t>(lastUses[index])});
+        plan.naiveSize += size;
+    }
+
+    PackTensors(plan.placements, plan.arenaSize);
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode MemoryPlanner::SortNodes(const mindspore::lite::LiteGraph* liteGraph,
+    std::vector<uint32_t>& order) const
+{
+    uint32_t nodeCount = static_cast<uint32_t>(liteGraph->all_nodes_.size());
+    std::unordered_map<uint32_t, uint32_t> producers;
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        if (liteGraph->all_nodes_[i] == nullptr) {
+            LOGE("[MemoryPlanner] Plan failed, node %{public}u is nullptr.", i);
+            return OH_NN_INVALID_PARAMETER;
+        }
+        for (uint32_t index : liteGraph->all_nodes_[i]->output_indices_) {
+            producers.emplace(index, i);
+        }
+    }
+
+    std::vector<std::vector<uint32_t>> consumers(nodeCount);
+    std::vector<uint32_t> inDegrees(nodeCount, 0);
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        std::unordered_set<uint32_t> dependencies;
+        for (uint32_t index : liteGraph->all_nodes_[i]->input_indices_) {
+            auto iter = producers.find(index);
+            if (iter != producers.end() && iter->second != i && dependencies.insert(iter->second).second) {
+                consumers[iter->second].emplace_back(i);
+                ++inDegrees[i];
+            }
+        }
+    }
+
+    // The ready node of the lowest index goes first, so nodes added in a valid order keep that order.
+    std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> readyNodes;
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        if (inDegrees[i] == 0) {
+            readyNodes.push(i);
+        }
+    }
+    order.reserve(nodeCount);
+    while (!readyNodes.empty()) {
+        uint32_t nodeIndex = readyNodes.top();
+        readyNodes.pop();
+        order.emplace_back(nodeIndex);
+        for (uint32_t consumer : consumers[nodeIndex]) {
+            if (--inDegrees[consumer] == 0) {
+                readyNodes.push(consumer);
+            }
+        }
+    }
+
+    if (order.size() != nodeCount) {
+        LOGE("[MemoryPlanner] Plan failed, the graph has a cycle.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    return OH_NN_SUCCESS;
+}
+
+void MemoryPlanner::PackTensors(std::vector<TensorPlacement>& placements, size_t& arenaSize) const
+{
+    std::vector<TensorPlacement*> bySize;
+    bySize.reserve(placements.size());
+    for (auto& placement : placements) {
+        bySize.emplace_back(&placement);
+    }
+    std::stable_sort(bySize.begin(), bySize.end(),
+        [](const TensorPlacement* a, const TensorPlacement* b) { return a->size > b->size; });
+
+    arenaSize = 0;
+    std::vector<const TensorPlacement*> placed;
+    std::vector<const TensorPlacement*> overlaps;
+    for (TensorPlacement* placement : bySize) {
+        overlaps.clear();
+        for (const TensorPlacement* other : placed) {
+            if (other->firstUse <= placement->lastUse && placement->firstUse <= other->lastUse) {
+                overlaps.emplace_back(other);
+            }
+        }
+        std::sort(overlaps.begin(), overlaps.end(),
+            [](const TensorPlacement* a, const TensorPlacement* b) { return a->offset < b->offset; });
+
+        // Best fit: the smallest gap between the overlapping tensors, or the end of them if no gap is large enough.
+        size_t gapStart {0};
+        size_t bestOffset {SIZE_MAX};
+        size_t bestGap {SIZE_MAX};
+        for (const TensorPlacement* other : overlaps) {
+            if (other->offset > gapStart) {
+                size_t gap = other->offset - gapStart;
+                if (gap >= placement->size && gap < bestGap) {
+                    bestGap = gap;
+                    bestOffset = gapStart;
+                }
+            }
+            gapStart = std::max(gapStart, AlignUp(other->offset + other->size, m_alignment));
+        }
+        placement->offset = (bestOffset == SIZE_MAX) ? gapStart : bestOffset;
+        arenaSize = std::max(arenaSize, placement->offset + placement->size);
+        placed.emplace_back(placement);
+    }
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
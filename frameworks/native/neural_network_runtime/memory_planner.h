@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_MEMORY_PLANNER_H
+#define NEURAL_NETWORK_RUNTIME_MEMORY_PLANNER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "mindir.h"
+#include "neural_network_runtime_inner.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// Place of an intermediate tensor of a lite graph in the arena of the plan.
+struct TensorPlacement {
+    uint32_t tensorIndex {0};
+    size_t offset {0};
+    size_t size {0};
+    // Positions in the execution order of the nodes, the tensor is live from the first to the last one.
+    uint32_t firstUse {0};
+    uint32_t lastUse {0};
+};
+
+struct MemoryPlan {
+    // Sorted by tensorIndex.
+    std::vector<TensorPlacement> placements;
+    // Node indices in the order the plan assumes they are executed.
+    std::vector<uint32_t> executionOrder;
+    // Bytes of the arena which holds all planned tensors, the peak of the live intermediates.
+    size_t arenaSize {0};
+    // Bytes of the planned tensors if each of them had its own buffer.
+    size_t naiveSize {0};
+    // Intermediate tensors whose size is unknown before execution, e.g. of a dynamic shape.
+    uint32_t unplannedCount {0};
+};
+
+// Offline planner of the intermediate tensors of a lite graph, i.e. the tensors which are produced by a node and are
+// neither inputs nor outputs of the graph. The nodes are ordered topologically, each tensor is live from its producer
+// to its last consumer, and the tensors are packed greedily by size: from the largest one, each tensor is placed in
+// the smallest gap between the tensors placed before whose lifetimes overlap its one.
+class MemoryPlanner {
+public:
+    // alignment must be a power of 2, 0 means the alignment of the tensors of a tensor arena.
+    explicit MemoryPlanner(size_t alignment = 0);
+
+    OH_NN_ReturnCode Plan(const mindspore::lite::LiteGraph* liteGraph, MemoryPlan& plan) const;
+
+private:
+    OH_NN_ReturnCode SortNodes(const mindspore::lite::LiteGraph* liteGraph, std::vector<uint32_t>& order) const;
+    void PackTensors(std::vector<TensorPlacement>& placements, size_t& arenaSize) const;
+
+private:
+    size_t m_alignment {0};
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_MEMORY_PLANNER_H
@@ -16,19 +16,26 @@
 #include "neural_network_runtime_inner.h"
 #include "neural_network_runtime/neural_network_runtime.h"
 
+#include "auto_unload_tracker.h"
+#include "backend_manager.h"
 #include "compilation.h"
 #include "executor.h"
+#include "executor_pool.h"
 #include "inner_model.h"
 #include "log.h"
+#include "mapping_policy.h"
+#include "memory_account.h"
+#include "nnbackend.h"
 #include "quant_param.h"
+#include "tensor_arena.h"
 #include "validation.h"
 #include "syspara/parameter.h"
+#include "latency_reporter.h"
 #include "nnrt_client.h"
 
 #include <cstring>
 #include <fstream>
 #include <filesystem>
-#include <thread>
 #include <sys/stat.h>
 #include <unistd.h>
 #include "nlohmann/json.hpp"
@@ -63,6 +70,7 @@ constexpr size_t  DEVICE_NAME_SIZE = 5;
 constexpr size_t CHECK_SUM_ZERO = 0;
 constexpr size_t CHECK_SUM_TWO = 2;
 constexpr size_t INPUT_OUTPUT_MAX_INDICES = 200;
+constexpr size_t EXECUTOR_POOL_MAX_CONTEXTS = 64;
 }
 
 unsigned short CacheInfoGetCrc16(char* buffer, size_t length)
@@ -911,34 +919,6 @@ NNRT_API OH_NN_ReturnCode OH_NN_IsSupportAIPP(bool& support)
     return OH_NN_FAILED;
 }
 
-OH_NN_ReturnCode UpdateModelLatency(const ExecutorConfig* config, int32_t modelLatency)
-{
-    if (config == nullptr) {
-        LOGE("UpdateModelLatency failed, config is nullptr.");
-        return OH_NN_INVALID_PARAMETER;
-    }
-
-    NNRtServiceApi& nnrtService = NNRtServiceApi::GetInstance();
-    if (!nnrtService.IsServiceAvaliable()) {
-        LOGW("UpdateModelLatency failed, fail to get nnrt service, skip update model latency.");
-        return OH_NN_SUCCESS;
-    }
-
-    if (nnrtService.UpdateModelLatency == nullptr) {
-        LOGE("UpdateModelLatency failed, nnrtService UpdateModelLatency func is nullptr.");
-        return OH_NN_INVALID_PARAMETER;
-    }
-
-    LOGD("UpdateModelLatency, hiaiModelId: %{public}u, modelLatency: %{public}d.", config->hiaiModelId, modelLatency);
-
-    int ret = nnrtService.UpdateModelLatency(config->hiaiModelId, modelLatency);
-    if (ret != static_cast<int>(OH_NN_SUCCESS)) {
-        LOGE("UpdateModelLatency failed, nnrtService is not exist, jump over UpdateModelLatency.");
-        return static_cast<OH_NN_ReturnCode>(ret);
-    }
-    return OH_NN_SUCCESS;
-}
-
 OH_NN_ReturnCode RunSyncWithAipp(Executor *executor,
                                  NN_Tensor *inputTensor[],
                                  size_t inputCount,
@@ -952,10 +932,11 @@ OH_NN_ReturnCode RunSyncWithAipp(Executor *executor,
         return OH_NN_INVALID_PARAMETER;
     }
 
+    bool isNeedModelLatency = configPtr->isNeedModelLatency.load();
     long timeStart = 0;
-    if (configPtr->isNeedModelLatency) {
+    if (isNeedModelLatency) {
         timeStart = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now().time_since_epoch()).count();
+            std::chrono::steady_clock::now().time_since_epoch()).count();
     }
 
     OH_NN_ReturnCode ret = executor->RunSyncWithAipp(inputTensor, inputCount, outputTensor, outputCount, aippStrings);
@@ -964,23 +945,11 @@ OH_NN_ReturnCode RunSyncWithAipp(Executor *executor,
         return ret;
     }
 
-    if (configPtr->isNeedModelLatency) {
+    if (isNeedModelLatency && configPtr->isNeedModelLatency.exchange(false)) {
         long timeEnd = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now().time_since_epoch()).count();
+            std::chrono::steady_clock::now().time_since_epoch()).count();
         int32_t modelLatency = static_cast<int32_t>((timeEnd - timeStart));
-        std::thread t(UpdateModelLatency, configPtr, modelLatency);
-        t.detach();
-
-        configPtr->isNeedModelLatency = false;
-        std::unordered_map<std::string, std::vector<char>> configMap;
-        std::vector<char> vecNeedLatency = { static_cast<char>(configPtr->isNeedModelLatency) };
-        configMap["isNeedModelLatency"] = vecNeedLatency;
-
-        ret = executor->SetExtensionConfig(configMap);
-        if (ret != OH_NN_SUCCESS) {
-            LOGE("OH_NNExecutor_RunSyncWithAipp failed, fail update executor config.");
-            return ret;
-        }
+        (void)LatencyReporter::GetInstance().Post(configPtr->hiaiModelId, modelLatency);
     }
 
     return OH_NN_SUCCESS;
@@ -1025,4 +994,432 @@ NNRT_API OH_NN_ReturnCode OH_NNExecutor_RunSyncWithAipp(OH_NNExecutor *executor,
 
     Executor *executorImpl = reinterpret_cast<Executor *>(executor);
     return RunSyncWithAipp(executorImpl, inputTensor, inputCount, outputTensor, outputCount, aippString);
-}
\ No newline at end of file
+}
+
+NNRT_API OH_NNExecutorPool *OH_NNExecutorPool_Construct(OH_NNCompilation *compilation, size_t contextCount)
+{
+    if (compilation == nullptr) {
+        LOGE("OH_NNExecutorPool_Construct failed, compilation is nullptr.");
+        return nullptr;
+    }
+
+    if ((contextCount == 0) || (contextCount > EXECUTOR_POOL_MAX_CONTEXTS)) {
+        LOGE("OH_NNExecutorPool_Construct failed, contextCount is 0 or more than %{public}zu.",
+            EXECUTOR_POOL_MAX_CONTEXTS);
+        return nullptr;
+    }
+
+    OH_NNExecutor *executor = OH_NNExecutor_Construct(compilation);
+    if (executor == nullptr) {
+        LOGE("OH_NNExecutorPool_Construct failed, failed to construct executor.");
+        return nullptr;
+    }
+
+    ExecutorPool *executorPool =
+        new (std::nothrow) ExecutorPool(reinterpret_cast<Executor *>(executor), contextCount);
+    if (executorPool == nullptr) {
+        LOGE("OH_NNExecutorPool_Construct failed, failed to allocate executor pool.");
+        OH_NNExecutor_Destroy(&executor);
+        return nullptr;
+    }
+
+    return reinterpret_cast<OH_NNExecutorPool *>(executorPool);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNExecutorPool_RunSync(OH_NNExecutorPool *executorPool,
+                                                    NN_Tensor *inputTensor[],
+                                                    size_t inputCount,
+                                                    NN_Tensor *outputTensor[],
+                                                    size_t outputCount)
+{
+    if (executorPool == nullptr) {
+        LOGE("OH_NNExecutorPool_RunSync failed, executorPool is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (inputTensor == nullptr) {
+        LOGE("OH_NNExecutorPool_RunSync failed, inputTensor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if ((inputCount == 0) || (inputCount > INPUT_OUTPUT_MAX_INDICES)) {
+        LOGE("OH_NNExecutorPool_RunSync failed, inputCount is 0 or more than 200.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (outputTensor == nullptr) {
+        LOGE("OH_NNExecutorPool_RunSync failed, outputTensor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if ((outputCount == 0) || (outputCount > INPUT_OUTPUT_MAX_INDICES)) {
+        LOGE("OH_NNExecutorPool_RunSync failed, outputCount is 0 or more than 200.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    ExecutorPool *executorPoolImpl = reinterpret_cast<ExecutorPool *>(executorPool);
+    return executorPoolImpl->RunSync(inputTensor, inputCount, outputTensor, outputCount);
+}
+
+NNRT_API void OH_NNExecutorPool_Destroy(OH_NNExecutorPool **executorPool)
+{
+    if (executorPool == nullptr) {
+        LOGE("OH_NNExecutorPool_Destroy failed, executorPool is nullptr.");
+        return;
+    }
+    if (*executorPool == nullptr) {
+        LOGE("OH_NNExecutorPool_Destroy failed, *executorPool is nullptr.");
+        return;
+    }
+
+    ExecutorPool *executorPoolImpl = reinterpret_cast<ExecutorPool *>(*executorPool);
+    OH_NNExecutor *executor = reinterpret_cast<OH_NNExecutor *>(executorPoolImpl->GetExecutor());
+    delete executorPoolImpl;
+    OH_NNExecutor_Destroy(&executor);
+    *executorPool = nullptr;
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNExecutor_GetStatistics(const OH_NNExecutor *executor,
+                                                      OH_NN_ExecutorStatistics *statistics)
+{
+    if (executor == nullptr) {
+        LOGE("OH_NNExecutor_GetStatistics failed, executor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (statistics == nullptr) {
+        LOGE("OH_NNExecutor_GetStatistics failed, statistics is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    const Executor *executorImpl = reinterpret_cast<const Executor *>(executor);
+    return executorImpl->GetStatistics(*statistics);
+}
+
+namespace {
+std::shared_ptr<Device> GetDeviceByID(size_t deviceID)
+{
+    BackendManager& backendManager = BackendManager::GetInstance();
+    std::shared_ptr<Backend> backend = backendManager.GetBackend(deviceID);
+    if (backend == nullptr) {
+        return nullptr;
+    }
+    return reinterpret_cast<NNBackend*>(backend.get())->GetDevice();
+}
+} // namespace
+
+NNRT_API OH_NN_ReturnCode OH_NNDevice_SetBufferPoolHighWaterMark(size_t deviceID, size_t highWaterMark)
+{
+    std::shared_ptr<Device> device = GetDeviceByID(deviceID);
+    if (device == nullptr) {
+        LOGE("OH_NNDevice_SetBufferPoolHighWaterMark failed, passed invalid deviceID.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    return device->SetBufferPoolHighWaterMark(highWaterMark);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNDevice_GetBufferPoolStatistics(size_t deviceID,
+                                                              OH_NN_BufferPoolStatistics *statistics)
+{
+    if (statistics == nullptr) {
+        LOGE("OH_NNDevice_GetBufferPoolStatistics failed, statistics is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    std::shared_ptr<Device> device = GetDeviceByID(deviceID);
+    if (device == nullptr) {
+        LOGE("OH_NNDevice_GetBufferPoolStatistics failed, passed invalid deviceID.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    return device->GetBufferPoolStatistics(*statistics);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NN_SetModelMemoryBudget(size_t budget)
+{
+    AutoUnloadTracker::GetInstance()->SetMemoryBudget(budget);
+    return OH_NN_SUCCESS;
+}
+
+NNRT_API OH_NN_ReturnCode OH_NN_GetModelMemoryStatistics(OH_NN_ModelMemoryStatistics *statistics)
+{
+    if (statistics == nullptr) {
+        LOGE("OH_NN_GetModelMemoryStatistics failed, statistics is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    AutoUnloadTracker::GetInstance()->GetMemoryStatistics(*statistics);
+    return OH_NN_SUCCESS;
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNCompilation_GetMemoryStatistics(const OH_NNCompilation *compilation,
+                                                               OH_NN_MemoryStatistics *statistics)
+{
+    if (compilation == nullptr) {
+        LOGE("OH_NNCompilation_GetMemoryStatistics failed, compilation is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (statistics == nullptr) {
+        LOGE("OH_NNCompilation_GetMemoryStatistics failed, statistics is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    const Compilation *compilationImpl = reinterpret_cast<const Compilation *>(compilation);
+    if (compilationImpl->compiler == nullptr) {
+        LOGE("OH_NNCompilation_GetMemoryStatistics failed, the compilation has not been built.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    return compilationImpl->compiler->GetMemoryStatistics(*statistics);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNExecutor_GetMemoryStatistics(const OH_NNExecutor *executor,
+                                                            OH_NN_MemoryStatistics *statistics)
+{
+    if (executor == nullptr) {
+        LOGE("OH_NNExecutor_GetMemoryStatistics failed, executor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (statistics == nullptr) {
+        LOGE("OH_NNExecutor_GetMemoryStatistics failed, statistics is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    const Executor *executorImpl = reinterpret_cast<const Executor *>(executor);
+    return executorImpl->GetMemoryStatistics(*statistics);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NN_GetMemoryStatistics(OH_NN_MemoryStatistics *statistics)
+{
+    if (statistics == nullptr) {
+        LOGE("OH_NN_GetMemoryStatistics failed, statistics is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    MemoryAccount::GetProcessAccount().GetStatistics(*statistics);
+    return OH_NN_SUCCESS;
+}
+
+NNRT_API OH_NN_ReturnCode OH_NN_DumpMemoryStatistics(const char *path)
+{
+    if (path == nullptr) {
+        LOGE("OH_NN_DumpMemoryStatistics failed, path is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    return MemoryAccount::Dump(path);
+}
+
+NNRT_API OH_NNTensorArena *OH_NNTensorArena_Create(size_t deviceID, size_t size)
+{
+    BackendManager& backendManager = BackendManager::GetInstance();
+    if (backendManager.GetBackend(deviceID) == nullptr) {
+        LOGE("OH_NNTensorArena_Create failed, passed invalid deviceID.");
+        return nullptr;
+    }
+
+    TensorArena *arena = new (std::nothrow) TensorArena(deviceID);
+    if (arena == nullptr) {
+        LOGE("OH_NNTensorArena_Create failed, failed to allocate tensor arena.");
+        return nullptr;
+    }
+
+    OH_NN_ReturnCode ret = arena->Init(size);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("OH_NNTensorArena_Create failed, failed to create the shared buffer.");
+        delete arena;
+        return nullptr;
+    }
+
+    return reinterpret_cast<OH_NNTensorArena *>(arena);
+}
+
+NNRT_API NN_Tensor *OH_NNTensorArena_CreateTensor(OH_NNTensorArena *arena, NN_TensorDesc *tensorDesc, size_t alignment)
+{
+    if (arena == nullptr) {
+        LOGE("OH_NNTensorArena_CreateTensor failed, arena is nullptr.");
+        return nullptr;
+    }
+    if (tensorDesc == nullptr) {
+        LOGE("OH_NNTensorArena_CreateTensor failed, tensorDesc is nullptr.");
+        return nullptr;
+    }
+
+    TensorArena *arenaImpl = reinterpret_cast<TensorArena *>(arena);
+    Tensor *tensorImpl = arenaImpl->CreateTensor(reinterpret_cast<TensorDesc *>(tensorDesc),
+        (alignment == 0) ? TENSOR_ARENA_DEFAULT_ALIGNMENT : alignment);
+    return reinterpret_cast<NN_Tensor *>(tensorImpl);
+}
+
+NNRT_API NN_Tensor *OH_NNTensorArena_CreateTensorAt(OH_NNTensorArena *arena, NN_TensorDesc *tensorDesc, size_t offset)
+{
+    if (arena == nullptr) {
+        LOGE("OH_NNTensorArena_CreateTensorAt failed, arena is nullptr.");
+        return nullptr;
+    }
+    if (tensorDesc == nullptr) {
+        LOGE("OH_NNTensorArena_CreateTensorAt failed, tensorDesc is nullptr.");
+        return nullptr;
+    }
+
+    TensorArena *arenaImpl = reinterpret_cast<TensorArena *>(arena);
+    Tensor *tensorImpl = arenaImpl->CreateTensorAt(reinterpret_cast<TensorDesc *>(tensorDesc), offset);
+    return reinterpret_cast<NN_Tensor *>(tensorImpl);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNTensorArena_Reset(OH_NNTensorArena *arena)
+{
+    if (arena == nullptr) {
+        LOGE("OH_NNTensorArena_Reset failed, arena is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    TensorArena *arenaImpl = reinterpret_cast<TensorArena *>(arena);
+    return arenaImpl->Reset();
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNTensorArena_Destroy(OH_NNTensorArena **arena)
+{
+    if (arena == nullptr) {
+        LOGE("OH_NNTensorArena_Destroy failed, arena is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (*arena == nullptr) {
+        LOGE("OH_NNTensorArena_Destroy failed, *arena is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    delete reinterpret_cast<TensorArena *>(*arena);
+    *arena = nullptr;
+    return OH_NN_SUCCESS;
+}
+
+NNRT_API OH_NN_ReturnCode OH_NN_SetMappingPolicy(uint32_t flags, size_t threshold)
+{
+    return MappingPolicy::Set(flags, threshold);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNModel_GetMemoryPlanStatistics(const OH_NNModel *model,
+                                                             OH_NN_MemoryPlanStatistics *statistics)
+{
+    if (model == nullptr) {
+        LOGE("OH_NNModel_GetMemoryPlanStatistics failed, passed nullptr to model.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (statistics == nullptr) {
+        LOGE("OH_NNModel_GetMemoryPlanStatistics failed, passed nullptr to statistics.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    const InnerModel *innerModel = reinterpret_cast<const InnerModel*>(model);
+    MemoryPlan plan;
+    OH_NN_ReturnCode ret = innerModel->GetMemoryPlan(plan);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    statistics->arenaSize = plan.arenaSize;
+    statistics->naiveSize = plan.naiveSize;
+    statistics->plannedCount = static_cast<uint32_t>(plan.placements.size());
+    statistics->unplannedCount = plan.unplannedCount;
+    return OH_NN_SUCCESS;
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNExecutor_SetOutputAlias(OH_NNExecutor *executor, uint32_t outputIndex,
+                                                       uint32_t inputIndex)
+{
+    if (executor == nullptr) {
+        LOGE("OH_NNExecutor_SetOutputAlias failed, executor is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    Executor *executorImpl = reinterpret_cast<Executor *>(executor);
+    return executorImpl->SetOutputAlias(outputIndex, inputIndex);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNModel_SetTensorDataBorrowed(OH_NNModel *model,
+                                                           uint32_t index,
+                                                           const void *dataBuffer,
+                                                           size_t length)
+{
+    if (model == nullptr) {
+        LOGE("OH_NNModel_SetTensorDataBorrowed failed, passed nullptr to model.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (dataBuffer == nullptr) {
+        LOGE("OH_NNModel_SetTensorDataBorrowed failed, passed nullptr to dataBuffer, which has no effect.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (length == 0) {
+        LOGE("OH_NNModel_SetTensorDataBorrowed failed, passed dataBuffer with length 0, which has no effect.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    InnerModel *innerModel = reinterpret_cast<InnerModel*>(model);
+    return innerModel->BorrowTensorValue(index, dataBuffer, length);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNModel_SetTensorDataFromFd(OH_NNModel *model, uint32_t index, int fd, size_t offset,
+                                                         size_t length)
+{
+    if (model == nullptr) {
+        LOGE("OH_NNModel_SetTensorDataFromFd failed, passed nullptr to model.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (fd < 0) {
+        LOGE("OH_NNModel_SetTensorDataFromFd failed, fd %{public}d is invalid.", fd);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (length == 0) {
+        LOGE("OH_NNModel_SetTensorDataFromFd failed, passed length 0, which has no effect.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    InnerModel *innerModel = reinterpret_cast<InnerModel*>(model);
+    return innerModel->SetTensorValueFromFd(index, fd, offset, length);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNModel_SetGraphPasses(OH_NNModel *model, uint32_t passes)
+{
+    if (model == nullptr) {
+        LOGE("OH_NNModel_SetGraphPasses failed, passed nullptr to model.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    InnerModel *innerModel = reinterpret_cast<InnerModel*>(model);
+    return innerModel->SetGraphPasses(passes);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNModel_GetGraphPassSummary(const OH_NNModel *model, OH_NN_GraphPassSummary *summary)
+{
+    if (model == nullptr) {
+        LOGE("OH_NNModel_GetGraphPassSummary failed, passed nullptr to model.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    if (summary == nullptr) {
+        LOGE("OH_NNModel_GetGraphPassSummary failed, passed nullptr to summary.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    const InnerModel *innerModel = reinterpret_cast<const InnerModel*>(model);
+    GraphPassSummary passSummary;
+    OH_NN_ReturnCode ret = innerModel->GetGraphPassSummary(passSummary);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    summary->originalNodeCount = passSummary.originalNodeCount;
+    summary->nodeCount = passSummary.nodeCount;
+    summary->foldedCount = passSummary.foldedCount;
+    summary->fusedCount = passSummary.fusedCount;
+    summary->eliminatedCount = passSummary.eliminatedCount;
+    summary->mergedCount = passSummary.mergedCount;
+    summary->removedTensorCount = passSummary.removedTensorCount;
+    summary->removedBytes = passSummary.removedBytes;
+    summary->foldedBytes = passSummary.foldedBytes;
+    return OH_NN_SUCCESS;
+}
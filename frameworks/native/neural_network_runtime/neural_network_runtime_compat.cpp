@@ -225,4 +225,37 @@ NNRT_API OH_NN_ReturnCode OH_NNExecutor_SetOutputWithMemory(OH_NNExecutor *execu
 
     NNExecutor *executorImpl = reinterpret_cast<NNExecutor *>(executor);
     return executorImpl->SetOutputFromMemory(outputIndex, *memory);
-}
\ No newline at end of file
+}
+NNRT_API OH_NN_ReturnCode OH_NNExecutor_RegisterBuffer(OH_NNExecutor *executor, void *buffer, size_t length, int fd)
+{
+    if (executor == nullptr) {
+        LOGE("OH_NNExecutor_RegisterBuffer failed, passed nullptr to executor.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (buffer == nullptr) {
+        LOGE("OH_NNExecutor_RegisterBuffer failed, passed nullptr to buffer.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (length == 0) {
+        LOGE("OH_NNExecutor_RegisterBuffer failed, buffer length is 0.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    NNExecutor *executorImpl = reinterpret_cast<NNExecutor *>(executor);
+    return executorImpl->RegisterBuffer(buffer, length, fd);
+}
+
+NNRT_API OH_NN_ReturnCode OH_NNExecutor_UnregisterBuffer(OH_NNExecutor *executor, void *buffer)
+{
+    if (executor == nullptr) {
+        LOGE("OH_NNExecutor_UnregisterBuffer failed, passed nullptr to executor.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (buffer == nullptr) {
+        LOGE("OH_NNExecutor_UnregisterBuffer failed, passed nullptr to buffer.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    NNExecutor *executorImpl = reinterpret_cast<NNExecutor *>(executor);
+    return executorImpl->UnregisterBuffer(buffer);
+}
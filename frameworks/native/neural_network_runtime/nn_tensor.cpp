@@ -37,9 +37,7 @@ void DestroyLiteGraphTensor(void* tensor)
 
 NNTensor::~NNTensor()
 {
-    if (m_buffer != nullptr) {
-        delete [] reinterpret_cast<char*>(m_buffer);
-    }
+    ReleaseBuffer();
 }
 
 NNTensor::NNTensor(NNTensor&& tensor) noexcept
@@ -65,6 +63,7 @@ NNTensor& NNTensor::operator=(NNTensor&& tensor) noexcept
     m_buffer = tensor.m_buffer;
     m_bufferLength = tensor.m_bufferLength;
     m_dataLength = tensor.m_dataLength;
+    m_releaser = std::move(tensor.m_releaser);
 
     tensor.m_buffer = nullptr;
     tensor.m_bufferLength = 0;
@@ -350,6 +349,24 @@ void NNTensor::SetBuffer(const void* buffer, size_t length)
     // copy pointer instead of memory copying
     m_buffer = const_cast<void*>(buffer);
     m_bufferLength = length;
+    m_releaser = [](void* data, size_t) { delete [] reinterpret_cast<char*>(data); };
+}
+
+void NNTensor::SetBuffer(const void* buffer, size_t length, BufferReleaser&& releaser)
+{
+    m_buffer = const_cast<void*>(buffer);
+    m_bufferLength = length;
+    m_releaser = std::move(releaser);
+}
+
+void NNTensor::ReleaseBuffer()
+{
+    if (m_buffer != nullptr && m_releaser != nullptr) {
+        m_releaser(m_buffer, m_bufferLength);
+    }
+    m_buffer = nullptr;
+    m_bufferLength = 0;
+    m_releaser = nullptr;
 }
 
 void NNTensor::SetFormat(const OH_NN_Format& format)
@@ -431,8 +448,9 @@ LiteGraphTensorPtr NNTensor::ConvertToLiteGraphTensor() const
 {
     mindspore::lite::DataType dataType = NNToMS::TransformDataType(m_dataType);
     mindspore::lite::Format format = NNToMS::TransformFormat(m_format);
+    // The data is copied by MindIR_Tensor_Create only, the buffer may be borrowed from the caller.
     const uint8_t* buffer = static_cast<const uint8_t*>(m_buffer);
-    std::vector<uint8_t> data = ConstructVectorFromArray(buffer, m_dataLength);
+    size_t dataLength = (buffer == nullptr) ? 0 : m_dataLength;
 
     std::vector<mindspore::lite::QuantParam> quantParams;
     mindspore::lite::QuantParam msQuantParam;
@@ -443,7 +461,7 @@ LiteGraphTensorPtr NNTensor::ConvertToLiteGraphTensor() const
 
     mindspore::lite::TensorPtr tensor = mindspore::lite::MindIR_Tensor_Create(
         m_name.c_str(), dataType, m_dimensions.data(), m_dimensions.size(), format,
-        data.data(), data.size(), quantParams.data(), quantParams.size());
+        buffer, dataLength, quantParams.data(), quantParams.size());
     if (tensor == nullptr) {
         LOGE("ConvertToLiteGraphTensor failed, please check attributes of NNTensor.");
         return {nullptr, DestroyLiteGraphTensor};
@@ -16,6 +16,7 @@
 #ifndef NEURAL_NETWORK_RUNTIME_NN_TENSOR_H
 #define NEURAL_NETWORK_RUNTIME_NN_TENSOR_H
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -27,6 +28,7 @@
 namespace OHOS {
 namespace NeuralNetworkRuntime {
 using LiteGraphTensorPtr = std::unique_ptr<void, void(*)(void*)>;
+using BufferReleaser = std::function<void(void* buffer, size_t length)>;
 
 void DestroyLiteGraphTensor(void* tensor);
 
@@ -52,6 +54,9 @@ public:
 
     void SetName(const std::string& name);
     void SetBuffer(const void* buffer, size_t length);
+    // The buffer is released by the releaser instead of delete[], an empty releaser leaves it to its owner.
+    void SetBuffer(const void* buffer, size_t length, BufferReleaser&& releaser);
+    void ReleaseBuffer();
     void SetFormat(const OH_NN_Format& format);
     OH_NN_ReturnCode SetDimensions(const std::vector<int32_t>& dimensions);
     OH_NN_ReturnCode SetQuantParam(const NN_QuantParam* quantParam);
@@ -97,6 +102,8 @@ private:
     bool m_isOpParameter {false};
     void* m_buffer {nullptr};
     size_t m_bufferLength {0};
+    // delete[] by default, the buffer may also be borrowed from the caller or mapped from a file.
+    BufferReleaser m_releaser;
     size_t m_dataLength {0};
 };
 }  // namespace NeuralNetworkRuntime
@@ -24,6 +24,7 @@
 
 #include "utils.h"
 #include "backend_manager.h"
+#include "mapping_policy.h"
 #include "nnbackend.h"
 
 namespace OHOS {
@@ -137,6 +138,9 @@ OH_NN_ReturnCode NNCompiledCache::Restore(const std::string& cacheDir,
             return OH_NN_INVALID_FILE;
         }
 
+        if (m_memoryAccount != nullptr) {
+            m_memoryAccount->Add(MemoryCategory::CACHE_MAPPINGS, modelBuffer.length);
+        }
         caches.emplace_back(std::move(modelBuffer));
     }
 
@@ -175,6 +179,11 @@ void NNCompiledCache::SetIsExceedRamLimit(const bool isExceedRamLimit)
     m_isExceedRamLimit = isExceedRamLimit;
 }
 
+void NNCompiledCache::SetMemoryAccount(MemoryAccount* memoryAccount)
+{
+    m_memoryAccount = memoryAccount;
+}
+
 OH_NN_ReturnCode NNCompiledCache::GenerateCacheFiles(const std::vector<OHOS::NeuralNetworkRuntime::Buffer>& caches,
                                                      const std::string& cacheDir,
                                                      uint32_t version,
@@ -452,7 +461,7 @@ OH_NN_ReturnCode NNCompiledCache::ReadCacheModelFile(const std::string& filePath
 
     off_t fsize = sb.st_size;
 
-    void *ptr = mmap(nullptr, fsize, PROT_READ, MAP_SHARED, fd, 0);
+    void *ptr = MappingPolicy::Map(fsize, PROT_READ, fd, 0);
     if (ptr == MAP_FAILED) {
         LOGE("[NNCompiledCache] ReadCacheModelFile failed, failed to mmap file.");
         close(fd);
@@ -552,6 +561,9 @@ void NNCompiledCache::ReleaseCacheBuffer(std::vector<Buffer>& buffers)
     for (auto buffer : buffers) {
         munmap(buffer.data, buffer.length);
         close(buffer.fd);
+        if (m_memoryAccount != nullptr) {
+            m_memoryAccount->Sub(MemoryCategory::CACHE_MAPPINGS, buffer.length);
+        }
     }
     buffers.clear();
 }
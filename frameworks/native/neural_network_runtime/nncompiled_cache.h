@@ -27,6 +27,7 @@
 #include "nlohmann/json.hpp"
 
 #include "device.h"
+#include "memory_account.h"
 #include "neural_network_runtime/neural_network_runtime.h"
 #include "tensor_desc.h"
 
@@ -62,6 +63,8 @@ public:
     OH_NN_ReturnCode SetBackend(size_t backendID);
     void SetModelName(const std::string& modelName);
     void SetIsExceedRamLimit(const bool isExceedRamLimit);
+    // The mappings of Restore() are counted by the account until ReleaseCacheBuffer(), it must outlive them.
+    void SetMemoryAccount(MemoryAccount* memoryAccount);
     OH_NN_ReturnCode WriteCacheInfo(uint32_t cacheSize,
                                     nlohmann::json& cacheInfo,
                                     const std::string& cacheDir) const;
@@ -92,6 +95,7 @@ private:
     std::string m_modelName;
     std::shared_ptr<Device> m_device {nullptr};
     bool m_isExceedRamLimit {false};
+    MemoryAccount* m_memoryAccount {nullptr};
 };
 
 } // namespace NeuralNetworkRuntime
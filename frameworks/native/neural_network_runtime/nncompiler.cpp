@@ -23,6 +23,7 @@
 
 #include "validation.h"
 #include "nncompiled_cache.h"
+#include "output_alias_analyzer.h"
 #include "utils.h"
 #include "nlohmann/json.hpp"
 
@@ -36,6 +37,8 @@ constexpr int32_t NUMBER_CACHE_INFO_EXTENSION_MEMBERS = 2;
 const std::string EXTENSION_KEY_MODEL_NAME = "ModelName";
 const std::string EXTENSION_KEY_FM_SHARED = "NPU_FM_SHARED";
 const std::string EXTENSION_KEY_IS_EXCEED_RAMLIMIT = "isExceedRamLimit";
+const std::string EXTENSION_KEY_RELOAD_POLICY = "ReloadPolicy";
+const std::string EXTENSION_KEY_OUTPUT_REGROW = "OutputRegrow";
 constexpr size_t INPUT_OUTPUT_MAX_NUM = 200;
 constexpr size_t MORE_MODEL_MAX_LIMIT = 201 * 1024 * 1024; // 201MB
 constexpr size_t MODEL_MAX_LIMIT = 200 * 1024 * 1024; // 200MB
@@ -147,6 +150,7 @@ NNCompiler::NNCompiler(const void* model, std::shared_ptr<Device> device, size_t
 NNCompiler::~NNCompiler()
 {
     if (m_preparedModel != nullptr) {
+        m_memoryAccount.SubShared(m_preparedModel.get());
         m_preparedModel.reset();
     }
     m_inputTensorDescs.clear();
@@ -387,7 +391,11 @@ OH_NN_ReturnCode NNCompiler::NormalBuild()
     ModelConfig config {m_enableFp16, static_cast<OH_NN_PerformanceMode>(m_performance),
         static_cast<OH_NN_Priority>(m_priority), m_cachePath, m_extensionConfig};
     if (m_liteGraph != nullptr) {
+        // The device copies the constant tensors into a shared buffer, which is held while the model is prepared.
+        size_t constTensorSize = mindspore::lite::MindIR_LiteGraph_GetConstTensorSize(m_liteGraph.get());
+        m_memoryAccount.Add(MemoryCategory::STAGING, constTensorSize);
         ret = m_device->PrepareModel(m_liteGraph, config, m_preparedModel);
+        m_memoryAccount.Sub(MemoryCategory::STAGING, constTensorSize);
     }
     if (m_metaGraph != nullptr) {
         ret = m_device->PrepareModel(m_metaGraph, config, m_preparedModel);
@@ -446,6 +454,8 @@ OH_NN_ReturnCode NNCompiler::Build()
         }
 
         m_isBuild = true;
+        m_modelSize = GetModelSize();
+        m_memoryAccount.AddShared(MemoryCategory::WEIGHTS, m_preparedModel.get(), m_modelSize);
         return OH_NN_SUCCESS;
     }
 
@@ -455,6 +465,10 @@ OH_NN_ReturnCode NNCompiler::Build()
         return ret;
     }
 
+    // The model may be released after building, its size is kept for the memory budget of the executors.
+    // The executors share the prepared model, the process counts its weights once.
+    m_modelSize = GetModelSize();
+    m_memoryAccount.AddShared(MemoryCategory::WEIGHTS, m_preparedModel.get(), m_modelSize);
     return OH_NN_SUCCESS;
 }
 
@@ -614,6 +628,7 @@ OH_NN_ReturnCode NNCompiler::RestoreFromCacheFile()
     }
 
     std::vector<Buffer> caches;
+    compiledCache.SetMemoryAccount(&m_memoryAccount);
     compiledCache.SetModelName(m_extensionConfig.modelName);
     ret = compiledCache.Restore(m_cachePath, m_cacheVersion, caches, m_liteGraphModelId);
     if (ret != OH_NN_SUCCESS) {
@@ -755,6 +770,28 @@ OH_NN_ReturnCode NNCompiler::SetExtensionConfig(const std::unordered_map<std::st
             m_extensionConfig.isExceedRamLimit = false;
         }
     }
+    if (configs.find(EXTENSION_KEY_RELOAD_POLICY) != configs.end()) {
+        std::vector<char> value = configs.at(EXTENSION_KEY_RELOAD_POLICY);
+        if (value.empty()) {
+            LOGE("[NNCompiler] SetExtensionConfig get empty reload policy from configs");
+            return OH_NN_INVALID_PARAMETER;
+        }
+
+        m_extensionConfig.reloadPolicy = (value[0] == '1') ? ReloadPolicy::PREDICTIVE : ReloadPolicy::ON_DEMAND;
+        LOGI("[NNCompiler] SetExtensionConfig reload policy: %{public}d.",
+            static_cast<int>(m_extensionConfig.reloadPolicy));
+    }
+    if (configs.find(EXTENSION_KEY_OUTPUT_REGROW) != configs.end()) {
+        std::vector<char> value = configs.at(EXTENSION_KEY_OUTPUT_REGROW);
+        if (value.empty()) {
+            LOGE("[NNCompiler] SetExtensionConfig get empty output regrow from configs");
+            return OH_NN_INVALID_PARAMETER;
+        }
+
+        m_extensionConfig.isOutputRegrowEnabled = (value[0] == '1');
+        LOGI("[NNCompiler] SetExtensionConfig output regrow: %{public}d.",
+            static_cast<int>(m_extensionConfig.isOutputRegrowEnabled));
+    }
     return OH_NN_SUCCESS;
 }
 
@@ -798,6 +835,16 @@ NNExecutor* NNCompiler::CreateExecutor()
         LOGE("[NNCompiler] CreateExecutor failed, error happend when allocating NN Executor.");
         return nullptr;
     }
+    nnExecutor->TrackModelMemory(m_modelSize);
+
+    // The graph is unknown if the compilation is restored from the cache, its outputs cannot alias the inputs then.
+    if (m_liteGraph != nullptr) {
+        std::vector<std::vector<uint32_t>> aliasableInputs;
+        OutputAliasAnalyzer analyzer;
+        if (analyzer.Analyze(m_liteGraph.get(), aliasableInputs) == OH_NN_SUCCESS) {
+            nnExecutor->SetAliasableInputs(std::move(aliasableInputs));
+        }
+    }
 
     return nnExecutor;
 }
@@ -1314,5 +1361,11 @@ bool NNCompiler::IsOnlineModel()
 {
     return true;
 }
+
+OH_NN_ReturnCode NNCompiler::GetMemoryStatistics(OH_NN_MemoryStatistics& statistics) const
+{
+    m_memoryAccount.GetStatistics(statistics);
+    return OH_NN_SUCCESS;
+}
 } // NeuralNetworkRuntime
 } // OHOS
@@ -20,6 +20,7 @@
 
 #include "mindir.h"
 #include "device.h"
+#include "memory_account.h"
 #include "inner_model.h"
 #include "prepared_model.h"
 #include "nnexecutor.h"
@@ -56,6 +57,7 @@ public:
     size_t GetOnlineModelID() override;
     size_t GetLiteGraphModelId() override;
     bool IsOnlineModel() override;
+    OH_NN_ReturnCode GetMemoryStatistics(OH_NN_MemoryStatistics& statistics) const override;
 
     NNExecutor* CreateExecutor();
 
@@ -105,6 +107,10 @@ private:
     std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_outputTensorDescs;
     ExtensionConfig m_extensionConfig;
     size_t m_liteGraphModelId {0};
+    // Computed by Build, the loaded model is counted with it in the memory budget.
+    size_t m_modelSize {0};
+    // The built model counts as weights, the constant tensors sent to the device by the build as staging.
+    MemoryAccount m_memoryAccount {"compiler", this};
 };
 } // NeuralNetworkRuntime
 } // OHOS
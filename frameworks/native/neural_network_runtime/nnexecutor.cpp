@@ -15,9 +15,12 @@
 
 
 #include "nnexecutor.h"
+#include "async_run_pool.h"
+#include "auto_unload_tracker.h"
 #include "nntensor.h"
 #include "nncompiled_cache.h"
 #include "cpp_type.h"
+#include "memory_manager.h"
 #include "neural_network_runtime_inner.h"
 #include "nnrt_client.h"
 #include "log.h"
@@ -121,6 +124,36 @@ const size_t SIZE_OF_TENSOR_TYPE = sizeof(SerializedTensorDesc::m_tensorType);
 const size_t SIZE_OF_SHAPE_NUM = sizeof(SerializedTensorDesc::m_shapeNum);
 const std::vector<std::string> HIAI_PROCESS_LIST = {"app.hiai.vision", "app.hiai.voice"};
 
+enum class AsyncRunState {
+    PENDING,
+    RUNNING,
+    // The timeout has elapsed while the device was running, the worker delivers it once the device has returned.
+    TIMED_OUT,
+    DONE
+};
+
+// State shared by the worker running an asynchronous execution and the timer watching its timeout.
+// Whichever moves the state to DONE first owns the NN_OnRunDone callback, so it is called exactly once. The timer
+// only completes an execution which has not started, the tensors of the caller are in use by the device otherwise.
+struct AsyncRunContext {
+    std::vector<NN_Tensor*> inputTensors;
+    std::vector<NN_Tensor*> outputTensors;
+    void* userData {nullptr};
+    NN_OnRunDone onRunDone {nullptr};
+    NN_OnServiceDied onServiceDied {nullptr};
+    uint64_t timerId {0};
+    bool hasTimer {false};
+    // Steady clock microseconds when RunAsync was called.
+    int64_t submitTime {0};
+    bool isRunFinished {false};
+    std::atomic<AsyncRunState> state {AsyncRunState::PENDING};
+
+    bool TryTransfer(AsyncRunState from, AsyncRunState to)
+    {
+        return state.compare_exchange_strong(from, to);
+    }
+};
+
 uint64_t GenRandom(void)
 {
     uint64_t random = 0;
@@ -166,16 +199,10 @@ NNExecutor::NNExecutor(size_t backendID, std::shared_ptr<Device> device, std::sh
     m_performance(performance),
     m_priority(priority) {
         m_executorid = GenRandom();
-        m_autoUnloadRunner = OHOS::AppExecFwk::EventRunner::Create
-            ("nnexecutor_autounload" + std::to_string(m_executorid));
-        m_autoUnloadHandler = std::make_shared<OHOS::AppExecFwk::EventHandler>(m_autoUnloadRunner);
-        auto autoUnloadTask = [this]() {
+        AutoUnloadTracker::StoreNow(m_lastUsedTime);
+        m_autoUnloadId = AutoUnloadTracker::GetInstance()->Register(m_lastUsedTime, AUTOUNLOAD_TIME, [this]() {
             DeinitModel("DelayUnload");
-        };
-        if (m_autoUnloadHandler != nullptr) {
-            m_autoUnloadHandler->PostTask(autoUnloadTask,
-                "nnexecutor_autounload" + std::to_string(m_executorid), AUTOUNLOAD_TIME);
-        }
+        });
 
         GetModelID(m_originHiaiModelId);
     }
@@ -365,9 +392,9 @@ OH_NN_ReturnCode NNExecutor::SetExtensionConfig(const std::unordered_map<std::st
         }
 
         if (!config.first.compare("isNeedModelLatency")) {
-            m_executorConfig->isNeedModelLatency = static_cast<bool>(*configData);
+            m_executorConfig->isNeedModelLatency.store(static_cast<bool>(*configData));
             LOGD("[NNExecutor] SetExtensionConfig, isNeedModelLatency: %{public}d.",
-                m_executorConfig->isNeedModelLatency);
+                m_executorConfig->isNeedModelLatency.load());
         }
     }
 
@@ -379,16 +406,82 @@ ExecutorConfig* NNExecutor::GetExecutorConfig() const
     return m_executorConfig;
 }
 
+OH_NN_ReturnCode NNExecutor::GetStatistics(OH_NN_ExecutorStatistics& statistics) const
+{
+    m_queueLatency.GetStatistics(statistics.queue);
+    m_runLatency.GetStatistics(statistics.run);
+    m_postProcessLatency.GetStatistics(statistics.postProcess);
+    m_totalLatency.GetStatistics(statistics.total);
+    statistics.inputCopyCount = m_inputCopyCount.load(std::memory_order_relaxed);
+    statistics.inputCopyBytes = m_inputCopyBytes.load(std::memory_order_relaxed);
+    statistics.outputCopyCount = m_outputCopyCount.load(std::memory_order_relaxed);
+    statistics.outputCopyBytes = m_outputCopyBytes.load(std::memory_order_relaxed);
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode NNExecutor::GetMemoryStatistics(OH_NN_MemoryStatistics& statistics) const
+{
+    m_memoryAccount.GetStatistics(statistics);
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode NNExecutor::SetOutputAlias(size_t outputIndex, size_t inputIndex)
+{
+    if (outputIndex >= m_outputTensorDescs.size() || inputIndex >= m_inputTensorDescs.size()) {
+        LOGE("NNExecutor::SetOutputAlias failed, output %{public}zu or input %{public}zu is out of range.",
+            outputIndex, inputIndex);
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (m_aliasableInputs.empty()) {
+        LOGE("NNExecutor::SetOutputAlias failed, the graph of the compilation is unknown, outputs cannot alias.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    const std::vector<uint32_t>& aliasableInputs = m_aliasableInputs[outputIndex];
+    if (std::find(aliasableInputs.begin(), aliasableInputs.end(), inputIndex) == aliasableInputs.end()) {
+        LOGE("NNExecutor::SetOutputAlias failed, output %{public}zu may not overwrite input %{public}zu.",
+            outputIndex, inputIndex);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (m_outputAliases.empty()) {
+        m_outputAliases.assign(m_outputTensorDescs.size(), SIZE_MAX);
+    }
+    // Two outputs in one buffer would overwrite each other.
+    for (size_t i = 0; i < m_outputAliases.size(); ++i) {
+        if (i != outputIndex && m_outputAliases[i] == inputIndex) {
+            LOGE("NNExecutor::SetOutputAlias failed, input %{public}zu is aliased by output %{public}zu already.",
+                inputIndex, i);
+            return OH_NN_INVALID_PARAMETER;
+        }
+    }
+    m_outputAliases[outputIndex] = inputIndex;
+    return OH_NN_SUCCESS;
+}
+
 OH_NN_ReturnCode NNExecutor::SetOnRunDone(NN_OnRunDone onRunDone)
 {
-    LOGE("NNExecutor::SetOnRunDone failed, SetOnRunDone is not supported.");
-    return OH_NN_OPERATION_FORBIDDEN;
+    if (onRunDone == nullptr) {
+        LOGE("NNExecutor::SetOnRunDone failed, onRunDone is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::lock_guard<std::mutex> lock(m_asyncMutex);
+    m_onRunDone = onRunDone;
+    return OH_NN_SUCCESS;
 }
 
 OH_NN_ReturnCode NNExecutor::SetOnServiceDied(NN_OnServiceDied onServiceDied)
 {
-    LOGE("NNExecutor::SetOnServiceDied failed, SetOnServiceDied is not supported.");
-    return OH_NN_OPERATION_FORBIDDEN;
+    if (onServiceDied == nullptr) {
+        LOGE("NNExecutor::SetOnServiceDied failed, onServiceDied is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::lock_guard<std::mutex> lock(m_asyncMutex);
+    m_onServiceDied = onServiceDied;
+    return OH_NN_SUCCESS;
 }
 
 
@@ -405,7 +498,10 @@ OH_NN_ReturnCode NNExecutor::ReloadAippModel(uint32_t modelId)
         LOGW("GetModelID failed, some error happen when get model id for device.");
     }
 
-    _ret = ReinitScheduling(modelId, &m_executorConfig->isNeedModelLatency, m_cachePath.c_str());
+    // The scheduling service writes a plain bool, the runs read the flag concurrently.
+    bool needModelLatency = m_executorConfig->isNeedModelLatency.load();
+    _ret = ReinitScheduling(modelId, &needModelLatency, m_cachePath.c_str());
+    m_executorConfig->isNeedModelLatency.store(needModelLatency);
     if (_ret != OH_NN_SUCCESS) {
         LOGW("ReinitScheduling failed, some error happen when ReinitScheduling model.");
     }
@@ -475,11 +571,13 @@ OH_NN_ReturnCode NNExecutor::RunAippModel(NN_Tensor* inputTensors[], size_t inpu
 OH_NN_ReturnCode NNExecutor::RunSyncWithAipp(NN_Tensor* inputTensors[], size_t inputSize,
                                              NN_Tensor* outputTensors[], size_t outputSize, const char* aippStrings)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
     {
+        if (m_idleSince.load(std::memory_order_relaxed) != 0) {
+            RecordReturnedDemand();
+        }
         uint32_t modelId;
         GetModelID(modelId);
-        m_autoUnloadHandler->RemoveTask("nnexecutor_autounload" + std::to_string(m_executorid));
         if (m_inputTensorDescs.size() != inputSize) {
             LOGE("RunSyncWithAipp failed, inputSize:%{public}zu is not equal to model inputsize:%{public}zu",
                 inputSize, m_inputTensorDescs.size());
@@ -499,7 +597,7 @@ OH_NN_ReturnCode NNExecutor::RunSyncWithAipp(NN_Tensor* inputTensors[], size_t i
             }
         }
         
-        ret = CheckInputDimRanges(inputTensors, inputSize);
+        ret = CheckInputDimRanges(m_runContext, inputTensors, inputSize);
         if (ret != OH_NN_OPERATION_FORBIDDEN && ret != OH_NN_SUCCESS) {
             LOGE("RunSyncWithAipp failed, failed to check input dim ranges.");
             return ret;
@@ -510,11 +608,8 @@ OH_NN_ReturnCode NNExecutor::RunSyncWithAipp(NN_Tensor* inputTensors[], size_t i
             return ret;
         }
     }
-    auto autoUnloadTask = [this]() {
-        DeinitModel("DelayUnload");
-    };
-    m_autoUnloadHandler->PostTask(autoUnloadTask,
-        "nnexecutor_autounload" + std::to_string(m_executorid), AUTOUNLOAD_TIME);
+    // Restarts the idle period of the auto unload.
+    AutoUnloadTracker::StoreNow(m_lastUsedTime);
 
     return OH_NN_SUCCESS;
 }
@@ -641,6 +736,7 @@ OH_NN_ReturnCode NNExecutor::Reload()
 
     std::vector<Buffer> caches;
     compiledCache.SetModelName(m_extensionConfig.modelName);
+    compiledCache.SetMemoryAccount(&m_memoryAccount);
     size_t liteGraphModelId = 0;
     ret = compiledCache.Restore(m_cachePath, m_cacheVersion, caches, liteGraphModelId);
     if (ret != OH_NN_SUCCESS) {
@@ -681,6 +777,7 @@ OH_NN_ReturnCode NNExecutor::Reload()
     }
 
     compiledCache.ReleaseCacheBuffer(caches);
+    m_memoryAccount.AddShared(MemoryCategory::WEIGHTS, m_preparedModel.get(), m_modelSize);
 
     m_inputTensorDescs = inputTensorDescs;
     m_outputTensorDescs = outputTensorDescs;
@@ -691,11 +788,224 @@ OH_NN_ReturnCode NNExecutor::Reload()
 OH_NN_ReturnCode NNExecutor::RunSync(NN_Tensor* inputTensors[], size_t inputSize,
     NN_Tensor* outputTensors[], size_t outputSize)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    int64_t submitTime = LatencyHistogram::Now();
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
+    return RunInner(m_runContext, inputTensors, inputSize, outputTensors, outputSize, nullptr, false, submitTime);
+}
+
+OH_NN_ReturnCode NNExecutor::RunSyncInContext(ExecutionContext& context, NN_Tensor* inputTensors[], size_t inputSize,
+    NN_Tensor* outputTensors[], size_t outputSize)
+{
+    int64_t submitTime = LatencyHistogram::Now();
+    // The unloaded model is restored under the exclusive lock, the execution itself only needs the shared one.
+    while (true) {
+        {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            if (m_preparedModel != nullptr) {
+                return RunInner(context, inputTensors, inputSize, outputTensors, outputSize, nullptr, true,
+                    submitTime);
+            }
+        }
+
+        std::lock_guard<std::shared_mutex> lock(m_mutex);
+        if (m_preparedModel == nullptr && RestoreUnloadedModel() != OH_NN_SUCCESS) {
+            return OH_NN_INVALID_PARAMETER;
+        }
+    }
+}
+
+OH_NN_ReturnCode NNExecutor::RestoreUnloadedModel()
+{
+    int64_t reloadStartTime = AutoUnloadTracker::Now();
+    OH_NN_ReturnCode ret = Reload();
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+    if (m_extensionConfig.reloadPolicy == ReloadPolicy::PREDICTIVE) {
+        m_reloadPredictor.RecordReloadCost(AutoUnloadTracker::Now() - reloadStartTime);
+    }
+    AutoUnloadTracker::GetInstance()->SetLoaded(m_autoUnloadId, true);
+
+    uint32_t modelId;
+    auto _ret = GetModelID(modelId);
+    LOGI("AutoReload pid=%{public}ld originHiaiModelId=%{public}u hiaiModelId=%{public}u",
+        static_cast<long>(getpid()), m_originHiaiModelId, modelId);
+    if (_ret != OH_NN_SUCCESS) {
+        LOGW("GetModelID failed, some error happen when get model id for device.");
+    }
+    bool needModelLatency = m_executorConfig->isNeedModelLatency.load();
+    _ret = ReinitScheduling(modelId, &needModelLatency, m_cachePath.c_str());
+    m_executorConfig->isNeedModelLatency.store(needModelLatency);
+    if (_ret != OH_NN_SUCCESS) {
+        LOGW("ReinitScheduling failed, some error happen when ReinitScheduling model.");
+    }
+    _ret = SetDeinitModelCallBack();
+    if (_ret != OH_NN_SUCCESS) {
+        LOGW("SetDeinitModelCallBack failed, some error happen when ReinitScheduling model.");
+    }
+    return OH_NN_SUCCESS;
+}
+
+// Called with m_mutex held exclusively, right after the idle auto unload released the model.
+void NNExecutor::SchedulePredictiveReload()
+{
+    if (m_extensionConfig.reloadPolicy != ReloadPolicy::PREDICTIVE) {
+        return;
+    }
+
+    // A model reloaded by a wrong prediction and unloaded again keeps the idle period of its last execution.
+    int64_t idleSince = 0;
+    if (m_idleSince.compare_exchange_strong(idleSince, m_lastUsedTime.load(std::memory_order_relaxed))) {
+        idleSince = m_idleSince.load(std::memory_order_relaxed);
+    }
+
+    if (m_reloadPredictor.Schedule(idleSince) != OH_NN_SUCCESS) {
+        LOGW("SchedulePredictiveReload failed, the model will be reloaded on demand.");
+    }
+}
+
+// Invoked by m_reloadPredictor on a worker of the AsyncRunPool, never after CancelPredictiveReload().
+void NNExecutor::PredictiveReload()
+{
+    // Executions arriving meanwhile wait on m_mutex for this reload, instead of reloading by themselves.
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
+    if (m_preparedModel == nullptr && m_idleSince.load(std::memory_order_relaxed) != 0) {
+        if (RestoreUnloadedModel() == OH_NN_SUCCESS) {
+            // If the prediction was wrong, the model is unloaded again after another idle period.
+            AutoUnloadTracker::StoreNow(m_lastUsedTime);
+            LOGI("PredictiveReload pid=%{public}ld originHiaiModelId=%{public}u",
+                static_cast<long>(getpid()), m_originHiaiModelId);
+        } else {
+            LOGW("PredictiveReload failed, the model will be reloaded on demand.");
+        }
+    }
+}
+
+// Called before the prepared model is destroyed, also by the destructor. Returns after a reload which has started,
+// and no reload is scheduled afterwards.
+void NNExecutor::CancelPredictiveReload()
+{
+    m_reloadPredictor.Stop();
+}
+
+void NNExecutor::RecordReturnedDemand()
+{
+    int64_t idleSince = m_idleSince.exchange(0, std::memory_order_relaxed);
+    if (idleSince == 0) {
+        return;
+    }
+
+    m_reloadPredictor.RecordIdleGap(AutoUnloadTracker::Now() - idleSince);
+}
+
+namespace {
+// Whether the buffer of the output holds the dimensions reported by the device, byteSize is the size they need.
+OH_NN_ReturnCode CheckOutputBufferSize(const NNTensor2_0* nnTensor, const std::vector<int32_t>& dims,
+    size_t& byteSize, bool& isSufficient)
+{
+    byteSize = 0;
+    isSufficient = true;
+    if (dims.empty()) {
+        return OH_NN_SUCCESS;
+    }
+    TensorDesc* nnTensorDesc = nnTensor->GetTensorDesc();
+    if (nnTensorDesc == nullptr) {
+        LOGE("NNExecutor::RegrowOutputsAndRun failed, failed to get desc from tensor.");
+        return OH_NN_NULL_PTR;
+    }
+    TensorDesc reportedDesc = *nnTensorDesc;
+    OH_NN_ReturnCode ret = reportedDesc.SetShape(dims.data(), dims.size());
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+    ret = reportedDesc.GetByteSize(&byteSize);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+    isSufficient = (byteSize <= nnTensor->GetSize() - nnTensor->GetOffset());
+    return OH_NN_SUCCESS;
+}
+} // namespace
+
+// Output tensors created by NNRt whose buffer is smaller than the dimensions reported by the device are grown to
+// them, then the model is run once more. The buffer size is compared with the dimensions rather than relying on
+// isSufficientDataBuffer, which the devices of v2.x never fill. The data address of a grown tensor changes, so the
+// caller has to get it again with OH_NNTensor_GetDataBuffer.
+OH_NN_ReturnCode NNExecutor::RegrowOutputsAndRun(const std::vector<NN_Tensor*>& inputTensors,
+    const std::vector<NN_Tensor*>& outputTensors, std::vector<std::vector<int32_t>>& outputsDims,
+    std::vector<bool>& isSufficientDataBuffer)
+{
+    bool isRegrown = false;
+    for (size_t i = 0; i < outputsDims.size() && i < outputTensors.size(); ++i) {
+        NNTensor2_0* nnTensor = reinterpret_cast<NNTensor2_0*>(outputTensors[i]);
+        size_t byteSize {0};
+        bool isSufficient {true};
+        OH_NN_ReturnCode ret = CheckOutputBufferSize(nnTensor, outputsDims[i], byteSize, isSufficient);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("NNExecutor::RegrowOutputsAndRun failed, failed to get byte size of output[%{public}zu].", i);
+            return ret;
+        }
+        if (isSufficient) {
+            continue;
+        }
+
+        // The shape is only changed once the buffer holds it, a failed resize leaves the tensor as it was.
+        ret = nnTensor->ResizeData(byteSize);
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("NNExecutor::RegrowOutputsAndRun failed, failed to grow output[%{public}zu] to %{public}zu bytes.",
+                i, byteSize);
+            return ret;
+        }
+        ret = nnTensor->GetTensorDesc()->SetShape(outputsDims[i].data(), outputsDims[i].size());
+        if (ret != OH_NN_SUCCESS) {
+            LOGE("NNExecutor::RegrowOutputsAndRun failed, failed to set shape of output[%{public}zu].", i);
+            return ret;
+        }
+        isRegrown = true;
+    }
+    if (!isRegrown) {
+        return OH_NN_SUCCESS;
+    }
+
+    LOGI("NNExecutor::RegrowOutputsAndRun, output buffers are grown, run the model again.");
+    outputsDims.clear();
+    isSufficientDataBuffer.clear();
+    OH_NN_ReturnCode ret = m_preparedModel->Run(inputTensors, outputTensors, outputsDims, isSufficientDataBuffer);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+    for (size_t i = 0; i < outputsDims.size() && i < outputTensors.size(); ++i) {
+        size_t byteSize {0};
+        bool isSufficient {true};
+        ret = CheckOutputBufferSize(reinterpret_cast<NNTensor2_0*>(outputTensors[i]), outputsDims[i], byteSize,
+            isSufficient);
+        if (ret != OH_NN_SUCCESS || !isSufficient) {
+            LOGE("NNExecutor::RegrowOutputsAndRun failed, output[%{public}zu] is still not enough.", i);
+            return OH_NN_MEMORY_ERROR;
+        }
+    }
+    return OH_NN_SUCCESS;
+}
+
+// The caller holds m_mutex, exclusively unless isInContext. Under the shared lock of RunSyncInContext, RunInner only
+// writes the output tensors and the atomic or separately locked statistics, the executor state is left untouched.
+OH_NN_ReturnCode NNExecutor::RunInner(ExecutionContext& context, NN_Tensor* inputTensors[], size_t inputSize,
+    NN_Tensor* outputTensors[], size_t outputSize, AsyncRunContext* asyncContext, bool isInContext,
+    int64_t submitTime)
+{
+    int64_t startTime = LatencyHistogram::Now();
     {
+        // The asynchronous execution may have timed out while waiting in the queue or for the lock.
+        if (asyncContext != nullptr && !asyncContext->TryTransfer(AsyncRunState::PENDING, AsyncRunState::RUNNING)) {
+            LOGE("NNExecutor::RunAsync failed, execution timed out before it was started.");
+            return OH_NN_TIMEOUT;
+        }
+        if (m_idleSince.load(std::memory_order_relaxed) != 0) {
+            RecordReturnedDemand();
+        }
+
         uint32_t modelId;
         GetModelID(modelId);
-        m_autoUnloadHandler->RemoveTask("nnexecutor_autounload" + std::to_string(m_executorid));
         if (m_inputTensorDescs.size() != inputSize) {
             LOGE("NNExecutor::RunSync failed, inputSize:%{public}zu is not equal to model input size:%{public}zu",
                 inputSize, m_inputTensorDescs.size());
@@ -707,35 +1017,33 @@ OH_NN_ReturnCode NNExecutor::RunSync(NN_Tensor* inputTensors[], size_t inputSize
             return OH_NN_INVALID_PARAMETER;
         }
 
-        if (m_preparedModel == nullptr) {
-            if (Reload() != OH_NN_SUCCESS) {
-                return OH_NN_INVALID_PARAMETER;
-            }
-            auto _ret = GetModelID(modelId);
-            LOGI("AutoReload pid=%{public}ld originHiaiModelId=%{public}u hiaiModelId=%{public}u",
-                static_cast<long>(getpid()), m_originHiaiModelId, modelId);
-            if (_ret != OH_NN_SUCCESS) {
-                LOGW("GetModelID failed, some error happen when get model id for device.");
-            }
-            _ret = ReinitScheduling(modelId, &m_executorConfig->isNeedModelLatency, m_cachePath.c_str());
-            if (_ret != OH_NN_SUCCESS) {
-                LOGW("ReinitScheduling failed, some error happen when ReinitScheduling model.");
-            }
-            _ret = SetDeinitModelCallBack();
-            if (_ret != OH_NN_SUCCESS) {
-                LOGW("SetDeinitModelCallBack failed, some error happen when ReinitScheduling model.");
-            }
+        // RunSyncInContext restores the unloaded model under the exclusive lock before it runs.
+        if (m_preparedModel == nullptr && (isInContext || RestoreUnloadedModel() != OH_NN_SUCCESS)) {
+            return OH_NN_INVALID_PARAMETER;
         }
 
         OH_NN_ReturnCode ret {OH_NN_FAILED};
-        ret = CheckInputDimRanges(inputTensors, inputSize);
+        ret = CheckInputDimRanges(context, inputTensors, inputSize);
         if (ret != OH_NN_OPERATION_FORBIDDEN && ret != OH_NN_SUCCESS) {
             LOGE("NNExecutor::RunSync failed, failed to check input dim ranges.");
             return ret;
         }
 
-        OHOS::NeuralNetworkRuntime::IOTensor tensor;
-        std::vector<NN_Tensor*> inputTensorsVec;
+        // Cleared rather than released, a context which ran before keeps the capacity of its vectors. The dimensions
+        // of each output are cleared in place, a device which reports none of them fails the run below.
+        std::vector<NN_Tensor*>& inputTensorsVec = context.inputTensors;
+        std::vector<NN_Tensor*>& outputTensorsVec = context.outputTensors;
+        std::vector<std::vector<int32_t>>& outputsDims = context.outputsDims;
+        std::vector<bool>& isSufficientDataBuffer = context.isSufficientDataBuffer;
+        inputTensorsVec.clear();
+        outputTensorsVec.clear();
+        inputTensorsVec.reserve(inputSize);
+        outputTensorsVec.reserve(outputSize);
+        for (auto& dims : outputsDims) {
+            dims.clear();
+        }
+        isSufficientDataBuffer.clear();
+
         for (size_t i = 0; i < inputSize; ++i) {
             if (inputTensors[i] == nullptr) {
                 LOGE("NNExecutor::RunSync failed, input[%{public}zu] is nullptr.", i);
@@ -745,7 +1053,6 @@ OH_NN_ReturnCode NNExecutor::RunSync(NN_Tensor* inputTensors[], size_t inputSize
             inputTensorsVec.emplace_back(inputTensors[i]);
         }
 
-        std::vector<NN_Tensor*> outputTensorsVec;
         for (size_t i = 0; i < outputSize; ++i) {
             if (outputTensors[i] == nullptr) {
                 LOGE("NNExecutor::RunSync failed, output[%{public}zu] is nullptr.", i);
@@ -754,14 +1061,31 @@ OH_NN_ReturnCode NNExecutor::RunSync(NN_Tensor* inputTensors[], size_t inputSize
             outputTensorsVec.emplace_back(outputTensors[i]);
         }
 
-        std::vector<std::vector<int32_t>> outputsDims;
-        std::vector<bool> isSufficientDataBuffer;
+        ret = CheckOutputAliases(inputTensors, outputTensors);
+        if (ret != OH_NN_SUCCESS) {
+            return ret;
+        }
 
+        int64_t runStartTime = LatencyHistogram::Now();
         ret = m_preparedModel->Run(inputTensorsVec, outputTensorsVec, outputsDims, isSufficientDataBuffer);
+        if (ret == OH_NN_SUCCESS && m_extensionConfig.isOutputRegrowEnabled) {
+            ret = RegrowOutputsAndRun(inputTensorsVec, outputTensorsVec, outputsDims, isSufficientDataBuffer);
+        }
         if (ret != OH_NN_SUCCESS) {
             LOGE("NNExecutor::RunSync failed, failed to run in prepared model.");
             return ret;
         }
+        int64_t runEndTime = LatencyHistogram::Now();
+        m_runLatency.Record(runEndTime - runStartTime);
+
+        // Timed out while the device was running, the outputs are discarded and the timeout is delivered instead.
+        if (asyncContext != nullptr && !asyncContext->TryTransfer(AsyncRunState::RUNNING, AsyncRunState::DONE)) {
+            LOGE("NNExecutor::RunAsync failed, execution timed out, outputs are discarded.");
+            return OH_NN_TIMEOUT;
+        }
+        if (asyncContext != nullptr) {
+            asyncContext->isRunFinished = true;
+        }
 
         // Set the output NNTensor2_0's dimensions from output IOTensor if it is dynamic.
         // NNTensor2_0::SetDimensions will check if the tensor buffer is enough for the new dimensions.
@@ -782,6 +1106,9 @@ OH_NN_ReturnCode NNExecutor::RunSync(NN_Tensor* inputTensors[], size_t inputSize
                     " output id: %zu.", i);
                 return ret;
             }
+            if (isInContext) {
+                continue;
+            }
             ret = m_outputTensorDescs[i].first->SetShape(outputsDims[i].data(), outputsDims[i].size());
             if (ret != OH_NN_SUCCESS) {
                 LOGE("NNExecutor::RunSync failed, error happened when setting inner output tensor's dimensions,"
@@ -789,12 +1116,14 @@ OH_NN_ReturnCode NNExecutor::RunSync(NN_Tensor* inputTensors[], size_t inputSize
                 return ret;
             }
         }
+
+        int64_t endTime = LatencyHistogram::Now();
+        m_queueLatency.Record(startTime - submitTime);
+        m_postProcessLatency.Record(endTime - runEndTime);
+        m_totalLatency.Record(endTime - submitTime);
     }
-    auto autoUnloadTask = [this]() {
-        DeinitModel("DelayUnload");
-    };
-    m_autoUnloadHandler->PostTask(autoUnloadTask,
-        "nnexecutor_autounload" + std::to_string(m_executorid), AUTOUNLOAD_TIME);
+    // Restarts the idle period of the auto unload.
+    AutoUnloadTracker::StoreNow(m_lastUsedTime);
 
     return OH_NN_SUCCESS;
 }
@@ -802,8 +1131,127 @@ OH_NN_ReturnCode NNExecutor::RunSync(NN_Tensor* inputTensors[], size_t inputSize
 OH_NN_ReturnCode NNExecutor::RunAsync(NN_Tensor* inputTensors[], size_t inputSize,
     NN_Tensor* outputTensors[], size_t outputSize, int32_t timeout, void* userData)
 {
-    LOGE("NNExecutor::RunAsync failed, RunAsync is not supported.");
-    return OH_NN_OPERATION_FORBIDDEN;
+    if (m_inputTensorDescs.size() != inputSize) {
+        LOGE("NNExecutor::RunAsync failed, inputSize:%{public}zu is not equal to model input size:%{public}zu",
+            inputSize, m_inputTensorDescs.size());
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (m_outputTensorDescs.size() != outputSize) {
+        LOGE("NNExecutor::RunAsync failed, outputSize:%{public}zu is not equal to model output size:%{public}zu",
+            outputSize, m_outputTensorDescs.size());
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (timeout <= 0) {
+        LOGE("NNExecutor::RunAsync failed, timeout:%{public}d must be greater than 0.", timeout);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    std::shared_ptr<AsyncRunContext> asyncContext = CreateSharedPtr<AsyncRunContext>();
+    if (asyncContext == nullptr) {
+        LOGE("NNExecutor::RunAsync failed, failed to create async run context.");
+        return OH_NN_MEMORY_ERROR;
+    }
+    for (size_t i = 0; i < inputSize; ++i) {
+        if (inputTensors[i] == nullptr) {
+            LOGE("NNExecutor::RunAsync failed, input[%{public}zu] is nullptr.", i);
+            return OH_NN_INVALID_PARAMETER;
+        }
+        asyncContext->inputTensors.emplace_back(inputTensors[i]);
+    }
+    for (size_t i = 0; i < outputSize; ++i) {
+        if (outputTensors[i] == nullptr) {
+            LOGE("NNExecutor::RunAsync failed, output[%{public}zu] is nullptr.", i);
+            return OH_NN_INVALID_PARAMETER;
+        }
+        asyncContext->outputTensors.emplace_back(outputTensors[i]);
+    }
+    asyncContext->userData = userData;
+    asyncContext->submitTime = LatencyHistogram::Now();
+
+    {
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+        if (m_onRunDone == nullptr) {
+            LOGE("NNExecutor::RunAsync failed, please set NN_OnRunDone by OH_NNExecutor_SetOnRunDone first.");
+            return OH_NN_OPERATION_FORBIDDEN;
+        }
+        asyncContext->onRunDone = m_onRunDone;
+        asyncContext->onServiceDied = m_onServiceDied;
+        ++m_asyncRunNum;
+    }
+
+    // The timer only touches the context, it may fire after the worker has finished and the executor is gone.
+    AsyncRunPool* asyncRunPool = AsyncRunPool::GetInstance();
+    auto timeoutTask = [asyncContext]() {
+        if (asyncContext->TryTransfer(AsyncRunState::PENDING, AsyncRunState::DONE)) {
+            LOGE("NNExecutor::RunAsync failed, execution timed out before it was started.");
+            asyncContext->onRunDone(asyncContext->userData, OH_NN_TIMEOUT, nullptr, 0);
+            return;
+        }
+        asyncContext->TryTransfer(AsyncRunState::RUNNING, AsyncRunState::TIMED_OUT);
+    };
+    OH_NN_ReturnCode ret = asyncRunPool->PostTimerTask(timeoutTask, timeout, asyncContext->timerId);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("NNExecutor::RunAsync failed, failed to post timeout task.");
+        FinishAsyncRun();
+        return ret;
+    }
+    asyncContext->hasTimer = true;
+
+    ret = asyncRunPool->PostTask([this, asyncContext]() { RunAsyncTask(asyncContext); });
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("NNExecutor::RunAsync failed, failed to post execution task.");
+        asyncRunPool->RemoveTimerTask(asyncContext->timerId);
+        FinishAsyncRun();
+        return ret;
+    }
+
+    return OH_NN_SUCCESS;
+}
+
+void NNExecutor::RunAsyncTask(const std::shared_ptr<AsyncRunContext>& asyncContext)
+{
+    OH_NN_ReturnCode ret {OH_NN_FAILED};
+    {
+        std::lock_guard<std::shared_mutex> lock(m_mutex);
+        ret = RunInner(m_runContext, asyncContext->inputTensors.data(), asyncContext->inputTensors.size(),
+            asyncContext->outputTensors.data(), asyncContext->outputTensors.size(), asyncContext.get(), false,
+            asyncContext->submitTime);
+    }
+    if (asyncContext->hasTimer) {
+        AsyncRunPool::GetInstance()->RemoveTimerTask(asyncContext->timerId);
+    }
+
+    // An execution which failed or timed out while running never reached DONE inside RunInner, the device has
+    // returned by now, so its callback is delivered here.
+    bool needCallback = asyncContext->isRunFinished ||
+        asyncContext->TryTransfer(AsyncRunState::PENDING, AsyncRunState::DONE) ||
+        asyncContext->TryTransfer(AsyncRunState::RUNNING, AsyncRunState::DONE) ||
+        asyncContext->TryTransfer(AsyncRunState::TIMED_OUT, AsyncRunState::DONE);
+
+    // Callbacks only use the context, so that the executor can be destroyed inside them.
+    FinishAsyncRun();
+    if (!needCallback) {
+        return;
+    }
+    if (ret == OH_NN_UNAVAILABLE_DEVICE && asyncContext->onServiceDied != nullptr) {
+        asyncContext->onServiceDied(asyncContext->userData);
+    }
+    if (ret == OH_NN_SUCCESS) {
+        asyncContext->onRunDone(asyncContext->userData, ret,
+            reinterpret_cast<void**>(asyncContext->outputTensors.data()),
+            static_cast<int32_t>(asyncContext->outputTensors.size()));
+    } else {
+        asyncContext->onRunDone(asyncContext->userData, ret, nullptr, 0);
+    }
+}
+
+void NNExecutor::FinishAsyncRun()
+{
+    std::lock_guard<std::mutex> lock(m_asyncMutex);
+    --m_asyncRunNum;
+    if (m_asyncRunNum == 0) {
+        m_asyncCv.notify_all();
+    }
 }
 
 OH_NN_ReturnCode NNExecutor::GetModelID(uint32_t& modelId) const
@@ -825,10 +1273,11 @@ size_t NNExecutor::GetBackendID()
     return m_backendID;
 }
 
-OH_NN_ReturnCode NNExecutor::CheckInputDimRanges(NN_Tensor* inputTensors[], size_t inputSize)
+OH_NN_ReturnCode NNExecutor::CheckInputDimRanges(ExecutionContext& context, NN_Tensor* inputTensors[],
+    size_t inputSize)
 {
-    std::vector<std::vector<uint32_t>> minInputDims;
-    std::vector<std::vector<uint32_t>> maxInputDims;
+    std::vector<std::vector<uint32_t>>& minInputDims = context.minInputDims;
+    std::vector<std::vector<uint32_t>>& maxInputDims = context.maxInputDims;
     OH_NN_ReturnCode oldRet = m_preparedModel->GetInputDimRanges(minInputDims, maxInputDims);
     if (oldRet != OH_NN_SUCCESS) {
         return OH_NN_OPERATION_FORBIDDEN;
@@ -866,6 +1315,52 @@ OH_NN_ReturnCode NNExecutor::CheckInputDimRanges(NN_Tensor* inputTensors[], size
     return OH_NN_SUCCESS;
 }
 
+namespace {
+bool IsSameBuffer(const NNTensor2_0* a, const NNTensor2_0* b)
+{
+    return (a->GetData() != nullptr && a->GetData() == b->GetData()) ||
+        (a->GetFd() >= 0 && a->GetFd() == b->GetFd() && a->GetOffset() == b->GetOffset());
+}
+
+bool IsOverlapped(const NNTensor2_0* a, const NNTensor2_0* b)
+{
+    const uint8_t* aData = static_cast<const uint8_t*>(a->GetData());
+    const uint8_t* bData = static_cast<const uint8_t*>(b->GetData());
+    if (aData != nullptr && bData != nullptr && aData < bData + b->GetSize() && bData < aData + a->GetSize()) {
+        return true;
+    }
+    // Tensors created from one fd may map it at different addresses.
+    return a->GetFd() >= 0 && a->GetFd() == b->GetFd() && a->GetOffset() < b->GetOffset() + b->GetSize() &&
+        b->GetOffset() < a->GetOffset() + a->GetSize();
+}
+} // namespace
+
+OH_NN_ReturnCode NNExecutor::CheckOutputAliases(NN_Tensor* inputTensors[], NN_Tensor* outputTensors[]) const
+{
+    // Overlaps are left to the caller as they were before the aliases, until one is declared on this executor.
+    if (m_outputAliases.empty()) {
+        return OH_NN_SUCCESS;
+    }
+
+    for (size_t i = 0; i < m_outputTensorDescs.size(); ++i) {
+        const NNTensor2_0* output = reinterpret_cast<const NNTensor2_0*>(outputTensors[i]);
+        for (size_t j = 0; j < m_inputTensorDescs.size(); ++j) {
+            const NNTensor2_0* input = reinterpret_cast<const NNTensor2_0*>(inputTensors[j]);
+            if (!IsOverlapped(output, input)) {
+                continue;
+            }
+            // A declared alias shares the whole buffer, an element is only overwritten after it has been read.
+            bool isDeclared = i < m_outputAliases.size() && m_outputAliases[i] == j;
+            if (!isDeclared || !IsSameBuffer(output, input)) {
+                LOGE("NNExecutor::RunSync failed, output %{public}zu overlaps input %{public}zu, declare the alias "
+                     "with OH_NNExecutor_SetOutputAlias to pass one tensor as both.", i, j);
+                return OH_NN_INVALID_PARAMETER;
+            }
+        }
+    }
+    return OH_NN_SUCCESS;
+}
+
 bool NNExecutor::CompareAttribute(
     const std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>& tensorDesc, const NNTensor& tensor) const
 {
@@ -970,6 +1465,8 @@ OH_NN_ReturnCode NNExecutor::SetInputTensorWithCurrentBuffer(uint32_t index,
              "Error code: %d.", status);
         return OH_NN_MEMORY_ERROR;
     }
+    m_inputCopyCount.fetch_add(1, std::memory_order_relaxed);
+    m_inputCopyBytes.fetch_add(dataLength, std::memory_order_relaxed);
 
     // Set the new tensor with the buffer of current tensor
     inputTensor->SetBuffer(curBuffer, curBufferLength);
@@ -992,6 +1489,7 @@ void NNExecutor::SetInputTensorWithNewBuffer(uint32_t index,
         if (m_inputTensors[index].isInnerMem) {
             void* curBuffer = m_inputTensors[index].tensor->GetBuffer();
             m_device->ReleaseBuffer(curBuffer);
+            m_memoryAccount.Sub(MemoryCategory::STAGING, m_inputTensors[index].tensor->GetBufferLength());
         }
         // Set current tensor's buffer to nullptr in case the NNTensor release the driver memory in destruction.
         m_inputTensors[index].tensor->SetBuffer(nullptr, 0);
@@ -999,6 +1497,9 @@ void NNExecutor::SetInputTensorWithNewBuffer(uint32_t index,
 
     // Set new input tensor data buffer
     inputTensor->SetBuffer(inputBuffer, length);
+    if (isInnerMem) {
+        m_memoryAccount.Add(MemoryCategory::STAGING, length);
+    }
 
     // Create or update the input tensor
     ExeTensor exeTensor{inputTensor, nullptr, 0, isInnerMem};
@@ -1056,6 +1557,12 @@ OH_NN_ReturnCode NNExecutor::CheckInputDimRanges(uint32_t index, const OH_NN_Ten
 
 OH_NN_ReturnCode NNExecutor::SetInput(uint32_t index, const OH_NN_Tensor& nnTensor, const void* buffer, size_t length)
 {
+    // A registered buffer is shared with the device directly, like the memory of SetInputFromMemory().
+    if (IsRegisteredBuffer(buffer, length)) {
+        OH_NN_Memory memory {const_cast<void*>(buffer), length};
+        return SetInputFromMemory(index, nnTensor, memory);
+    }
+
     auto nnRet = CheckInputDimRanges(index, nnTensor);
     if (nnRet == OH_NN_OPERATION_FORBIDDEN) {
         LOGI("Skip input dimension bounds check.");
@@ -1120,6 +1627,8 @@ OH_NN_ReturnCode NNExecutor::SetInput(uint32_t index, const OH_NN_Tensor& nnTens
         m_device->ReleaseBuffer(inputBuffer);
         return OH_NN_MEMORY_ERROR;
     }
+    m_inputCopyCount.fetch_add(1, std::memory_order_relaxed);
+    m_inputCopyBytes.fetch_add(dataLength, std::memory_order_relaxed);
 
     SetInputTensorWithNewBuffer(index, inputTensor, inputBuffer, length, true);
     m_isRun = false;
@@ -1211,6 +1720,12 @@ std::shared_ptr<NNTensor> NNExecutor::BuildNNTensorFromDesc(
 
 OH_NN_ReturnCode NNExecutor::SetOutput(uint32_t index, void* buffer, size_t length)
 {
+    // The device writes into a registered buffer directly, Run() has nothing to copy back.
+    if (IsRegisteredBuffer(buffer, length)) {
+        OH_NN_Memory memory {buffer, length};
+        return SetOutputFromMemory(index, memory);
+    }
+
     if (index >= m_outputTensorDescs.size()) {
         LOGE("SetOutput failed, output index is out of range.");
         return OH_NN_INVALID_PARAMETER;
@@ -1248,6 +1763,7 @@ OH_NN_ReturnCode NNExecutor::SetOutput(uint32_t index, void* buffer, size_t leng
                 // release current device buffer and then allocate a new one below.
                 void* curBuffer = m_outputTensors[index].tensor->GetBuffer();
                 m_device->ReleaseBuffer(curBuffer);
+                m_memoryAccount.Sub(MemoryCategory::STAGING, curBufferLength);
             }
         }
     } else {
@@ -1268,6 +1784,7 @@ OH_NN_ReturnCode NNExecutor::SetOutput(uint32_t index, void* buffer, size_t leng
     }
 
     m_outputTensors[index].tensor->SetBuffer(deviceOutputBuffer, length);
+    m_memoryAccount.Add(MemoryCategory::STAGING, length);
     m_outputTensors[index].userBuffer = buffer;
     m_outputTensors[index].userBufferLength = length;
     m_outputTensors[index].isInnerMem = true;
@@ -1303,6 +1820,7 @@ OH_NN_ReturnCode NNExecutor::SetOutputFromMemory(uint32_t index, const OH_NN_Mem
             // If it is inner buffer, releate it
             void* curBuffer = m_outputTensors[index].tensor->GetBuffer();
             m_device->ReleaseBuffer(curBuffer);
+            m_memoryAccount.Sub(MemoryCategory::STAGING, m_outputTensors[index].tensor->GetBufferLength());
         }
     } else {
         // If output tensor does not exist, create a new null output tensor.
@@ -1351,6 +1869,7 @@ OH_NN_ReturnCode NNExecutor::CreateInputMemory(uint32_t index, size_t length, OH
 
     // Save the buffer address for check when destroying it.
     m_inputCreatedMem[index].emplace_back(deviceInputBuffer);
+    m_memoryAccount.Add(MemoryCategory::IO_TENSORS, length);
 
     return OH_NN_SUCCESS;
 }
@@ -1382,6 +1901,7 @@ OH_NN_ReturnCode NNExecutor::DestroyInputMemory(uint32_t index, OH_NN_Memory** m
     }
 
     inputCreatedMem.erase(pos);
+    m_memoryAccount.Sub(MemoryCategory::IO_TENSORS, (*memory)->length);
     delete *memory;
     *memory = nullptr;
 
@@ -1416,6 +1936,7 @@ OH_NN_ReturnCode NNExecutor::CreateOutputMemory(uint32_t index, size_t length, O
 
     // Save the buffer address for check when destroying it.
     m_outputCreatedMem[index].emplace_back(deviceOutputBuffer);
+    m_memoryAccount.Add(MemoryCategory::IO_TENSORS, length);
 
     return OH_NN_SUCCESS;
 }
@@ -1447,12 +1968,66 @@ OH_NN_ReturnCode NNExecutor::DestroyOutputMemory(uint32_t index, OH_NN_Memory**
     }
 
     outputCreatedMem.erase(pos);
+    m_memoryAccount.Sub(MemoryCategory::IO_TENSORS, (*memory)->length);
     delete *memory;
     *memory = nullptr;
 
     return OH_NN_SUCCESS;
 }
 
+OH_NN_ReturnCode NNExecutor::RegisterBuffer(void* buffer, size_t length, int fd)
+{
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
+    if (m_registeredBuffers.find(buffer) != m_registeredBuffers.end()) {
+        LOGE("RegisterBuffer failed, the buffer has been registered.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    // The buffer has been mapped from fd by the user, the device reaches it through the fd without any copy.
+    auto ret = MemoryManager::GetInstance()->ImportMemory(fd, buffer, length);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("RegisterBuffer failed, failed to import the buffer.");
+        return ret;
+    }
+
+    m_registeredBuffers[buffer] = length;
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode NNExecutor::UnregisterBuffer(void* buffer)
+{
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
+    if (m_registeredBuffers.find(buffer) == m_registeredBuffers.end()) {
+        LOGE("UnregisterBuffer failed, the buffer has not been registered.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    auto isSetToTensor = [buffer](const std::pair<const int, ExeTensor>& exeTensor) {
+        return !exeTensor.second.isInnerMem && exeTensor.second.tensor->GetBuffer() == buffer;
+    };
+    if (std::any_of(m_inputTensors.begin(), m_inputTensors.end(), isSetToTensor) ||
+        std::any_of(m_outputTensors.begin(), m_outputTensors.end(), isSetToTensor)) {
+        LOGE("UnregisterBuffer failed, the buffer is still set to an input or output.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    auto ret = MemoryManager::GetInstance()->RemoveImportedMemory(buffer);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("UnregisterBuffer failed, failed to remove the imported buffer.");
+        return ret;
+    }
+
+    m_registeredBuffers.erase(buffer);
+    return OH_NN_SUCCESS;
+}
+
+bool NNExecutor::IsRegisteredBuffer(const void* buffer, size_t length) const
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto iter = m_registeredBuffers.find(buffer);
+    return iter != m_registeredBuffers.end() && length <= iter->second;
+}
+
 OH_NN_ReturnCode NNExecutor::Run(const std::vector<std::shared_ptr<NNTensor>>& inputTensors,
     std::vector<std::shared_ptr<NNTensor>>& outputTensors)
 {
@@ -1556,6 +2131,8 @@ OH_NN_ReturnCode NNExecutor::Run()
                 LOGE("Run failed, memory copy from device buffer to user buffer failed. Error code: %d.", status);
                 return OH_NN_MEMORY_ERROR;
             }
+            m_outputCopyCount.fetch_add(1, std::memory_order_relaxed);
+            m_outputCopyBytes.fetch_add(size, std::memory_order_relaxed);
         }
     }
 
@@ -1565,9 +2142,19 @@ OH_NN_ReturnCode NNExecutor::Run()
 
 NNExecutor::~NNExecutor()
 {
+    AutoUnloadTracker::GetInstance()->Unregister(m_autoUnloadId);
+    CancelPredictiveReload();
+
+    {
+        // Pending asynchronous executions still reference this executor.
+        std::unique_lock<std::mutex> lock(m_asyncMutex);
+        m_asyncCv.wait(lock, [this] { return m_asyncRunNum == 0; });
+    }
+
     for (auto& it : m_inputTensors) {
         if ((it.second).isInnerMem) {
             m_device->ReleaseBuffer((it.second).tensor->GetBuffer());
+            m_memoryAccount.Sub(MemoryCategory::STAGING, (it.second).tensor->GetBufferLength());
         }
         (it.second).tensor->SetBuffer(nullptr, 0);
         (it.second).tensor.reset();
@@ -1578,6 +2165,7 @@ NNExecutor::~NNExecutor()
     for (auto& it : m_outputTensors) {
         if ((it.second).isInnerMem) {
             m_device->ReleaseBuffer((it.second).tensor->GetBuffer());
+            m_memoryAccount.Sub(MemoryCategory::STAGING, (it.second).tensor->GetBufferLength());
         }
         (it.second).tensor->SetBuffer(nullptr, 0);
         (it.second).tensor.reset();
@@ -1595,6 +2183,15 @@ NNExecutor::~NNExecutor()
     }
     m_outputCreatedMem.clear();
 
+    for (auto& it : m_registeredBuffers) {
+        MemoryManager::GetInstance()->RemoveImportedMemory(it.first);
+    }
+    m_registeredBuffers.clear();
+
+    if (m_preparedModel != nullptr) {
+        m_memoryAccount.SubShared(m_preparedModel.get());
+    }
+
     if (m_executorConfig != nullptr) {
         delete m_executorConfig;
         m_executorConfig = nullptr;
@@ -1612,22 +2209,49 @@ NNExecutor::~NNExecutor()
 
 OH_NN_ReturnCode NNExecutor::DestroyPreparedModel()
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-
-    if (m_autoUnloadHandler != nullptr) {
-        m_autoUnloadHandler->RemoveTask("nnexecutor_autounload" + std::to_string(m_executorid));
-        m_autoUnloadHandler.reset();
-    }
+    // Before locking, the auto unload callback may be waiting for the lock.
+    AutoUnloadTracker::GetInstance()->Unregister(m_autoUnloadId);
+    CancelPredictiveReload();
 
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
     if (m_preparedModel == nullptr) {
         LOGE("DestroyPreparedModel failed, m_preparedModel is nullptr.");
         return OH_NN_INVALID_PARAMETER;
     }
 
+    m_memoryAccount.SubShared(m_preparedModel.get());
     m_preparedModel.reset();
     return OH_NN_SUCCESS;
 }
 
+void NNExecutor::SetAliasableInputs(std::vector<std::vector<uint32_t>>&& aliasableInputs)
+{
+    if (aliasableInputs.size() != m_outputTensorDescs.size()) {
+        LOGW("SetAliasableInputs skipped, the graph has %{public}zu outputs but the executor has %{public}zu.",
+            aliasableInputs.size(), m_outputTensorDescs.size());
+        return;
+    }
+    m_aliasableInputs = std::move(aliasableInputs);
+}
+
+void NNExecutor::TrackModelMemory(size_t modelSize)
+{
+    if (modelSize == 0) {
+        LOGD("TrackModelMemory skipped, the model size is unknown.");
+        return;
+    }
+
+    // The prepared model is shared with the compilation, the process counts its weights once.
+    m_modelSize = modelSize;
+    m_memoryAccount.AddShared(MemoryCategory::WEIGHTS, m_preparedModel.get(), modelSize);
+
+    AutoUnloadTracker::GetInstance()->TrackMemory(m_autoUnloadId, modelSize, [this]() {
+        DeinitModel("BudgetUnload");
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return m_preparedModel == nullptr;
+    });
+}
+
 OH_NN_ReturnCode NNExecutor::SetDeinitModelCallBack()
 {
     NNRtServiceApi& nnrtService = NNRtServiceApi::GetInstance();
@@ -1852,7 +2476,7 @@ bool NNExecutor::DeinitModel(std::string mode)
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
 
     if (m_preparedModel != nullptr &&
         OH_NNModel_HasCache(m_cachePath.c_str(),
@@ -1868,22 +2492,25 @@ bool NNExecutor::DeinitModel(std::string mode)
         if (_ret != OH_NN_SUCCESS) {
             LOGW("DeinitScheduling failed, some error happen when DeinitScheduling model.");
         }
+        m_memoryAccount.SubShared(m_preparedModel.get());
         m_preparedModel.reset();
+        AutoUnloadTracker::GetInstance()->SetLoaded(m_autoUnloadId, false);
         if (mode == "FrozenDeinit") {
-            if (m_autoUnloadHandler != nullptr) {
-                m_autoUnloadHandler->RemoveTask("nnexecutor_autounload" + std::to_string(m_executorid));
-                LOGI("FrozenDeinit pid=%{public}ld originHiaiModelId=%{public}u hiaiModelId=%{public}u",
-                    static_cast<long>(getpid()), m_originHiaiModelId, modelId);
-            }
+            AutoUnloadTracker::GetInstance()->Suppress(m_autoUnloadId);
+            LOGI("FrozenDeinit pid=%{public}ld originHiaiModelId=%{public}u hiaiModelId=%{public}u",
+                static_cast<long>(getpid()), m_originHiaiModelId, modelId);
         } else if (mode == "HiaiAutoUnload") {
-            if (m_autoUnloadHandler != nullptr) {
-                m_autoUnloadHandler->RemoveTask("nnexecutor_autounload" + std::to_string(m_executorid));
-                LOGI("HiaiAutoUnload pid=%{public}ld originHiaiModelId=%{public}u hiaiModelId=%{public}u",
-                    static_cast<long>(getpid()), m_originHiaiModelId, modelId);
-            }
+            AutoUnloadTracker::GetInstance()->Suppress(m_autoUnloadId);
+            LOGI("HiaiAutoUnload pid=%{public}ld originHiaiModelId=%{public}u hiaiModelId=%{public}u",
+                static_cast<long>(getpid()), m_originHiaiModelId, modelId);
+        } else if (mode == "BudgetUnload") {
+            // Not reloaded predictively, it would exceed the memory budget again.
+            LOGI("BudgetUnload pid=%{public}ld originHiaiModelId=%{public}u hiaiModelId=%{public}u",
+                static_cast<long>(getpid()), m_originHiaiModelId, modelId);
         } else {
             LOGI("AutoUnload pid=%{public}ld originHiaiModelId=%{public}u hiaiModelId=%{public}u",
                 static_cast<long>(getpid()), m_originHiaiModelId, modelId);
+            SchedulePredictiveReload();
         }
     }
 
@@ -16,19 +16,24 @@
 #ifndef NEURAL_NETWORK_RUNTIME_NNEXECUTOR_H
 #define NEURAL_NETWORK_RUNTIME_NNEXECUTOR_H
 
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
+#include <shared_mutex>
 #include "executor.h"
 #include "device.h"
+#include "latency_histogram.h"
+#include "memory_account.h"
 #include "prepared_model.h"
+#include "reload_predictor.h"
 #include "nn_tensor.h"
 #include "log.h"
 
-#include "event_handler.h"
-#include "event_runner.h"
-
 #include <chrono>
 namespace OHOS {
 namespace NeuralNetworkRuntime {
+struct AsyncRunContext;
+
 class NNExecutor : public Executor {
 public:
     NNExecutor(size_t backendID,
@@ -68,10 +73,18 @@ public:
                               size_t outputSize,
                               int32_t timeout,
                               void* userData) override;
+    OH_NN_ReturnCode RunSyncInContext(ExecutionContext& context,
+                                      NN_Tensor* inputTensors[],
+                                      size_t inputSize,
+                                      NN_Tensor* outputTensors[],
+                                      size_t outputSize) override;
     OH_NN_ReturnCode GetModelID(uint32_t& modelId) const override;
     size_t GetBackendID() override;
     OH_NN_ReturnCode SetExtensionConfig(const std::unordered_map<std::string, std::vector<char>>& configs) override;
     ExecutorConfig* GetExecutorConfig() const override;
+    OH_NN_ReturnCode GetStatistics(OH_NN_ExecutorStatistics& statistics) const override;
+    OH_NN_ReturnCode GetMemoryStatistics(OH_NN_MemoryStatistics& statistics) const override;
+    OH_NN_ReturnCode SetOutputAlias(size_t outputIndex, size_t inputIndex) override;
 
     // The following APIs are compatible with older versions
     OH_NN_ReturnCode SetInput(uint32_t index, const OH_NN_Tensor& nnTensor, const void* buffer, size_t length);
@@ -83,6 +96,8 @@ public:
     OH_NN_ReturnCode CreateOutputMemory(uint32_t index, size_t length, OH_NN_Memory** memory);
     OH_NN_ReturnCode DestroyInputMemory(uint32_t index, OH_NN_Memory** memory);
     OH_NN_ReturnCode DestroyOutputMemory(uint32_t index, OH_NN_Memory** memory);
+    OH_NN_ReturnCode RegisterBuffer(void* buffer, size_t length, int fd);
+    OH_NN_ReturnCode UnregisterBuffer(void* buffer);
 
     OH_NN_ReturnCode Run();
 
@@ -90,10 +105,15 @@ public:
     OH_NN_ReturnCode SetDeinitModelCallBack() override;
     OH_NN_ReturnCode UnSetDeinitModelCallBack() override;
     OH_NN_ReturnCode DestroyPreparedModel() override;
+    // Counts the loaded model in the process-wide memory budget, which may evict it when the budget is exceeded.
+    void TrackModelMemory(size_t modelSize);
+    // Positions of the inputs which each output may alias, found by the OutputAliasAnalyzer on the compiled graph.
+    void SetAliasableInputs(std::vector<std::vector<uint32_t>>&& aliasableInputs);
 
 private:
     OH_NN_ReturnCode GetInputDimVec() const;
-    OH_NN_ReturnCode CheckInputDimRanges(NN_Tensor* inputTensors[], size_t inputSize);
+    OH_NN_ReturnCode CheckInputDimRanges(ExecutionContext& context, NN_Tensor* inputTensors[], size_t inputSize);
+    OH_NN_ReturnCode CheckOutputAliases(NN_Tensor* inputTensors[], NN_Tensor* outputTensors[]) const;
 
     // The following APIs are compatible with older versions
     OH_NN_ReturnCode Run(const std::vector<std::shared_ptr<NNTensor>>& inputTensors,
@@ -109,6 +129,7 @@ private:
     void SetInputTensorWithNewBuffer(uint32_t index, std::shared_ptr<NNTensor> inputTensor,
                                      const void* inputBuffer, size_t length, bool isInnerMem);
     OH_NN_ReturnCode CheckInputDimRanges(uint32_t index, const OH_NN_Tensor& nnTensor) const;
+    bool IsRegisteredBuffer(const void* buffer, size_t length) const;
     OH_NN_ReturnCode DeserializedTensorsFromBuffer(
         const Buffer& buffer, std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>>& tensorDescs);
     OH_NN_ReturnCode Reload();
@@ -120,6 +141,20 @@ private:
     OH_NN_ReturnCode RunAippModel(NN_Tensor* inputTensors[], size_t inputSize,
                                   NN_Tensor* outputTensors[], size_t outputSize, const char* aippStrings);
     OH_NN_ReturnCode UnSetHiaiModelCallBack();
+    OH_NN_ReturnCode RestoreUnloadedModel();
+    OH_NN_ReturnCode RunInner(ExecutionContext& context, NN_Tensor* inputTensors[], size_t inputSize,
+                              NN_Tensor* outputTensors[], size_t outputSize, AsyncRunContext* asyncContext,
+                              bool isInContext, int64_t submitTime);
+    OH_NN_ReturnCode RegrowOutputsAndRun(const std::vector<NN_Tensor*>& inputTensors,
+                                         const std::vector<NN_Tensor*>& outputTensors,
+                                         std::vector<std::vector<int32_t>>& outputsDims,
+                                         std::vector<bool>& isSufficientDataBuffer);
+    void RunAsyncTask(const std::shared_ptr<AsyncRunContext>& asyncContext);
+    void FinishAsyncRun();
+    void SchedulePredictiveReload();
+    void PredictiveReload();
+    void CancelPredictiveReload();
+    void RecordReturnedDemand();
 
 private:
     size_t m_backendID {0};
@@ -148,15 +183,54 @@ private:
     std::unordered_map<int, ExeTensor> m_outputTensors;
     std::unordered_map<int, std::vector<void*>> m_inputCreatedMem;
     std::unordered_map<int, std::vector<void*>> m_outputCreatedMem;
+    // User buffers imported by RegisterBuffer(), key: buffer, value: length. Guarded by m_mutex.
+    std::unordered_map<const void*, size_t> m_registeredBuffers;
+    // Copies between the user buffers and the device buffers, see OH_NN_ExecutorStatistics.
+    std::atomic<uint64_t> m_inputCopyCount {0};
+    std::atomic<uint64_t> m_inputCopyBytes {0};
+    std::atomic<uint64_t> m_outputCopyCount {0};
+    std::atomic<uint64_t> m_outputCopyBytes {0};
+    // Inner buffers of SetInput()/SetOutput() are staging, buffers of CreateInputMemory()/CreateOutputMemory() are IO
+    // tensors, and the model size counts as weights while the model is loaded.
+    MemoryAccount m_memoryAccount {"executor", this};
+    size_t m_modelSize {0};
+    // Empty if the graph is unknown, e.g. the compilation is restored from the cache, then no output may alias.
+    std::vector<std::vector<uint32_t>> m_aliasableInputs;
+    // Declared by SetOutputAlias, the input aliased by each output or SIZE_MAX. Empty until the first alias is
+    // declared, the runs do not check overlaps then.
+    std::vector<size_t> m_outputAliases;
     mutable std::vector<std::vector<size_t>> m_minInputDimsVec;
     mutable std::vector<std::vector<size_t>> m_maxInputDimsVec;
 
-    std::shared_ptr<OHOS::AppExecFwk::EventRunner> m_autoUnloadRunner;
-    std::shared_ptr<OHOS::AppExecFwk::EventHandler> m_autoUnloadHandler;
+    // Written by every run, read by the AutoUnloadTracker to unload the model once the executor is idle.
+    std::atomic<int64_t> m_lastUsedTime {0};
+    uint64_t m_autoUnloadId {0};
     uint64_t m_executorid;
-    std::mutex m_mutex;
+
+    // State of ReloadPolicy::PREDICTIVE, the times are steady clock nanoseconds.
+    // m_idleSince is the last execution before the auto unload, reset to 0 by the first execution after it.
+    std::atomic<int64_t> m_idleSince {0};
+    ReloadPredictor m_reloadPredictor {[this]() { PredictiveReload(); }};
+    // Held exclusively by RunSync, RunAsync, model unloading and buffer registration, shared by RunSyncInContext and
+    // the lookup of registered buffers.
+    mutable std::shared_mutex m_mutex;
+    // Run state of RunSync and RunAsync, which hold m_mutex exclusively. Reused so that a steady-state run does not
+    // allocate.
+    ExecutionContext m_runContext;
     bool isHiaiModel = false;
     std::string m_aippPara;
+
+    // Latencies of the successful executions in microseconds, the stages of OH_NN_ExecutorStatistics.
+    LatencyHistogram m_queueLatency;
+    LatencyHistogram m_runLatency;
+    LatencyHistogram m_postProcessLatency;
+    LatencyHistogram m_totalLatency;
+
+    NN_OnRunDone m_onRunDone {nullptr};
+    NN_OnServiceDied m_onServiceDied {nullptr};
+    size_t m_asyncRunNum {0};
+    std::mutex m_asyncMutex;
+    std::condition_variable m_asyncCv;
 };
 }  // namespace NeuralNetworkRuntime
 }  // namespace OHOS
@@ -18,6 +18,8 @@
 
 #include "log.h"
 #include "backend_manager.h"
+#include "mapping_policy.h"
+#include "memory_account.h"
 #include "nnbackend.h"
 #include "nntensor.h"
 #include "neural_network_runtime/neural_network_runtime_type.h"
@@ -159,7 +161,7 @@ OH_NN_ReturnCode NNTensor2_0::CreateData(int fd, size_t size, size_t offset)
         return OH_NN_INVALID_PARAMETER;
     }
 
-    m_data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, offset);
+    m_data = MappingPolicy::Map(size, PROT_READ | PROT_WRITE, fd, offset);
     if (m_data == MAP_FAILED) {
         LOGE("NNTensor2_0::AllocateMemory failed, Map fd to address failed: %{public}s.", strerror(errno));
         m_data = nullptr;
@@ -234,7 +236,14 @@ OH_NN_ReturnCode NNTensor2_0::AllocateMemory(size_t length)
         return OH_NN_NULL_PTR;
     }
     int fd = 0;
-    auto oldRet = device->AllocateBuffer(length, fd);
+    void* data = nullptr;
+    // A device which pools its buffers keeps them mapped, so a reused buffer is not mapped again.
+    bool isMappedByDevice = true;
+    auto oldRet = device->AllocateMappedBuffer(length, fd, data);
+    if (oldRet == OH_NN_OPERATION_FORBIDDEN) {
+        isMappedByDevice = false;
+        oldRet = device->AllocateBuffer(length, fd);
+    }
     if (oldRet != OH_NN_SUCCESS) {
         LOGE("NNTensor2_0::AllocateMemory failed, failed to allocate buffer.");
         return OH_NN_MEMORY_ERROR;
@@ -244,21 +253,34 @@ OH_NN_ReturnCode NNTensor2_0::AllocateMemory(size_t length)
         return OH_NN_INVALID_PARAMETER;
     }
 
-    m_data = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
-    if (m_data == MAP_FAILED) {
-        LOGE("NNTensor2_0::AllocateMemory failed, Map fd to address failed: %{public}s.", strerror(errno));
-        m_data = nullptr;
-        return OH_NN_MEMORY_ERROR;
+    if (!isMappedByDevice) {
+        data = MappingPolicy::Map(length, PROT_READ | PROT_WRITE, fd, 0);
+        if (data == MAP_FAILED) {
+            LOGE("NNTensor2_0::AllocateMemory failed, Map fd to address failed: %{public}s.", strerror(errno));
+            m_data = nullptr;
+            return OH_NN_MEMORY_ERROR;
+        }
     }
+    m_data = data;
+    m_isMappedByDevice = isMappedByDevice;
     m_fd = fd;
     m_offset = 0;
     m_size = length;
+    // Tensors are not owned by an executor, their buffers are only counted by the process.
+    MemoryAccount::GetProcessAccount().Add(MemoryCategory::IO_TENSORS, length);
 
     return OH_NN_SUCCESS;
 }
 
 OH_NN_ReturnCode NNTensor2_0::ReleaseMemory()
 {
+    if (m_base != nullptr) {
+        m_base.reset();
+        m_data = nullptr;
+        m_size = 0;
+        m_fd = 0;
+        return OH_NN_SUCCESS;
+    }
     if (m_size == 0 || m_data == nullptr) {
         return OH_NN_SUCCESS;
     }
@@ -267,11 +289,13 @@ OH_NN_ReturnCode NNTensor2_0::ReleaseMemory()
         return OH_NN_INVALID_PARAMETER;
     }
 
-    auto unmapResult = munmap(m_data, m_size);
-    if (unmapResult != 0) {
-        LOGE("NNTensor2_0::ReleaseMemory failed. Please try again.");
-        return OH_NN_MEMORY_ERROR;
+    if (!m_isMappedByDevice) {
+        auto unmapResult = munmap(m_data, m_size);
+        if (unmapResult != 0) {
+            LOGE("NNTensor2_0::ReleaseMemory failed. Please try again.");
+            return OH_NN_MEMORY_ERROR;
         }
+    }
 
     if (!m_isUserData) {
         BackendManager& backendManager = BackendManager::GetInstance();
@@ -292,12 +316,96 @@ OH_NN_ReturnCode NNTensor2_0::ReleaseMemory()
             LOGE("NNTensor2_0::ReleaseMemory failed, failed to release buffer.");
             return OH_NN_MEMORY_ERROR;
         }
+        MemoryAccount::GetProcessAccount().Sub(MemoryCategory::IO_TENSORS, m_size);
     }
 
     m_data = nullptr;
     m_size = 0;
     m_fd = 0;
+    m_isMappedByDevice = false;
+
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode NNTensor2_0::ResizeData(size_t size)
+{
+    if (m_isUserData) {
+        LOGE("NNTensor2_0::ResizeData failed, the data is created by user and cannot be resized.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    if (size > ALLOCATE_BUFFER_LIMIT) {
+        LOGE("NNTensor2_0::ResizeData failed, Invalid buffer size, "
+             "it must greater than 0 and less than 1Gb. length=%{public}zu", size);
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (m_data != nullptr && size <= m_size - m_offset) {
+        return OH_NN_SUCCESS;
+    }
+
+    void* oldData = m_data;
+    int oldFd = m_fd;
+    size_t oldSize = m_size;
+    size_t oldOffset = m_offset;
+    bool oldIsMappedByDevice = m_isMappedByDevice;
+    OH_NN_ReturnCode ret = AllocateMemory(size);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("NNTensor2_0::ResizeData failed, failed to allocate memory.");
+        m_data = oldData;
+        m_fd = oldFd;
+        m_size = oldSize;
+        m_offset = oldOffset;
+        m_isMappedByDevice = oldIsMappedByDevice;
+        return ret;
+    }
 
+    // The old buffer is released by a tensor of the same backend, which takes it over.
+    NNTensor2_0 oldTensor(m_backendID);
+    oldTensor.SetData(oldData);
+    oldTensor.SetFd(oldFd);
+    oldTensor.SetSize(oldSize);
+    oldTensor.m_isMappedByDevice = oldIsMappedByDevice;
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode NNTensor2_0::CreateView(const std::shared_ptr<NNTensor2_0>& base, size_t offset)
+{
+    if (m_data != nullptr) {
+        LOGE("NNTensor2_0::CreateView failed, m_data has been created before.");
+        return OH_NN_FAILED;
+    }
+    if (m_tensorDesc == nullptr) {
+        LOGE("NNTensor2_0::CreateView failed, m_tensorDesc is nullptr.");
+        return OH_NN_NULL_PTR;
+    }
+    if (base == nullptr || base->m_data == nullptr) {
+        LOGE("NNTensor2_0::CreateView failed, the data of base has not been created.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+    if (base->m_backendID != m_backendID) {
+        LOGE("NNTensor2_0::CreateView failed, base is created on another backend.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    size_t byteSize = 0;
+    auto ret = m_tensorDesc->GetByteSize(&byteSize);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("NNTensor2_0::CreateView failed, failed to get byte size from tensorDesc.");
+        return ret;
+    }
+    size_t baseSize = base->m_size - base->m_offset;
+    if (offset > baseSize || byteSize > baseSize - offset) {
+        LOGE("NNTensor2_0::CreateView failed, the view at offset %{public}zu with %{public}zu bytes exceeds "
+             "the %{public}zu bytes of base.", offset, byteSize, baseSize);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    // Same layout as the data created by user with an fd, the device receives the fd of base and the offset.
+    m_data = static_cast<char*>(base->m_data) + offset;
+    m_fd = base->m_fd;
+    m_size = base->m_size;
+    m_offset = base->m_offset + offset;
+    m_isUserData = true;
+    m_base = base;
     return OH_NN_SUCCESS;
 }
 
@@ -43,6 +43,11 @@ public:
     size_t GetBackendID() const override;
 
     bool CheckTensorData() const;
+    // Replaces the data created by the tensor with a larger one, the content is not preserved.
+    OH_NN_ReturnCode ResizeData(size_t size);
+    // Makes the tensor a view of the data of base at the offset, without mapping it again.
+    // The view keeps base alive and does not own the data, like the data created by user.
+    OH_NN_ReturnCode CreateView(const std::shared_ptr<NNTensor2_0>& base, size_t offset);
 
     OH_NN_ReturnCode CheckDimRanges(const std::vector<uint32_t>& minDimRanges,
                                     const std::vector<uint32_t>& maxDimRanges) const;
@@ -59,6 +64,10 @@ private:
     size_t m_size {0};
     size_t m_offset {0};
     bool m_isUserData {false};
+    // Set if the mapping is owned by the device, which keeps it with the pooled buffer instead of unmapping it.
+    bool m_isMappedByDevice {false};
+    // Set if the tensor is a view, the data is released with the last reference to it.
+    std::shared_ptr<NNTensor2_0> m_base {nullptr};
 };
 }  // namespace NeuralNetworkRuntime
 }  // namespace OHOS
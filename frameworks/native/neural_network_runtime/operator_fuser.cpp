@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "operator_fuser.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "securec.h"
+
+#include "transform.h"
+
+namespace MSLITE = mindspore::lite;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+constexpr size_t CONV2D_WEIGHT_INDEX = 1;
+constexpr size_t CONV2D_BIAS_INDEX = 2;
+// Inputs of FusedBatchNorm: x, scale, bias, mean and variance.
+constexpr size_t BATCH_NORM_INPUT_NUM = 5;
+constexpr size_t BATCH_NORM_SCALE_INDEX = 1;
+constexpr size_t BATCH_NORM_BIAS_INDEX = 2;
+constexpr size_t BATCH_NORM_MEAN_INDEX = 3;
+constexpr size_t BATCH_NORM_VARIANCE_INDEX = 4;
+// Inputs of ScaleFusion: x, scale and an optional bias. Inputs of BiasAdd: x and bias.
+constexpr size_t SCALE_INPUT_NUM = 2;
+constexpr size_t SCALE_BIAS_INDEX = 2;
+constexpr size_t BIAS_ADD_INPUT_NUM = 2;
+
+// An absorbed node computes output[..., c] = input[..., c] * multipliers[c] + offsets[c] per output channel c.
+struct ChannelAffine {
+    std::vector<float> multipliers;
+    std::vector<float> offsets;
+};
+
+bool IsFusedActivation(MSLITE::ActivationType activation)
+{
+    return activation == MSLITE::ACTIVATION_TYPE_RELU || activation == MSLITE::ACTIVATION_TYPE_RELU6;
+}
+
+bool IsOwnedBy(const LiteGraphRewriter& rewriter, uint32_t tensorIndex, uint32_t nodeIndex)
+{
+    const std::vector<uint32_t>& consumers = rewriter.GetConsumers(tensorIndex);
+    return std::all_of(consumers.begin(), consumers.end(), [nodeIndex](uint32_t consumer) {
+        return consumer == nodeIndex;
+    });
+}
+
+bool ReadConstFloats(const LiteGraphRewriter& rewriter, uint32_t tensorIndex, size_t count, std::vector<float>& values)
+{
+    if (rewriter.GetProducer(tensorIndex) != LiteGraphRewriter::NO_NODE || rewriter.IsGraphInput(tensorIndex)) {
+        return false;
+    }
+    MSLITE::TensorPtr tensor = rewriter.GetLiteGraph()->all_tensors_[tensorIndex];
+    size_t size {0};
+    if (MSLITE::MindIR_Tensor_GetDataType(tensor) != MSLITE::DATA_TYPE_FLOAT32 ||
+        !MSLITE::MindIR_Tensor_GetQuantParams(tensor).empty() || !GetTensorSize(tensor, size) ||
+        size != count * sizeof(float)) {
+        return false;
+    }
+    std::vector<uint8_t> data = MSLITE::MindIR_Tensor_GetData(tensor);
+    if (data.size() != size) {
+        return false;
+    }
+    values.resize(count);
+    return memcpy_s(values.data(), size, data.data(), size) == EOK;
+}
+
+void WriteFloats(const std::vector<float>& values, std::vector<uint8_t>& data)
+{
+    data.resize(values.size() * sizeof(float));
+    (void)memcpy_s(data.data(), data.size(), values.data(), data.size());
+}
+
+bool GetBatchNormAffine(const LiteGraphRewriter& rewriter, const MSLITE::LiteGraph::Node& node,
+    size_t channelCount, ChannelAffine& affine)
+{
+    std::vector<float> scales;
+    std::vector<float> biases;
+    std::vector<float> means;
+    std::vector<float> variances;
+    const std::vector<uint32_t>& inputs = node.input_indices_;
+    if (inputs.size() != BATCH_NORM_INPUT_NUM ||
+        !ReadConstFloats(rewriter, inputs[BATCH_NORM_SCALE_INDEX], channelCount, scales) ||
+        !ReadConstFloats(rewriter, inputs[BATCH_NORM_BIAS_INDEX], channelCount, biases) ||
+        !ReadConstFloats(rewriter, inputs[BATCH_NORM_MEAN_INDEX], channelCount, means) ||
+        !ReadConstFloats(rewriter, inputs[BATCH_NORM_VARIANCE_INDEX], channelCount, variances)) {
+        return false;
+    }
+
+    float epsilon = MSLITE::MindIR_FusedBatchNorm_GetEpsilon(node.primitive_);
+    affine.multipliers.resize(channelCount);
+    affine.offsets.resize(channelCount);
+    for (size_t c = 0; c < channelCount; ++c) {
+        if (!(variances[c] + epsilon > 0.0f)) {
+            return false;
+        }
+        affine.multipliers[c] = scales[c] / std::sqrt(variances[c] + epsilon);
+        affine.offsets[c] = biases[c] - means[c] * affine.multipliers[c];
+    }
+    return true;
+}
+
+bool GetScaleAffine(const LiteGraphRewriter& rewriter, const MSLITE::LiteGraph::Node& node, size_t channelCount,
+    ChannelAffine& affine, MSLITE::ActivationType& activation)
+{
+    const std::vector<uint32_t>& inputs = node.input_indices_;
+    if (inputs.size() < SCALE_INPUT_NUM) {
+        return false;
+    }
+    // Only a scale of the channels of the output of Conv2DFusion, its last dimension in NHWC, its second in NCHW.
+    const MSLITE::TensorPtr& input = rewriter.GetLiteGraph()->all_tensors_[inputs[0]];
+    int64_t rank = static_cast<int64_t>(MSLITE::MindIR_Tensor_GetDims(input).size());
+    int64_t channelAxis {0};
+    MSLITE::Format format = MSLITE::MindIR_Tensor_GetFormat(input);
+    if (format == MSLITE::FORMAT_NHWC) {
+        channelAxis = rank - 1;
+    } else if (format == MSLITE::FORMAT_NCHW) {
+        channelAxis = 1;
+    } else {
+        return false;
+    }
+    int64_t axis = MSLITE::MindIR_ScaleFusion_GetAxis(node.primitive_);
+    if (channelAxis < 0 || channelAxis >= rank || (axis < 0 ? axis + rank : axis) != channelAxis) {
+        return false;
+    }
+    activation = static_cast<MSLITE::ActivationType>(MSLITE::MindIR_ScaleFusion_GetActivationType(node.primitive_));
+    if (activation != MSLITE::ACTIVATION_TYPE_NO_ACTIVATION && !IsFusedActivation(activation)) {
+        return false;
+    }
+
+    affine.offsets.assign(channelCount, 0.0f);
+    return ReadConstFloats(rewriter, inputs[1], channelCount, affine.multipliers) &&
+        (inputs.size() <= SCALE_BIAS_INDEX ||
+        ReadConstFloats(rewriter, inputs[SCALE_BIAS_INDEX], channelCount, affine.offsets));
+}
+
+bool GetBiasAddAffine(const LiteGraphRewriter& rewriter, const MSLITE::LiteGraph::Node& node, size_t channelCount,
+    ChannelAffine& affine)
+{
+    affine.multipliers.assign(channelCount, 1.0f);
+    return node.input_indices_.size() == BIAS_ADD_INPUT_NUM &&
+        ReadConstFloats(rewriter, node.input_indices_[1], channelCount, affine.offsets);
+}
+
+// Folds the affine transform of the fused node into the weight and bias of the Conv2DFusion.
+bool FuseChannelAffine(LiteGraphRewriter& rewriter, uint32_t nodeIndex, uint32_t fusedIndex)
+{
+    MSLITE::LiteGraph* liteGraph = rewriter.GetLiteGraph();
+    MSLITE::LiteGraph::Node* node = liteGraph->all_nodes_[nodeIndex];
+    const MSLITE::LiteGraph::Node* fusedNode = liteGraph->all_nodes_[fusedIndex];
+    if (node->input_indices_.size() <= CONV2D_WEIGHT_INDEX) {
+        return false;
+    }
+
+    // The weight of Conv2DFusion is [outChannel, kernelHeight, kernelWidth, inChannel / group].
+    uint32_t weightIndex = node->input_indices_[CONV2D_WEIGHT_INDEX];
+    MSLITE::TensorPtr& weightTensor = liteGraph->all_tensors_[weightIndex];
+    std::vector<int32_t> weightDims = MSLITE::MindIR_Tensor_GetDims(weightTensor);
+    size_t weightSize {0};
+    if (weightDims.empty() || weightDims[0] <= 0 || !GetTensorSize(weightTensor, weightSize)) {
+        return false;
+    }
+    size_t channelCount = static_cast<size_t>(weightDims[0]);
+    size_t weightCount = weightSize / sizeof(float);
+    std::vector<float> weights;
+    if (weightCount % channelCount != 0 || !IsOwnedBy(rewriter, weightIndex, nodeIndex) ||
+        !ReadConstFloats(rewriter, weightIndex, weightCount, weights)) {
+        return false;
+    }
+
+    std::vector<float> biases(channelCount, 0.0f);
+    bool hasBias = node->input_indices_.size() > CONV2D_BIAS_INDEX;
+    uint32_t biasIndex = hasBias ? node->input_indices_[CONV2D_BIAS_INDEX] : 0;
+    if (hasBias && (!IsOwnedBy(rewriter, biasIndex, nodeIndex) ||
+        !ReadConstFloats(rewriter, biasIndex, channelCount, biases))) {
+        return false;
+    }
+
+    ChannelAffine affine;
+    MSLITE::ActivationType activation {MSLITE::ACTIVATION_TYPE_NO_ACTIVATION};
+    bool isAffine {false};
+    switch (MSLITE::MindIR_Primitive_GetType(fusedNode->primitive_)) {
+        case MSLITE::NODE_TYPE_FUSED_BATCH_NORM:
+            isAffine = GetBatchNormAffine(rewriter, *fusedNode, channelCount, affine);
+            break;
+        case MSLITE::NODE_TYPE_SCALE_FUSION:
+            isAffine = GetScaleAffine(rewriter, *fusedNode, channelCount, affine, activation);
+            break;
+        case MSLITE::NODE_TYPE_BIAS_ADD:
+            isAffine = GetBiasAddAffine(rewriter, *fusedNode, channelCount, affine);
+            break;
+        default:
+            break;
+    }
+    if (!isAffine) {
+        return false;
+    }
+
+    size_t channelSize = weightCount / channelCount;
+    for (size_t c = 0; c < channelCount; ++c) {
+        for (size_t i = c * channelSize; i < (c + 1) * channelSize; ++i) {
+            weights[i] *= affine.multipliers[c];
+        }
+        biases[c] = biases[c] * affine.multipliers[c] + affine.offsets[c];
+    }
+
+    std::vector<uint8_t> data;
+    WriteFloats(weights, data);
+    MSLITE::MindIR_Tensor_SetData(&weightTensor, data);
+    WriteFloats(biases, data);
+    if (hasBias) {
+        MSLITE::MindIR_Tensor_SetData(&liteGraph->all_tensors_[biasIndex], data);
+    } else {
+        rewriter.AddInput(nodeIndex, MSLITE::MindIR_Tensor_Create(node->name_ + ":bias", MSLITE::DATA_TYPE_FLOAT32,
+            {static_cast<int32_t>(channelCount)}, MSLITE::MindIR_Tensor_GetFormat(weightTensor), data, {}));
+    }
+    if (activation != MSLITE::ACTIVATION_TYPE_NO_ACTIVATION) {
+        MSLITE::MindIR_Conv2DFusion_SetActivationType(&node->primitive_, activation);
+    }
+    return true;
+}
+
+bool FuseActivation(MSLITE::LiteGraph::Node& node, MSLITE::NodeType nodeType, const MSLITE::LiteGraph::Node& fusedNode)
+{
+    MSLITE::ActivationType activation = MSLITE::MindIR_Activation_GetActivationType(fusedNode.primitive_);
+    if (!IsFusedActivation(activation)) {
+        return false;
+    }
+    if (nodeType == MSLITE::NODE_TYPE_CONV2D_FUSION) {
+        MSLITE::MindIR_Conv2DFusion_SetActivationType(&node.primitive_, activation);
+    } else {
+        MSLITE::MindIR_MatMulFusion_SetActivationType(&node.primitive_, activation);
+    }
+    return true;
+}
+} // namespace
+
+void OperatorFuser::Fuse(LiteGraphRewriter& rewriter, GraphPassSummary& summary) const
+{
+    uint32_t nodeCount = static_cast<uint32_t>(rewriter.GetLiteGraph()->all_nodes_.size());
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        // A node absorbs a chain, e.g. a FusedBatchNorm, then a BiasAdd and a ReLU.
+        while (!rewriter.IsRemoved(i) && FuseNode(rewriter, i)) {
+            ++summary.fusedCount;
+        }
+    }
+}
+
+bool OperatorFuser::FuseNode(LiteGraphRewriter& rewriter, uint32_t nodeIndex) const
+{
+    MSLITE::LiteGraph* liteGraph = rewriter.GetLiteGraph();
+    MSLITE::LiteGraph::Node* node = liteGraph->all_nodes_[nodeIndex];
+    if (node->primitive_ == nullptr || node->output_indices_.size() != 1 ||
+        node->quant_type_ != MSLITE::QUANT_TYPE_NONE) {
+        return false;
+    }
+    MSLITE::NodeType nodeType = MSLITE::MindIR_Primitive_GetType(node->primitive_);
+    MSLITE::ActivationType activation {MSLITE::ACTIVATION_TYPE_NO_ACTIVATION};
+    if (nodeType == MSLITE::NODE_TYPE_CONV2D_FUSION) {
+        activation = MSLITE::MindIR_Conv2DFusion_GetActivationType(node->primitive_);
+    } else if (nodeType == MSLITE::NODE_TYPE_MATMUL_FUSION) {
+        activation = MSLITE::MindIR_MatMulFusion_GetActivationType(node->primitive_);
+    } else {
+        return false;
+    }
+    if (activation != MSLITE::ACTIVATION_TYPE_NO_ACTIVATION) {
+        return false;
+    }
+
+    uint32_t output = node->output_indices_[0];
+    const std::vector<uint32_t>& consumers = rewriter.GetConsumers(output);
+    if (rewriter.IsGraphOutput(output) || consumers.size() != 1) {
+        return false;
+    }
+    uint32_t fusedIndex = consumers[0];
+    const MSLITE::LiteGraph::Node* fusedNode = liteGraph->all_nodes_[fusedIndex];
+    if (fusedNode->primitive_ == nullptr || fusedNode->output_indices_.size() != 1 ||
+        fusedNode->input_indices_.empty() || fusedNode->input_indices_[0] != output ||
+        fusedNode->quant_type_ != MSLITE::QUANT_TYPE_NONE) {
+        return false;
+    }
+
+    bool isFused {false};
+    if (MSLITE::MindIR_Primitive_GetType(fusedNode->primitive_) == MSLITE::NODE_TYPE_ACTIVATION) {
+        isFused = FuseActivation(*node, nodeType, *fusedNode);
+    } else if (nodeType == MSLITE::NODE_TYPE_CONV2D_FUSION) {
+        isFused = FuseChannelAffine(rewriter, nodeIndex, fusedIndex);
+    }
+    if (!isFused) {
+        return false;
+    }
+    rewriter.FuseNode(nodeIndex, fusedIndex);
+    return true;
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
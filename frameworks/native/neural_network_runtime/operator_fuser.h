@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_OPERATOR_FUSER_H
+#define NEURAL_NETWORK_RUNTIME_OPERATOR_FUSER_H
+
+#include "lite_graph_rewriter.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// Absorbs the nodes which follow a Conv2DFusion or MatMulFusion into it, so that the device runs fewer nodes and
+// their intermediate tensors disappear. A Conv2DFusion absorbs a FusedBatchNorm, a ScaleFusion and a BiasAdd by
+// scaling its weight and shifting its bias per output channel, both of them Conv2DFusion and MatMulFusion absorb a
+// trailing ReLU or ReLU6 into their activation type. A node is absorbed if:
+// 1. it is the only consumer of the output of the fusion node, which is not an output of the graph;
+// 2. the fusion node has no activation yet;
+// 3. its parameters, and the weight and bias of the Conv2DFusion, are constant float32 tensors which no other node
+//    reads, and none of them is quantized.
+class OperatorFuser {
+public:
+    void Fuse(LiteGraphRewriter& rewriter, GraphPassSummary& summary) const;
+
+private:
+    bool FuseNode(LiteGraphRewriter& rewriter, uint32_t nodeIndex) const;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_OPERATOR_FUSER_H
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "output_alias_analyzer.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "log.h"
+#include "transform.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+const std::unordered_set<mindspore::lite::NodeType> ELEMENTWISE_NODE_TYPES = {
+    mindspore::lite::NODE_TYPE_ABS,
+    mindspore::lite::NODE_TYPE_ACTIVATION,
+    mindspore::lite::NODE_TYPE_ADD_FUSION,
+    mindspore::lite::NODE_TYPE_BIAS_ADD,
+    mindspore::lite::NODE_TYPE_CAST,
+    mindspore::lite::NODE_TYPE_CEIL,
+    mindspore::lite::NODE_TYPE_CLIP,
+    mindspore::lite::NODE_TYPE_COS,
+    mindspore::lite::NODE_TYPE_DIV_FUSION,
+    mindspore::lite::NODE_TYPE_ELTWISE,
+    mindspore::lite::NODE_TYPE_ERF,
+    mindspore::lite::NODE_TYPE_EXPFUSION,
+    mindspore::lite::NODE_TYPE_FLOOR,
+    mindspore::lite::NODE_TYPE_LOG,
+    mindspore::lite::NODE_TYPE_LOGICAL_NOT,
+    mindspore::lite::NODE_TYPE_MAXIMUM,
+    mindspore::lite::NODE_TYPE_MINIMUM,
+    mindspore::lite::NODE_TYPE_MUL_FUSION,
+    mindspore::lite::NODE_TYPE_NEG,
+    mindspore::lite::NODE_TYPE_POW_FUSION,
+    mindspore::lite::NODE_TYPE_QUANT_DTYPE_CAST,
+    mindspore::lite::NODE_TYPE_RECIPROCAL,
+    mindspore::lite::NODE_TYPE_ROUND,
+    mindspore::lite::NODE_TYPE_RSQRT,
+    mindspore::lite::NODE_TYPE_SIN,
+    mindspore::lite::NODE_TYPE_SQRT,
+    mindspore::lite::NODE_TYPE_SQUARE,
+    mindspore::lite::NODE_TYPE_SQUARED_DIFFERENCE,
+    mindspore::lite::NODE_TYPE_SUB_FUSION,
+};
+
+bool IsElementwise(const mindspore::lite::LiteGraph::Node* node)
+{
+    return ELEMENTWISE_NODE_TYPES.count(mindspore::lite::MindIR_Primitive_GetType(node->primitive_)) != 0;
+}
+
+// Dims of a dynamic shape are only known at execution, such tensors never alias.
+bool HasSameLayout(const mindspore::lite::TensorPtr input, const mindspore::lite::TensorPtr output)
+{
+    uint32_t inputTypeSize = GetTypeSize(MSToNN::TransformDataType(mindspore::lite::MindIR_Tensor_GetDataType(input)));
+    uint32_t outputTypeSize =
+        GetTypeSize(MSToNN::TransformDataType(mindspore::lite::MindIR_Tensor_GetDataType(output)));
+    if (inputTypeSize == 0 || inputTypeSize != outputTypeSize) {
+        return false;
+    }
+
+    std::vector<int32_t> inputDims = mindspore::lite::MindIR_Tensor_GetDims(input);
+    if (inputDims != mindspore::lite::MindIR_Tensor_GetDims(output)) {
+        return false;
+    }
+    for (int32_t dim : inputDims) {
+        if (dim < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+OH_NN_ReturnCode OutputAliasAnalyzer::Analyze(const mindspore::lite::LiteGraph* liteGraph,
+    std::vector<std::vector<uint32_t>>& aliasableInputs) const
+{
+    if (liteGraph == nullptr) {
+        LOGE("[OutputAliasAnalyzer] Analyze failed, lite graph is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    size_t tensorCount = liteGraph->all_tensors_.size();
+    uint32_t nodeCount = static_cast<uint32_t>(liteGraph->all_nodes_.size());
+    std::unordered_map<uint32_t, uint32_t> producers;
+    std::unordered_map<uint32_t, std::vector<uint32_t>> consumers;
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        const auto* node = liteGraph->all_nodes_[i];
+        if (node == nullptr) {
+            LOGE("[OutputAliasAnalyzer] Analyze failed, node %{public}u is nullptr.", i);
+            return OH_NN_INVALID_PARAMETER;
+        }
+        for (uint32_t index : node->output_indices_) {
+            producers.emplace(index, i);
+        }
+        for (uint32_t index : node->input_indices_) {
+            consumers[index].emplace_back(i);
+        }
+    }
+
+    std::unordered_set<uint32_t> graphOutputs(liteGraph->output_indices_.begin(), liteGraph->output_indices_.end());
+    aliasableInputs.assign(liteGraph->output_indices_.size(), {});
+    for (size_t i = 0; i < liteGraph->output_indices_.size(); ++i) {
+        uint32_t outputIndex = liteGraph->output_indices_[i];
+        auto producer = producers.find(outputIndex);
+        if (outputIndex >= tensorCount || producer == producers.end() ||
+            !IsElementwise(liteGraph->all_nodes_[producer->second])) {
+            continue;
+        }
+
+        // Ancestors of the producer, collected from its operands up to the inputs of the graph.
+        std::unordered_set<uint32_t> ancestors;
+        std::vector<uint32_t> pendingNodes {producer->second};
+        while (!pendingNodes.empty()) {
+            uint32_t nodeIndex = pendingNodes.back();
+            pendingNodes.pop_back();
+            for (uint32_t index : liteGraph->all_nodes_[nodeIndex]->input_indices_) {
+                auto iter = producers.find(index);
+                if (iter != producers.end() && ancestors.insert(iter->second).second) {
+                    pendingNodes.emplace_back(iter->second);
+                }
+            }
+        }
+        if (ancestors.count(producer->second) != 0) {
+            LOGE("[OutputAliasAnalyzer] Analyze failed, the graph has a cycle.");
+            return OH_NN_INVALID_PARAMETER;
+        }
+
+        for (size_t j = 0; j < liteGraph->input_indices_.size(); ++j) {
+            uint32_t inputIndex = liteGraph->input_indices_[j];
+            if (inputIndex >= tensorCount || graphOutputs.count(inputIndex) != 0 ||
+                !HasSameLayout(liteGraph->all_tensors_[inputIndex], liteGraph->all_tensors_[outputIndex])) {
+                continue;
+            }
+
+            bool isAliasable = true;
+            for (uint32_t consumer : consumers[inputIndex]) {
+                if (consumer != producer->second && ancestors.count(consumer) == 0) {
+                    isAliasable = false;
+                    break;
+                }
+            }
+            if (isAliasable) {
+                aliasableInputs[i].emplace_back(static_cast<uint32_t>(j));
+            }
+        }
+    }
+    return OH_NN_SUCCESS;
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
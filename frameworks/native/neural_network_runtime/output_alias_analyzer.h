@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_OUTPUT_ALIAS_ANALYZER_H
+#define NEURAL_NETWORK_RUNTIME_OUTPUT_ALIAS_ANALYZER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "mindir.h"
+#include "neural_network_runtime_inner.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// Finds the inputs of a lite graph whose buffer an output may overwrite, so that the caller can pass one tensor as
+// both of them. An output may alias an input if:
+// 1. the output is produced by an elementwise node, which reads each element of its operands before it writes the
+//    same element of its result;
+// 2. the input has the same static dims and element size as the output, so no operand is broadcast over it;
+// 3. every other consumer of the input is an ancestor of the producer, it has finished before the producer runs;
+// 4. the input is not an output of the graph itself.
+class OutputAliasAnalyzer {
+public:
+    // aliasableInputs[i] receives the positions of the graph inputs which the i-th graph output may alias.
+    OH_NN_ReturnCode Analyze(const mindspore::lite::LiteGraph* liteGraph,
+        std::vector<std::vector<uint32_t>>& aliasableInputs) const;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_OUTPUT_ALIAS_ANALYZER_H
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reload_predictor.h"
+
+#include <algorithm>
+
+#include "async_run_pool.h"
+#include "auto_unload_tracker.h"
+#include "log.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+constexpr int64_t NANOSECONDS_PER_MILLISECOND = 1000 * 1000;
+// The reload starts at least 1s, or twice the measured reload time, before the predicted demand.
+constexpr int64_t RELOAD_MIN_LEAD = 1000 * NANOSECONDS_PER_MILLISECOND;
+constexpr int64_t RELOAD_LEAD_FACTOR = 2;
+// A new sample weighs 1/4 in the moving averages.
+constexpr int64_t PREDICTOR_SMOOTHING = 4;
+
+static int64_t UpdateMovingAverage(int64_t average, int64_t sample)
+{
+    return (average == 0) ? sample : average + (sample - average) / PREDICTOR_SMOOTHING;
+}
+
+ReloadPredictor::ReloadPredictor(ReloadCallback&& onReload) : m_onReload(std::move(onReload)) {}
+
+ReloadPredictor::~ReloadPredictor()
+{
+    Stop();
+}
+
+void ReloadPredictor::RecordIdleGap(int64_t idleGap)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_predictedIdleGap = UpdateMovingAverage(m_predictedIdleGap, idleGap);
+}
+
+void ReloadPredictor::RecordReloadCost(int64_t reloadCost)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_reloadCost = UpdateMovingAverage(m_reloadCost, reloadCost);
+}
+
+bool ReloadPredictor::GetReloadDelay(int64_t idleSince, int64_t now, int64_t& delay) const
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    if (m_predictedIdleGap == 0) {
+        // Nothing is predicted until the executions have returned once after an unload.
+        return false;
+    }
+    int64_t lead = std::max(RELOAD_MIN_LEAD, RELOAD_LEAD_FACTOR * m_reloadCost);
+    delay = idleSince + m_predictedIdleGap - lead - now;
+    return delay >= 0;
+}
+
+OH_NN_ReturnCode ReloadPredictor::Schedule(int64_t idleSince)
+{
+    int64_t delay = 0;
+    if (!GetReloadDelay(idleSince, AutoUnloadTracker::Now(), delay)) {
+        LOGI("[ReloadPredictor] Schedule skipped, no demand is predicted in time, reload on demand.");
+        return OH_NN_SUCCESS;
+    }
+    int32_t delayMs = static_cast<int32_t>(std::min<int64_t>(delay / NANOSECONDS_PER_MILLISECOND, INT32_MAX));
+
+    std::lock_guard<std::mutex> lock(m_mtx);
+    if (m_isStopped) {
+        LOGE("[ReloadPredictor] Schedule failed, the predictor has been stopped.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    if (m_hasTimer) {
+        return OH_NN_SUCCESS;
+    }
+
+    // The timer thread also serves the timeouts of asynchronous executions, reload on a worker instead.
+    OH_NN_ReturnCode ret = AsyncRunPool::GetInstance()->PostTimerTask([this]() {
+        if (AsyncRunPool::GetInstance()->PostTask([this]() { Reload(); }) != OH_NN_SUCCESS) {
+            LOGW("[ReloadPredictor] Reload failed, failed to post reload task.");
+            std::lock_guard<std::mutex> timerLock(m_mtx);
+            m_hasTimer = false;
+            FinishTaskLocked();
+        }
+    }, delayMs, m_timerId);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[ReloadPredictor] Schedule failed, failed to post reload timer.");
+        return ret;
+    }
+    m_hasTimer = true;
+    ++m_taskNum;
+    LOGI("[ReloadPredictor] Model will be reloaded in %{public}d ms.", delayMs);
+    return OH_NN_SUCCESS;
+}
+
+void ReloadPredictor::Reload()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_hasTimer = false;
+        if (m_isStopped) {
+            FinishTaskLocked();
+            return;
+        }
+    }
+
+    // Not locked, the callback may record the reload cost. Stop() waits for it.
+    m_onReload();
+
+    std::lock_guard<std::mutex> lock(m_mtx);
+    FinishTaskLocked();
+}
+
+void ReloadPredictor::Stop()
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    m_isStopped = true;
+    // A timer which has fired already finishes by itself in Reload().
+    if (m_hasTimer && AsyncRunPool::GetInstance()->RemoveTimerTask(m_timerId)) {
+        m_hasTimer = false;
+        FinishTaskLocked();
+    }
+    m_taskCv.wait(lock, [this] { return m_taskNum == 0; });
+}
+
+void ReloadPredictor::FinishTaskLocked()
+{
+    if (--m_taskNum == 0) {
+        m_taskCv.notify_all();
+    }
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_RELOAD_PREDICTOR_H
+#define NEURAL_NETWORK_RUNTIME_RELOAD_PREDICTOR_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+#include "neural_network_runtime/neural_network_runtime_type.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+using ReloadCallback = std::function<void()>;
+
+// Predictor of ReloadPolicy::PREDICTIVE, the times are steady clock nanoseconds.
+// It learns when the executions return to an unloaded model, and invokes the reload callback on the AsyncRunPool
+// shortly before. Once stopped, no callback is invoked any more, so the owner may be destroyed afterwards.
+class ReloadPredictor {
+public:
+    explicit ReloadPredictor(ReloadCallback&& onReload);
+    ~ReloadPredictor();
+
+    // Time from the last execution before the unload to the first execution after it.
+    void RecordIdleGap(int64_t idleGap);
+    void RecordReloadCost(int64_t reloadCost);
+    // Returns false if nothing is predicted yet, or if the predicted demand is too close to reload in time.
+    bool GetReloadDelay(int64_t idleSince, int64_t now, int64_t& delay) const;
+    // Schedules the reload for the idle period started at idleSince, unless a reload is pending already.
+    OH_NN_ReturnCode Schedule(int64_t idleSince);
+    // Removes the pending reload and waits for a callback being invoked, nothing is scheduled afterwards.
+    void Stop();
+
+private:
+    ReloadPredictor(const ReloadPredictor&) = delete;
+    ReloadPredictor& operator=(const ReloadPredictor&) = delete;
+
+    void Reload();
+    void FinishTaskLocked();
+
+private:
+    ReloadCallback m_onReload;
+    // Moving averages of the idle gap and of the reload duration.
+    int64_t m_predictedIdleGap {0};
+    int64_t m_reloadCost {0};
+    uint64_t m_timerId {0};
+    bool m_hasTimer {false};
+    // Timer and reload tasks which still reference this predictor.
+    size_t m_taskNum {0};
+    bool m_isStopped {false};
+    mutable std::mutex m_mtx;
+    std::condition_variable m_taskCv;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_RELOAD_PREDICTOR_H
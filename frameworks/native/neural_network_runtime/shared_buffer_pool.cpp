@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "shared_buffer_pool.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sys/mman.h>
+
+#include "log.h"
+#include "mapping_policy.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+constexpr size_t BUFFER_PAGE_SIZE = 4096;
+// Size classes per power of two is 1 << SUB_CLASS_BITS.
+constexpr size_t SUB_CLASS_BITS = 2;
+constexpr size_t DEFAULT_HIGH_WATER_MARK = 64 * 1024 * 1024;
+}
+
+std::atomic<size_t> SharedBufferPool::s_totalCachedBytes {0};
+std::mutex SharedBufferPool::s_poolsMtx;
+std::vector<SharedBufferPool*> SharedBufferPool::s_pools;
+
+SharedBufferPool::SharedBufferPool(AllocateBufferFunc&& allocate, ReleaseBufferFunc&& release)
+    : m_allocate(std::move(allocate)), m_release(std::move(release)), m_highWaterMark(DEFAULT_HIGH_WATER_MARK)
+{
+    std::lock_guard<std::mutex> poolsLock(s_poolsMtx);
+    s_pools.emplace_back(this);
+}
+
+SharedBufferPool::~SharedBufferPool()
+{
+    {
+        std::lock_guard<std::mutex> poolsLock(s_poolsMtx);
+        s_pools.erase(std::remove(s_pools.begin(), s_pools.end(), this), s_pools.end());
+    }
+
+    std::vector<TrimmedBuffer> trimmedBuffers;
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        TrimLocked(0, trimmedBuffers);
+    }
+    ReleaseTrimmedBuffers(trimmedBuffers);
+}
+
+size_t SharedBufferPool::GetClassSize(size_t length)
+{
+    size_t size = (length + BUFFER_PAGE_SIZE - 1) / BUFFER_PAGE_SIZE * BUFFER_PAGE_SIZE;
+    size_t highBit = 0;
+    while ((size >> (highBit + 1)) != 0) {
+        ++highBit;
+    }
+    size_t step = std::max(BUFFER_PAGE_SIZE, (static_cast<size_t>(1) << highBit) >> SUB_CLASS_BITS);
+    return (size + step - 1) / step * step;
+}
+
+OH_NN_ReturnCode SharedBufferPool::Allocate(size_t length, int& fd)
+{
+    void* data = nullptr;
+    return AllocateInner(length, false, fd, data);
+}
+
+OH_NN_ReturnCode SharedBufferPool::AllocateMapped(size_t length, int& fd, void*& data)
+{
+    return AllocateInner(length, true, fd, data);
+}
+
+OH_NN_ReturnCode SharedBufferPool::AllocateInner(size_t length, bool isMapped, int& fd, void*& data)
+{
+    size_t classSize = GetClassSize(length);
+    bool isPooled = false;
+    bool isHit = false;
+    data = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        // Larger than the high-water mark, it is never cached, so it is neither rounded up nor pooled.
+        if (classSize <= m_highWaterMark) {
+            isPooled = true;
+            auto iter = m_idleBuffers.find(classSize);
+            if (iter != m_idleBuffers.end() && !iter->second.empty()) {
+                // The most recently released buffer is the most likely to be still resident.
+                fd = iter->second.back().fd;
+                data = iter->second.back().data;
+                iter->second.pop_back();
+                m_cachedBytes -= classSize;
+                s_totalCachedBytes.fetch_sub(classSize, std::memory_order_relaxed);
+                --m_cachedCount;
+                ++m_hitCount;
+                isHit = true;
+            } else {
+                ++m_missCount;
+            }
+        }
+    }
+
+    size_t size = isPooled ? classSize : length;
+    if (!isHit) {
+        OH_NN_ReturnCode ret = m_allocate(size, fd);
+        if (ret != OH_NN_SUCCESS) {
+            return ret;
+        }
+    }
+
+    // A buffer allocated by Allocate is not mapped by the pool, until it is reused by AllocateMapped.
+    bool isMapFailed = false;
+    if (isMapped && data == nullptr) {
+        data = MappingPolicy::Map(size, PROT_READ | PROT_WRITE, fd, 0);
+        if (data == MAP_FAILED) {
+            LOGE("[SharedBufferPool] Failed to map the buffer of %{public}zu bytes: %{public}s.", size,
+                strerror(errno));
+            data = nullptr;
+            isMapFailed = true;
+        }
+    }
+
+    if (isMapFailed && !isPooled) {
+        m_release(fd, size);
+        return OH_NN_MEMORY_ERROR;
+    }
+    if (!isPooled && !isMapped) {
+        // Not tracked, the caller releases it with the length it is allocated with.
+        return OH_NN_SUCCESS;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        // A mapping kept by the idle buffer stays with it when allocated by Allocate, it is unmapped on trim only.
+        m_usedBuffers[fd] = {size, isPooled, data};
+    }
+    if (isMapFailed) {
+        // Back to the pool unmapped.
+        Release(fd, length);
+        return OH_NN_MEMORY_ERROR;
+    }
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode SharedBufferPool::Release(int fd, size_t length)
+{
+    std::vector<TrimmedBuffer> trimmedBuffers;
+    bool isTracked = false;
+    UsedBuffer buffer;
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        auto iter = m_usedBuffers.find(fd);
+        if (iter != m_usedBuffers.end()) {
+            isTracked = true;
+            buffer = iter->second;
+            m_usedBuffers.erase(iter);
+            if (buffer.isPooled) {
+                m_idleBuffers[buffer.size].push_back({fd, buffer.data, ++m_releaseSeq});
+                m_cachedBytes += buffer.size;
+                s_totalCachedBytes.fetch_add(buffer.size, std::memory_order_relaxed);
+                ++m_cachedCount;
+                TrimLocked(m_highWaterMark, trimmedBuffers);
+            }
+        }
+    }
+
+    if (!isTracked) {
+        // Not allocated from the pool, or too large to be pooled and not mapped by the pool.
+        return m_release(fd, length);
+    }
+    if (!buffer.isPooled) {
+        Unmap(buffer.data, buffer.size);
+        return m_release(fd, buffer.size);
+    }
+    ReleaseTrimmedBuffers(trimmedBuffers);
+    return OH_NN_SUCCESS;
+}
+
+void SharedBufferPool::SetHighWaterMark(size_t highWaterMark)
+{
+    std::vector<TrimmedBuffer> trimmedBuffers;
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_highWaterMark = highWaterMark;
+        TrimLocked(m_highWaterMark, trimmedBuffers);
+    }
+    ReleaseTrimmedBuffers(trimmedBuffers);
+}
+
+void SharedBufferPool::GetStatistics(OH_NN_BufferPoolStatistics& statistics) const
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    statistics.hitCount = m_hitCount;
+    statistics.missCount = m_missCount;
+    statistics.cachedBytes = m_cachedBytes;
+    statistics.cachedCount = m_cachedCount;
+    statistics.trimCount = m_trimCount;
+    statistics.trimmedBytes = m_trimmedBytes;
+    statistics.highWaterMark = m_highWaterMark;
+}
+
+void SharedBufferPool::TrimAll(size_t limit)
+{
+    std::lock_guard<std::mutex> poolsLock(s_poolsMtx);
+    for (SharedBufferPool* pool : s_pools) {
+        size_t totalCachedBytes = GetTotalCachedBytes();
+        if (totalCachedBytes <= limit) {
+            break;
+        }
+
+        std::vector<TrimmedBuffer> trimmedBuffers;
+        {
+            std::lock_guard<std::mutex> lock(pool->m_mtx);
+            size_t excess = totalCachedBytes - limit;
+            pool->TrimLocked(pool->m_cachedBytes > excess ? pool->m_cachedBytes - excess : 0, trimmedBuffers);
+        }
+        pool->ReleaseTrimmedBuffers(trimmedBuffers);
+    }
+}
+
+void SharedBufferPool::TrimLocked(size_t limit, std::vector<TrimmedBuffer>& trimmedBuffers)
+{
+    while (m_cachedBytes > limit) {
+        // The number of size classes is small, so the oldest buffer is found by scanning the fronts of them.
+        auto oldest = m_idleBuffers.end();
+        for (auto iter = m_idleBuffers.begin(); iter != m_idleBuffers.end(); ++iter) {
+            if (!iter->second.empty() && (oldest == m_idleBuffers.end() ||
+                iter->second.front().releaseSeq < oldest->second.front().releaseSeq)) {
+                oldest = iter;
+            }
+        }
+        if (oldest == m_idleBuffers.end()) {
+            break;
+        }
+
+        trimmedBuffers.push_back({oldest->second.front().fd, oldest->second.front().data, oldest->first});
+        oldest->second.pop_front();
+        m_cachedBytes -= oldest->first;
+        s_totalCachedBytes.fetch_sub(oldest->first, std::memory_order_relaxed);
+        --m_cachedCount;
+        ++m_trimCount;
+        m_trimmedBytes += oldest->first;
+    }
+}
+
+void SharedBufferPool::Unmap(void* data, size_t size)
+{
+    if (data != nullptr && munmap(data, size) != 0) {
+        LOGW("[SharedBufferPool] Failed to unmap the buffer of %{public}zu bytes: %{public}s.", size, strerror(errno));
+    }
+}
+
+void SharedBufferPool::ReleaseTrimmedBuffers(const std::vector<TrimmedBuffer>& trimmedBuffers)
+{
+    for (const TrimmedBuffer& buffer : trimmedBuffers) {
+        Unmap(buffer.data, buffer.size);
+        OH_NN_ReturnCode ret = m_release(buffer.fd, buffer.size);
+        if (ret != OH_NN_SUCCESS) {
+            LOGW("[SharedBufferPool] Failed to release trimmed buffer of %{public}zu bytes.", buffer.size);
+        }
+    }
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_SHARED_BUFFER_POOL_H
+#define NEURAL_NETWORK_RUNTIME_SHARED_BUFFER_POOL_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "neural_network_runtime_inner.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+using AllocateBufferFunc = std::function<OH_NN_ReturnCode(size_t length, int& fd)>;
+using ReleaseBufferFunc = std::function<OH_NN_ReturnCode(int fd, size_t length)>;
+
+// Pool of the shared buffers of a device, which saves the IPC round trips of allocating and releasing them.
+// A buffer is allocated with the size of its size class, and returned to the pool of that class when it is released.
+// The idle buffers are released to the device from the least recently released one, once the bytes they hold exceed
+// the high-water mark.
+// A buffer mapped by the pool keeps its mapping while it is idle, and is unmapped only when it is released to the
+// device, so a reused buffer costs neither the IPC round trips nor the mmap and munmap.
+class SharedBufferPool {
+public:
+    SharedBufferPool(AllocateBufferFunc&& allocate, ReleaseBufferFunc&& release);
+    ~SharedBufferPool();
+
+    OH_NN_ReturnCode Allocate(size_t length, int& fd);
+    // Also returns the mapping of the buffer, which is owned by the pool and must not be unmapped by the caller.
+    OH_NN_ReturnCode AllocateMapped(size_t length, int& fd, void*& data);
+    // length is the one passed to Allocate or AllocateMapped.
+    OH_NN_ReturnCode Release(int fd, size_t length);
+    // 0 disables the pool, the idle buffers above the new high-water mark are released at once.
+    void SetHighWaterMark(size_t highWaterMark);
+    void GetStatistics(OH_NN_BufferPoolStatistics& statistics) const;
+
+    // Bytes of the idle buffers held by all pools of the process.
+    static size_t GetTotalCachedBytes()
+    {
+        return s_totalCachedBytes.load(std::memory_order_relaxed);
+    }
+
+    // Releases the idle buffers of the pools of the process, each from its least recently released one, until the
+    // bytes they hold do not exceed the limit.
+    static void TrimAll(size_t limit);
+
+    // Rounds up to a page, and to a quarter of the power of two below the length, so at most 25% is wasted.
+    static size_t GetClassSize(size_t length);
+
+private:
+    SharedBufferPool(const SharedBufferPool&) = delete;
+    SharedBufferPool& operator=(const SharedBufferPool&) = delete;
+
+    struct IdleBuffer {
+        int fd {-1};
+        void* data {nullptr};
+        uint64_t releaseSeq {0};
+    };
+    struct UsedBuffer {
+        // The class size if the buffer is pooled, otherwise the length it is allocated with.
+        size_t size {0};
+        bool isPooled {false};
+        void* data {nullptr};
+    };
+    struct TrimmedBuffer {
+        int fd {-1};
+        void* data {nullptr};
+        size_t size {0};
+    };
+
+    OH_NN_ReturnCode AllocateInner(size_t length, bool isMapped, int& fd, void*& data);
+    // Takes the idle buffers out of the pool until the cached bytes do not exceed the limit.
+    void TrimLocked(size_t limit, std::vector<TrimmedBuffer>& trimmedBuffers);
+    void ReleaseTrimmedBuffers(const std::vector<TrimmedBuffer>& trimmedBuffers);
+    static void Unmap(void* data, size_t size);
+
+private:
+    AllocateBufferFunc m_allocate;
+    ReleaseBufferFunc m_release;
+    mutable std::mutex m_mtx;
+    // class size -> idle buffers of the class, from the least recently released one
+    std::unordered_map<size_t, std::deque<IdleBuffer>> m_idleBuffers;
+    // fd -> buffer allocated from the pool and not released yet, the buffers too large to be pooled are tracked only
+    // if they are mapped by the pool
+    std::unordered_map<int, UsedBuffer> m_usedBuffers;
+    size_t m_highWaterMark;
+    size_t m_cachedBytes {0};
+    size_t m_cachedCount {0};
+    uint64_t m_releaseSeq {0};
+    uint64_t m_hitCount {0};
+    uint64_t m_missCount {0};
+    uint64_t m_trimCount {0};
+    uint64_t m_trimmedBytes {0};
+    static std::atomic<size_t> s_totalCachedBytes;
+    // Pools of the process, from the earliest created one. Held by TrimAll, so a pool is not destroyed meanwhile.
+    static std::mutex s_poolsMtx;
+    static std::vector<SharedBufferPool*> s_pools;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_SHARED_BUFFER_POOL_H
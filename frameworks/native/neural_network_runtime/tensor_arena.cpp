@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensor_arena.h"
+
+#include "cpp_type.h"
+#include "log.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+TensorArena::TensorArena(size_t backendID) : m_backendID(backendID) {}
+
+OH_NN_ReturnCode TensorArena::Init(size_t size)
+{
+    if (m_buffer != nullptr) {
+        LOGE("[TensorArena] Init failed, the arena has been initialized.");
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    if (size == 0 || size > ALLOCATE_BUFFER_LIMIT) {
+        LOGE("[TensorArena] Init failed, Invalid buffer size, "
+             "it must greater than 0 and less than 1Gb. length=%{public}zu", size);
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    // The buffer is a tensor of bytes, so that it is allocated, mapped and released like any other tensor.
+    TensorDesc desc;
+    OH_NN_ReturnCode ret = desc.SetDataType(OH_NN_UINT8);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[TensorArena] Init failed, failed to set data type of the buffer.");
+        return ret;
+    }
+    int32_t shape = static_cast<int32_t>(size);
+    ret = desc.SetShape(&shape, 1);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[TensorArena] Init failed, failed to set shape of the buffer.");
+        return ret;
+    }
+
+    std::shared_ptr<NNTensor2_0> buffer = std::make_shared<NNTensor2_0>(m_backendID);
+    ret = buffer->SetTensorDesc(&desc);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[TensorArena] Init failed, failed to set tensor desc of the buffer.");
+        return ret;
+    }
+    ret = buffer->CreateData(size);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[TensorArena] Init failed, failed to create the buffer.");
+        return ret;
+    }
+
+    m_buffer = buffer;
+    m_size = size;
+    return OH_NN_SUCCESS;
+}
+
+NNTensor2_0* TensorArena::CreateView(const TensorDesc* desc, size_t offset)
+{
+    if (m_buffer == nullptr) {
+        LOGE("[TensorArena] CreateView failed, the arena has not been initialized.");
+        return nullptr;
+    }
+
+    NNTensor2_0* tensor = new (std::nothrow) NNTensor2_0(m_backendID);
+    if (tensor == nullptr) {
+        LOGE("[TensorArena] CreateView failed, error happened when allocating NN Tensor.");
+        return nullptr;
+    }
+    OH_NN_ReturnCode ret = tensor->SetTensorDesc(desc);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[TensorArena] CreateView failed, error happened when setting tensor desc.");
+        delete tensor;
+        return nullptr;
+    }
+    ret = tensor->CreateView(m_buffer, offset);
+    if (ret != OH_NN_SUCCESS) {
+        LOGE("[TensorArena] CreateView failed, error happened when creating the view.");
+        delete tensor;
+        return nullptr;
+    }
+    return tensor;
+}
+
+Tensor* TensorArena::CreateTensor(const TensorDesc* desc, size_t alignment)
+{
+    if (desc == nullptr) {
+        LOGE("[TensorArena] CreateTensor failed, desc is nullptr.");
+        return nullptr;
+    }
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        LOGE("[TensorArena] CreateTensor failed, alignment %{public}zu is not a power of 2.", alignment);
+        return nullptr;
+    }
+    size_t byteSize = 0;
+    if (desc->GetByteSize(&byteSize) != OH_NN_SUCCESS) {
+        LOGE("[TensorArena] CreateTensor failed, failed to get byte size from desc.");
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mtx);
+    size_t offset = (m_usedSize + alignment - 1) & ~(alignment - 1);
+    if (offset < m_usedSize || offset > m_size || byteSize > m_size - offset) {
+        LOGE("[TensorArena] CreateTensor failed, %{public}zu bytes are left in the arena, %{public}zu are required.",
+            m_size - m_usedSize, byteSize);
+        return nullptr;
+    }
+
+    NNTensor2_0* tensor = CreateView(desc, offset);
+    if (tensor == nullptr) {
+        return nullptr;
+    }
+    m_usedSize = offset + byteSize;
+    return tensor;
+}
+
+Tensor* TensorArena::CreateTensorAt(const TensorDesc* desc, size_t offset)
+{
+    if (desc == nullptr) {
+        LOGE("[TensorArena] CreateTensorAt failed, desc is nullptr.");
+        return nullptr;
+    }
+
+    return CreateView(desc, offset);
+}
+
+OH_NN_ReturnCode TensorArena::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    // Every view holds a reference to the buffer besides the arena.
+    if (m_buffer != nullptr && m_buffer.use_count() > 1) {
+        LOGE("[TensorArena] Reset failed, %{public}ld tensors of the arena have not been destroyed.",
+            m_buffer.use_count() - 1);
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+    m_usedSize = 0;
+    return OH_NN_SUCCESS;
+}
+
+size_t TensorArena::GetSize() const
+{
+    return m_size;
+}
+
+size_t TensorArena::GetUsedSize()
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_usedSize;
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
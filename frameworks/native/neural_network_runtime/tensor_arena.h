@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_TENSOR_ARENA_H
+#define NEURAL_NETWORK_RUNTIME_TENSOR_ARENA_H
+
+#include <memory>
+#include <mutex>
+
+#include "nntensor.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+constexpr size_t TENSOR_ARENA_DEFAULT_ALIGNMENT = 64;
+
+// One device buffer which is allocated and mapped once, the tensors created by the arena are views of it.
+// Each view keeps the buffer alive, so the arena may be destroyed before its tensors.
+class TensorArena {
+public:
+    explicit TensorArena(size_t backendID);
+    ~TensorArena() = default;
+
+    OH_NN_ReturnCode Init(size_t size);
+    // Creates a view after the previous one, at an offset aligned to alignment, which must be a power of 2.
+    Tensor* CreateTensor(const TensorDesc* desc, size_t alignment);
+    // Creates a view at the offset, which may overlap others, e.g. a slice of a batch tensor created by the arena.
+    Tensor* CreateTensorAt(const TensorDesc* desc, size_t offset);
+    // Makes the whole buffer available to CreateTensor() again, once all views have been destroyed.
+    OH_NN_ReturnCode Reset();
+    size_t GetSize() const;
+    size_t GetUsedSize();
+
+private:
+    TensorArena(const TensorArena&) = delete;
+    TensorArena& operator=(const TensorArena&) = delete;
+
+    NNTensor2_0* CreateView(const TensorDesc* desc, size_t offset);
+
+private:
+    size_t m_backendID {0};
+    std::shared_ptr<NNTensor2_0> m_buffer {nullptr};
+    size_t m_size {0};
+    size_t m_usedSize {0};
+    std::mutex m_mtx;
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_TENSOR_ARENA_H
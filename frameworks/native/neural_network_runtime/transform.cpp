@@ -15,6 +15,8 @@
 
 #include "transform.h"
 
+#include <cstdint>
+
 #include "log.h"
 
 namespace OHOS {
@@ -49,6 +51,26 @@ uint32_t GetTypeSize(OH_NN_DataType type)
     }
 }
 
+bool GetTensorSize(const mindspore::lite::TensorPtr tensor, size_t& size)
+{
+    uint32_t typeSize = GetTypeSize(MSToNN::TransformDataType(mindspore::lite::MindIR_Tensor_GetDataType(tensor)));
+    if (typeSize == 0) {
+        return false;
+    }
+
+    size = typeSize;
+    for (int32_t dim : mindspore::lite::MindIR_Tensor_GetDims(tensor)) {
+        if (dim < 0) {
+            return false;
+        }
+        if (dim != 0 && size > SIZE_MAX / static_cast<size_t>(dim)) {
+            return false;
+        }
+        size *= static_cast<size_t>(dim);
+    }
+    return true;
+}
+
 mindspore::lite::DataType NNToMS::TransformDataType(OH_NN_DataType type)
 {
     switch (type) {
@@ -35,6 +35,8 @@ std::vector<T> ConstructVectorFromArray(const T* data, size_t size)
 }
 
 uint32_t GetTypeSize(OH_NN_DataType type);
+// Size of the data of the tensor from its shape, returns false if it is unknown before execution.
+bool GetTensorSize(const mindspore::lite::TensorPtr tensor, size_t& size);
 
 
 namespace NNToMS {
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "weight_store.h"
+
+#include <algorithm>
+#include <atomic>
+#include <sys/mman.h>
+
+#include "async_run_pool.h"
+#include "lite_graph_conversion.h"
+#include "log.h"
+#include "mapping_policy.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+constexpr uint64_t HASH_COMBINE_SEED = 0x9e3779b97f4a7c15;
+
+void HashCombine(uint64_t& hash, uint64_t value)
+{
+    hash ^= value + HASH_COMBINE_SEED + (hash << 6) + (hash >> 2);
+}
+
+bool CopyTensors(const mindspore::lite::LiteGraph* liteGraph, WeightBlob& weights)
+{
+    weights.dataSizes.reserve(liteGraph->all_tensors_.size());
+    size_t offset {0};
+    for (auto tensor : liteGraph->all_tensors_) {
+        std::vector<uint8_t> tensorData = mindspore::lite::MindIR_Tensor_GetData(tensor);
+        if (tensorData.size() > weights.size - offset) {
+            LOGE("[WeightStore] Tensor data exceeds the const tensor size of %{public}zu bytes.", weights.size);
+            return false;
+        }
+        if (!tensorData.empty() &&
+            memcpy_s(weights.data + offset, weights.size - offset, tensorData.data(), tensorData.size()) != EOK) {
+            LOGE("[WeightStore] Copy the tensor data failed.");
+            return false;
+        }
+        weights.dataSizes.emplace_back(tensorData.size());
+        offset += tensorData.size();
+    }
+    return true;
+}
+
+// Copies the tensors in parallel at the offsets laid out from their shapes, the layout is the one of CopyTensors.
+// Returns false, with nothing to undo, if the data does not match the layout.
+bool CopyTensorsParallel(const mindspore::lite::LiteGraph* liteGraph, WeightBlob& weights)
+{
+    std::vector<size_t> offsets;
+    std::vector<size_t> sizes;
+    if (!LayoutTensorData(liteGraph, weights.size, offsets, sizes)) {
+        return false;
+    }
+
+    std::atomic<bool> isLaidOut {true};
+    AsyncRunPool::GetInstance()->ParallelFor(sizes.size(), [&](size_t index) {
+        if (isLaidOut.load(std::memory_order_relaxed) &&
+            !CopyTensorData(liteGraph->all_tensors_[index], weights.data + offsets[index], sizes[index])) {
+            isLaidOut.store(false, std::memory_order_relaxed);
+        }
+    });
+    if (!isLaidOut.load()) {
+        LOGW("[WeightStore] Tensor data does not match the shapes, copy the weights sequentially.");
+        return false;
+    }
+    weights.dataSizes = std::move(sizes);
+    return true;
+}
+
+// Compared byte by byte, a model must never get the weights of another one. Large weights are compared on the async
+// run pool too, the comparison stops at the first tensor which differs.
+bool IsSameWeights(const mindspore::lite::LiteGraph* liteGraph, const WeightBlob& weights)
+{
+    size_t tensorNum = liteGraph->all_tensors_.size();
+    if (weights.dataSizes.size() != tensorNum) {
+        return false;
+    }
+    std::vector<size_t> offsets(tensorNum, 0);
+    size_t offset {0};
+    for (size_t i = 0; i < tensorNum; ++i) {
+        offsets[i] = offset;
+        offset += weights.dataSizes[i];
+    }
+
+    std::atomic<bool> isSame {true};
+    auto compareTensor = [&](size_t index) {
+        if (!isSame.load(std::memory_order_relaxed)) {
+            return;
+        }
+        std::vector<uint8_t> data = mindspore::lite::MindIR_Tensor_GetData(liteGraph->all_tensors_[index]);
+        if (data.size() != weights.dataSizes[index] ||
+            (!data.empty() && memcmp(weights.data + offsets[index], data.data(), data.size()) != 0)) {
+            isSame.store(false, std::memory_order_relaxed);
+        }
+    };
+    if (weights.size < PARALLEL_CONVERSION_MIN_SIZE) {
+        for (size_t i = 0; i < tensorNum; ++i) {
+            compareTensor(i);
+        }
+    } else {
+        AsyncRunPool::GetInstance()->ParallelFor(tensorNum, compareTensor);
+    }
+    return isSame.load();
+}
+} // namespace
+
+WeightStore::WeightStore(AllocateBufferFunc&& allocate, ReleaseBufferFunc&& release)
+    : m_allocate(std::move(allocate)), m_release(std::make_shared<ReleaseBufferFunc>(std::move(release)))
+{}
+
+OH_NN_ReturnCode WeightStore::Acquire(const mindspore::lite::LiteGraph* liteGraph,
+    std::shared_ptr<const WeightBlob>& blob)
+{
+    if (liteGraph == nullptr) {
+        LOGE("[WeightStore] Acquire failed, lite graph is nullptr.");
+        return OH_NN_INVALID_PARAMETER;
+    }
+
+    size_t size = mindspore::lite::MindIR_LiteGraph_GetConstTensorSize(liteGraph);
+    if (size == 0) {
+        auto emptyBlob = std::make_shared<WeightBlob>();
+        emptyBlob->dataSizes.assign(liteGraph->all_tensors_.size(), 0);
+        blob = emptyBlob;
+        return OH_NN_SUCCESS;
+    }
+
+    // Looked up before anything is allocated or copied, a shared blob costs one read of the graph.
+    uint64_t key {0};
+    HashCombine(key, liteGraph->all_tensors_.size());
+    HashCombine(key, size);
+    blob = Find(liteGraph, key);
+    if (blob != nullptr) {
+        LOGI("[WeightStore] Share the weights of %{public}zu bytes.", size);
+        return OH_NN_SUCCESS;
+    }
+
+    std::shared_ptr<WeightBlob> newBlob;
+    OH_NN_ReturnCode ret = Upload(liteGraph, size, newBlob);
+    if (ret != OH_NN_SUCCESS) {
+        return ret;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mtx);
+    // The expired blobs are swept whenever a new one is added.
+    for (auto iter = m_blobs.begin(); iter != m_blobs.end();) {
+        auto& blobs = iter->second;
+        blobs.erase(std::remove_if(blobs.begin(), blobs.end(),
+            [](const std::weak_ptr<const WeightBlob>& weakBlob) { return weakBlob.expired(); }), blobs.end());
+        iter = blobs.empty() ? m_blobs.erase(iter) : std::next(iter);
+    }
+    m_blobs[key].emplace_back(newBlob);
+    blob = newBlob;
+    return OH_NN_SUCCESS;
+}
+
+std::shared_ptr<const WeightBlob> WeightStore::Find(const mindspore::lite::LiteGraph* liteGraph, uint64_t key)
+{
+    std::vector<std::shared_ptr<const WeightBlob>> candidates;
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        auto iter = m_blobs.find(key);
+        if (iter == m_blobs.end()) {
+            return nullptr;
+        }
+        for (const auto& weakBlob : iter->second) {
+            std::shared_ptr<const WeightBlob> candidate = weakBlob.lock();
+            if (candidate != nullptr) {
+                candidates.emplace_back(std::move(candidate));
+            }
+        }
+    }
+
+    // Not locked, the other builds look up and upload their weights meanwhile.
+    for (auto& candidate : candidates) {
+        if (IsSameWeights(liteGraph, *candidate)) {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            ++m_shareCount;
+            return candidate;
+        }
+    }
+    return nullptr;
+}
+
+OH_NN_ReturnCode WeightStore::Upload(const mindspore::lite::LiteGraph* liteGraph, size_t size,
+    std::shared_ptr<WeightBlob>& blob)
+{
+    int fd {-1};
+    OH_NN_ReturnCode ret = m_allocate(size, fd);
+    if (ret != OH_NN_SUCCESS || fd < 0) {
+        LOGE("[WeightStore] Allocate the buffer of %{public}zu bytes failed.", size);
+        return OH_NN_MEMORY_ERROR;
+    }
+
+    void* data = MappingPolicy::Map(size, PROT_READ | PROT_WRITE, fd, 0);
+    if (data == MAP_FAILED) {
+        LOGE("[WeightStore] Map the buffer failed.");
+        (*m_release)(fd, size);
+        return OH_NN_MEMORY_ERROR;
+    }
+
+    // The deleter keeps the release function alive, a blob may be released after the store is destroyed.
+    std::shared_ptr<ReleaseBufferFunc> release = m_release;
+    auto deleter = [release](WeightBlob* weights) {
+        if (munmap(weights->data, weights->size) != 0) {
+            LOGW("[WeightStore] Unmap the buffer failed.");
+        }
+        if ((*release)(weights->fd, weights->size) != OH_NN_SUCCESS) {
+            LOGW("[WeightStore] Release the buffer failed.");
+        }
+        delete weights;
+    };
+    auto* weights = new (std::nothrow) WeightBlob();
+    if (weights == nullptr) {
+        LOGE("[WeightStore] Create the blob failed.");
+        munmap(data, size);
+        (*m_release)(fd, size);
+        return OH_NN_MEMORY_ERROR;
+    }
+    weights->fd = fd;
+    weights->size = size;
+    weights->data = static_cast<uint8_t*>(data);
+    std::shared_ptr<WeightBlob> newBlob(weights, deleter);
+
+    // Large weights are copied on the async run pool too, the copy falls back to the calling thread only.
+    if ((size < PARALLEL_CONVERSION_MIN_SIZE || !CopyTensorsParallel(liteGraph, *newBlob)) &&
+        !CopyTensors(liteGraph, *newBlob)) {
+        return OH_NN_MEMORY_ERROR;
+    }
+    blob = newBlob;
+    return OH_NN_SUCCESS;
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_WEIGHT_STORE_H
+#define NEURAL_NETWORK_RUNTIME_WEIGHT_STORE_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "mindir.h"
+#include "shared_buffer_pool.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// Shared buffer holding the data of all tensors of a lite graph, one after another in the order of the tensors.
+struct WeightBlob {
+    int fd {-1};
+    size_t size {0};
+    // Mapping of the buffer, it lives as long as the blob. nullptr if the graph has no tensor data.
+    uint8_t* data {nullptr};
+    // Data size of each tensor, 0 for a tensor without data.
+    std::vector<size_t> dataSizes;
+};
+
+// Store of the weight blobs uploaded to a device.
+// A graph whose tensor data equals the one of a blob which is still alive shares that blob instead of uploading its
+// weights again, so the prepared models of the same model hold one copy of the weights. The candidates are looked up
+// by the number of tensors and the size of the weights, and compared byte by byte with the graph before anything is
+// allocated. A blob lives as long as a prepared model refers to it.
+class WeightStore {
+public:
+    WeightStore(AllocateBufferFunc&& allocate, ReleaseBufferFunc&& release);
+
+    OH_NN_ReturnCode Acquire(const mindspore::lite::LiteGraph* liteGraph, std::shared_ptr<const WeightBlob>& blob);
+
+    uint64_t GetShareCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        return m_shareCount;
+    }
+
+private:
+    WeightStore(const WeightStore&) = delete;
+    WeightStore& operator=(const WeightStore&) = delete;
+
+    std::shared_ptr<const WeightBlob> Find(const mindspore::lite::LiteGraph* liteGraph, uint64_t key);
+    // Copies the data of each tensor once, straight to the shared buffer. Weights of PARALLEL_CONVERSION_MIN_SIZE or
+    // more are copied on the async run pool too.
+    OH_NN_ReturnCode Upload(const mindspore::lite::LiteGraph* liteGraph, size_t size,
+        std::shared_ptr<WeightBlob>& blob);
+
+private:
+    AllocateBufferFunc m_allocate;
+    // Shared by the blobs, which may outlive the store.
+    std::shared_ptr<ReleaseBufferFunc> m_release;
+    mutable std::mutex m_mtx;
+    // hash of the tensor number and the weight size -> blobs held by prepared models
+    std::unordered_map<uint64_t, std::vector<std::weak_ptr<const WeightBlob>>> m_blobs;
+    uint64_t m_shareCount {0};
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_WEIGHT_STORE_H
@@ -190,6 +190,723 @@ OH_NN_ReturnCode OH_NNExecutor_RunSyncWithAipp(OH_NNExecutor *executor,
                                                size_t outputCount,
                                                const char* aippString);
 
+/**
+ * @brief 定义执行器池句柄。
+ *
+ * 执行器池中的多个执行上下文共享同一个编译后模型，可在多个线程中并发执行推理。
+ *
+ * @since 11
+ * @version 1.0
+ */
+typedef struct OH_NNExecutorPool OH_NNExecutorPool;
+
+/**
+ * @brief Creates an executor pool with <b>contextCount</b> execution contexts sharing one compiled model.
+ *
+ * The contexts are created on top of a single {@link OH_NNExecutor}, so the prepared model, the tensor descriptions
+ * and the scheduling are set up only once. Each context keeps its own output shapes, which are returned through the
+ * tensor descriptions of the output tensors passed to {@link OH_NNExecutorPool_RunSync}. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param compilation Pointer to the {@link OH_NNCompilation} instance.
+ * @param contextCount Number of execution contexts, which is the max number of concurrent executions.
+ * @return Pointer to a {@link OH_NNExecutorPool} instance, or NULL if it fails to create.
+ * @since 11
+ * @version 1.0
+ */
+OH_NNExecutorPool *OH_NNExecutorPool_Construct(OH_NNCompilation *compilation, size_t contextCount);
+
+/**
+ * @brief Synchronous execution of the model inference on an idle context of the executor pool.
+ *
+ * The method can be called from several threads at the same time. It blocks until a context is idle if all contexts
+ * are busy. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executorPool Pointer to the {@link OH_NNExecutorPool} instance.
+ * @param inputTensor An array of input tensors {@link NN_Tensor}.
+ * @param inputCount Number of input tensors.
+ * @param outputTensor An array of output tensors {@link NN_Tensor}.
+ * @param outputCount Number of output tensors.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the operation fails, an error code is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNExecutorPool_RunSync(OH_NNExecutorPool *executorPool,
+                                           NN_Tensor *inputTensor[],
+                                           size_t inputCount,
+                                           NN_Tensor *outputTensor[],
+                                           size_t outputCount);
+
+/**
+ * @brief Destroys an executor pool instance to release the memory occupied by it.
+ *
+ * No execution should be running on the pool when it is destroyed. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executorPool Double pointer to the {@link OH_NNExecutorPool} instance.
+ * @since 11
+ * @version 1.0
+ */
+void OH_NNExecutorPool_Destroy(OH_NNExecutorPool **executorPool);
+
+/**
+ * @brief 定义单个执行阶段的时延统计，时延单位为微秒。
+ *
+ * 分位数由对数分桶直方图估计，相对误差不超过25%，且不超过最大值。
+ *
+ * @since 11
+ * @version 1.0
+ */
+typedef struct OH_NN_LatencyStatistics {
+    /** Number of recorded executions. */
+    uint64_t count;
+    /** 50th percentile of the latency. */
+    uint64_t p50;
+    /** 90th percentile of the latency. */
+    uint64_t p90;
+    /** 99th percentile of the latency. */
+    uint64_t p99;
+    /** Max latency. */
+    uint64_t max;
+} OH_NN_LatencyStatistics;
+
+/**
+ * @brief 定义执行器的时延统计，只统计执行成功的推理。
+ *
+ * @since 11
+ * @version 1.0
+ */
+typedef struct OH_NN_ExecutorStatistics {
+    /** From the submission of the execution to its start, including waiting for the executor. */
+    OH_NN_LatencyStatistics queue;
+    /** Execution of the prepared model on the device. */
+    OH_NN_LatencyStatistics run;
+    /** Update of the output tensors after the device run. */
+    OH_NN_LatencyStatistics postProcess;
+    /** From the submission of the execution to its end. */
+    OH_NN_LatencyStatistics total;
+    /** Number of copies from user buffers to device buffers by {@link OH_NNExecutor_SetInput}. */
+    uint64_t inputCopyCount;
+    /** Number of bytes copied from user buffers to device buffers by {@link OH_NNExecutor_SetInput}. */
+    uint64_t inputCopyBytes;
+    /** Number of copies from device buffers to user buffers by {@link OH_NNExecutor_Run}. */
+    uint64_t outputCopyCount;
+    /** Number of bytes copied from device buffers to user buffers by {@link OH_NNExecutor_Run}. */
+    uint64_t outputCopyBytes;
+} OH_NN_ExecutorStatistics;
+
+/**
+ * @brief Obtains the latency statistics of the executions of an executor.
+ *
+ * The latencies are measured with a monotonic clock in microseconds, for every successful execution of
+ * {@link OH_NNExecutor_RunSync} and {@link OH_NNExecutor_RunAsync}, and of the executor pool built on the executor.
+ * The statistics are collected without locks and can be obtained while executions are running. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executor Pointer to the {@link OH_NNExecutor} instance.
+ * @param statistics Pointer to the {@link OH_NN_ExecutorStatistics} which receives the statistics.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the operation fails, an error code is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNExecutor_GetStatistics(const OH_NNExecutor *executor, OH_NN_ExecutorStatistics *statistics);
+
+/**
+ * @brief Registers a user buffer mapped from a shareable file descriptor, so that it is used without copying.
+ *
+ * <b>buffer</b> must be the start address where the user has mapped <b>fd</b>, such as an ashmem region, with at least
+ * <b>length</b> bytes. After registration, {@link OH_NNExecutor_SetInput} and {@link OH_NNExecutor_SetOutput} with
+ * the buffer share it with the device directly, the input is not copied to a device buffer and the output is not
+ * copied back by {@link OH_NNExecutor_Run}. A buffer can be registered with one executor at a time, and it must stay
+ * mapped until it is unregistered or the executor is destroyed. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executor Pointer to the {@link OH_NNExecutor} instance.
+ * @param buffer Start address of the mapped buffer.
+ * @param length Length of the buffer in bytes.
+ * @param fd File descriptor which the buffer is mapped from.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the operation fails, an error code is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNExecutor_RegisterBuffer(OH_NNExecutor *executor, void *buffer, size_t length, int fd);
+
+/**
+ * @brief Unregisters a buffer registered by {@link OH_NNExecutor_RegisterBuffer}.
+ *
+ * The buffer must not be set to any input or output of the executor. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executor Pointer to the {@link OH_NNExecutor} instance.
+ * @param buffer Start address of the registered buffer.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the operation fails, an error code is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNExecutor_UnregisterBuffer(OH_NNExecutor *executor, void *buffer);
+
+/**
+ * @brief 定义设备共享内存池的统计信息。
+ *
+ * @since 11
+ * @version 1.0
+ */
+typedef struct OH_NN_BufferPoolStatistics {
+    /** Number of allocations served by an idle buffer of the pool. */
+    uint64_t hitCount;
+    /** Number of allocations which have allocated a new buffer from the device. */
+    uint64_t missCount;
+    /** Bytes of the idle buffers held by the pool. */
+    uint64_t cachedBytes;
+    /** Number of the idle buffers held by the pool. */
+    uint64_t cachedCount;
+    /** Number of idle buffers released to the device because the high-water mark is exceeded. */
+    uint64_t trimCount;
+    /** Bytes of idle buffers released to the device because the high-water mark is exceeded. */
+    uint64_t trimmedBytes;
+    /** Max bytes of the idle buffers held by the pool. */
+    uint64_t highWaterMark;
+} OH_NN_BufferPoolStatistics;
+
+/**
+ * @brief Sets the high-water mark of the shared buffer pool of a device.
+ *
+ * The shared buffers of tensors created on the device are returned to the pool of the device when they are released,
+ * and reused by later allocations of the same size class without calling the device. Idle buffers are released to
+ * the device from the least recently used one once their bytes exceed the high-water mark, which is 64 MB by default.
+ * 0 disables the pool and releases all idle buffers. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param deviceID Device ID.
+ * @param highWaterMark Max bytes of the idle buffers held by the pool.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the operation fails, an error code is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNDevice_SetBufferPoolHighWaterMark(size_t deviceID, size_t highWaterMark);
+
+/**
+ * @brief Obtains the statistics of the shared buffer pool of a device.
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param deviceID Device ID.
+ * @param statistics Pointer to the {@link OH_NN_BufferPoolStatistics} which receives the statistics.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the device has no buffer pool, <b>OH_NN_OPERATION_FORBIDDEN</b> is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNDevice_GetBufferPoolStatistics(size_t deviceID, OH_NN_BufferPoolStatistics *statistics);
+
+/**
+ * @brief 定义进程内已加载模型的内存统计信息。
+ *
+ * @since 11
+ * @version 1.0
+ */
+typedef struct OH_NN_ModelMemoryStatistics {
+    /** Memory budget in bytes, 0 if it is unlimited. */
+    uint64_t budget;
+    /** Bytes of the loaded models of all executors. */
+    uint64_t loadedBytes;
+    /** Number of the executors whose model is loaded. */
+    uint64_t loadedCount;
+    /** Bytes of the idle shared buffers held by the buffer pools of all devices. */
+    uint64_t pooledBytes;
+    /** Number of models unloaded because the budget is exceeded. */
+    uint64_t evictCount;
+} OH_NN_ModelMemoryStatistics;
+
+/**
+ * @brief Sets the memory budget of the loaded models of the process.
+ *
+ * Once the bytes of the loaded models plus the idle shared buffers of the buffer pools exceed the budget, the models of
+ * the least recently used executors are unloaded, and each of them is loaded again by the next execution of its
+ * executor. Only models which can be loaded again from the model cache are unloaded, and the model of the last loaded
+ * executor is always kept. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param budget Memory budget in bytes, 0 means unlimited, which is the default.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the operation fails, an error code is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NN_SetModelMemoryBudget(size_t budget);
+
+/**
+ * @brief Obtains the memory statistics of the loaded models of the process.
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param statistics Pointer to the {@link OH_NN_ModelMemoryStatistics} which receives the statistics.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the operation fails, an error code is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NN_GetModelMemoryStatistics(OH_NN_ModelMemoryStatistics *statistics);
+
+/**
+ * @brief 定义一类内存的当前字节数和峰值字节数。
+ *
+ * @since 11
+ * @version 1.0
+ */
+typedef struct OH_NN_MemoryUsage {
+    /** Bytes currently held. */
+    uint64_t liveBytes;
+    /** Max bytes held at the same time since the owner has been created. */
+    uint64_t peakBytes;
+} OH_NN_MemoryUsage;
+
+/**
+ * @brief 定义编译实例、执行器或进程持有的各类内存统计信息。
+ *
+ * @since 11
+ * @version 1.0
+ */
+typedef struct OH_NN_MemoryStatistics {
+    /**
+     * Weights of the prepared models. A model shared by a compilation and its executors is counted by each of them,
+     * and once by the process.
+     */
+    OH_NN_MemoryUsage weights;
+    /** Device buffers of the input and output tensors. */
+    OH_NN_MemoryUsage ioTensors;
+    /** Mapped model cache files. */
+    OH_NN_MemoryUsage cacheMappings;
+    /** Intermediate copies, such as the constant tensors sent to the device and the copies of user buffers. */
+    OH_NN_MemoryUsage staging;
+} OH_NN_MemoryStatistics;
+
+/**
+ * @brief Obtains the memory held by a compilation.
+ *
+ * The statistics are available once {@link OH_NNCompilation_Build} has been called. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param compilation Pointer to the {@link OH_NNCompilation} instance.
+ * @param statistics Pointer to the {@link OH_NN_MemoryStatistics} which receives the statistics.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the compilation has not been built, <b>OH_NN_OPERATION_FORBIDDEN</b> is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNCompilation_GetMemoryStatistics(const OH_NNCompilation *compilation,
+                                                      OH_NN_MemoryStatistics *statistics);
+
+/**
+ * @brief Obtains the memory held by an executor.
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executor Pointer to the {@link OH_NNExecutor} instance.
+ * @param statistics Pointer to the {@link OH_NN_MemoryStatistics} which receives the statistics.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the operation fails, an error code is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNExecutor_GetMemoryStatistics(const OH_NNExecutor *executor,
+                                                   OH_NN_MemoryStatistics *statistics);
+
+/**
+ * @brief Obtains the memory held by the process.
+ *
+ * The statistics of the process include the memory of all compilations and executors, and the device buffers of the
+ * tensors created by {@link OH_NNTensor_Create} and its variants, which are not owned by any executor. The weights of
+ * a prepared model are counted once, however many compilations and executors share it. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param statistics Pointer to the {@link OH_NN_MemoryStatistics} which receives the statistics.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the operation fails, an error code is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NN_GetMemoryStatistics(OH_NN_MemoryStatistics *statistics);
+
+/**
+ * @brief Writes the memory statistics of the process and of every living compilation and executor to a file.
+ *
+ * Each line of the file describes one owner, starting with its name and followed by the live and peak bytes of every
+ * category. The file is overwritten if it exists. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param path Path of the file.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the file cannot be written, <b>OH_NN_INVALID_FILE</b> is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NN_DumpMemoryStatistics(const char *path);
+
+/**
+ * @brief 定义张量内存池句柄。
+ *
+ * 张量内存池只申请并映射一块设备共享内存，其创建的张量都是该内存在不同偏移处的视图。
+ *
+ * @since 11
+ * @version 1.0
+ */
+typedef struct OH_NNTensorArena OH_NNTensorArena;
+
+/**
+ * @brief Creates a tensor arena, which allocates and maps one shared buffer of <b>size</b> bytes on the device.
+ *
+ * The tensors created by the arena are views of the buffer, which cost neither an allocation nor a mapping. The
+ * inputs and outputs of an execution can be created by one arena, and the slices of a batch can be views of the
+ * batch tensor. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param deviceID Device ID.
+ * @param size Bytes of the shared buffer, at most 1 GB.
+ * @return Pointer to a {@link OH_NNTensorArena} instance, or NULL if it fails to create.
+ * @since 11
+ * @version 1.0
+ */
+OH_NNTensorArena *OH_NNTensorArena_Create(size_t deviceID, size_t size);
+
+/**
+ * @brief Creates a tensor in the arena, after the tensors created before.
+ *
+ * The data of the tensor starts at the first offset aligned to <b>alignment</b> which is not used by the arena.
+ * The tensor is destroyed by {@link OH_NNTensor_Destroy}, and keeps the shared buffer alive, so it may be used after
+ * the arena has been destroyed. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param arena Pointer to the {@link OH_NNTensorArena} instance.
+ * @param tensorDesc Pointer to the {@link NN_TensorDesc} instance.
+ * @param alignment Alignment of the data in bytes, which must be a power of 2. 0 means 64 bytes.
+ * @return Pointer to a {@link NN_Tensor} instance, or NULL if the arena has not enough space left.
+ * @since 11
+ * @version 1.0
+ */
+NN_Tensor *OH_NNTensorArena_CreateTensor(OH_NNTensorArena *arena, NN_TensorDesc *tensorDesc, size_t alignment);
+
+/**
+ * @brief Creates a tensor in the arena, whose data starts at <b>offset</b> of the shared buffer.
+ *
+ * The tensor may overlap other tensors of the arena, e.g. one sample of a batch tensor. The space used by
+ * {@link OH_NNTensorArena_CreateTensor} is not changed. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param arena Pointer to the {@link OH_NNTensorArena} instance.
+ * @param tensorDesc Pointer to the {@link NN_TensorDesc} instance.
+ * @param offset Offset of the data in the shared buffer in bytes.
+ * @return Pointer to a {@link NN_Tensor} instance, or NULL if the data exceeds the shared buffer.
+ * @since 11
+ * @version 1.0
+ */
+NN_Tensor *OH_NNTensorArena_CreateTensorAt(OH_NNTensorArena *arena, NN_TensorDesc *tensorDesc, size_t offset);
+
+/**
+ * @brief Makes the whole shared buffer of the arena available again, e.g. for the tensors of the next execution.
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param arena Pointer to the {@link OH_NNTensorArena} instance.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If a tensor of the arena has not been destroyed, <b>OH_NN_OPERATION_FORBIDDEN</b> is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNTensorArena_Reset(OH_NNTensorArena *arena);
+
+/**
+ * @brief Destroys a tensor arena instance.
+ *
+ * The shared buffer is released once the tensors of the arena have been destroyed as well. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param arena Double pointer to the {@link OH_NNTensorArena} instance.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the operation fails, an error code is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNTensorArena_Destroy(OH_NNTensorArena **arena);
+
+/**
+ * @brief 定义共享内存映射策略的标志位。
+ *
+ * @since 11
+ * @version 1.0
+ */
+typedef enum {
+    /** Plain mappings, each page is faulted in on its first access. */
+    OH_NN_MAPPING_DEFAULT = 0,
+    /** Populate the page tables when mapping, and advise the kernel to read the pages ahead. */
+    OH_NN_MAPPING_PREFAULT = 1,
+    /** Advise the kernel to back the mapping with transparent huge pages where it supports them. */
+    OH_NN_MAPPING_HUGE_PAGE = 2
+} OH_NN_MappingFlag;
+
+/**
+ * @brief Sets the policy of the process for mapping tensor, weight and model cache buffers.
+ *
+ * The policy applies to the buffers of at least <b>threshold</b> bytes which are mapped afterwards. Prefaulting moves
+ * the page faults of the first access, e.g. of the first execution, to the creation of the buffer, at the cost of
+ * touching the whole buffer up front. 
+
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。
+
+ *
+ * @param flags Bitwise OR of {@link OH_NN_MappingFlag}, <b>OH_NN_MAPPING_DEFAULT</b> by default.
+ * @param threshold Min bytes of the buffers the policy applies to.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If <b>flags</b> has an unknown bit, <b>OH_NN_INVALID_PARAMETER</b> is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NN_SetMappingPolicy(uint32_t flags, size_t threshold);
+
+/**
+ * @brief 定义模型中间张量的内存规划统计信息。
+ *
+ * @since 11
+ * @version 1.0
+ */
+typedef struct OH_NN_MemoryPlanStatistics {
+    /** Bytes of one arena which holds all planned intermediate tensors, packed by their lifetimes. */
+    uint64_t arenaSize;
+    /** Bytes of the planned intermediate tensors if each of them had its own buffer. */
+    uint64_t naiveSize;
+    /** Number of the planned intermediate tensors. */
+    uint32_t plannedCount;
+    /** Number of the intermediate tensors whose size is unknown before execution, e.g. of a dynamic shape. */
+    uint32_t unplannedCount;
+} OH_NN_MemoryPlanStatistics;
+
+/**
+ * @brief Obtains the memory plan of the intermediate tensors of a model.
+ *
+ * The intermediate tensors are the tensors produced by an operation which are neither inputs nor outputs of the
+ * model. When the model is built, each of them is given an offset in one arena, so that the tensors which are not
+ * live at the same time share memory. The statistics estimate the memory of the model before it is compiled. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param model Pointer to the {@link OH_NNModel} instance.
+ * @param statistics Pointer to the {@link OH_NN_MemoryPlanStatistics} which receives the statistics.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the model has not been built, <b>OH_NN_OPERATION_FORBIDDEN</b> is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNModel_GetMemoryPlanStatistics(const OH_NNModel *model, OH_NN_MemoryPlanStatistics *statistics);
+
+/**
+ * @brief Declares that an output of the executor may share the buffer of an input.
+ *
+ * After the declaration, the same {@link NN_Tensor} can be passed as the input and the output to
+ * {@link OH_NNExecutor_RunSync} and {@link OH_NNExecutor_RunAsync}, the output overwrites the input in place.
+ * The alias is only allowed if the graph of the model shows that it is safe: the output is produced by an elementwise
+ * operation, the input has the same static shape and element size as the output, and the input is no longer read
+ * by any other operation when the output is written. Once an alias is declared, the runs of the executor reject the
+ * inputs and outputs which overlap without being declared as an alias, executors without any alias are not checked.
+ * An input can be aliased by one output only. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param executor Pointer to the {@link OH_NNExecutor} instance.
+ * @param outputIndex Index of the output, in the order of the model outputs.
+ * @param inputIndex Index of the input, in the order of the model inputs.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the output may not alias the input, <b>OH_NN_INVALID_PARAMETER</b> is returned.
+ *         If the graph of the model is unknown, e.g. the compilation is restored from the cache,
+ *         <b>OH_NN_OPERATION_FORBIDDEN</b> is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNExecutor_SetOutputAlias(OH_NNExecutor *executor, uint32_t outputIndex, uint32_t inputIndex);
+
+/**
+ * @brief Sets the value of a tensor, the buffer is borrowed from the caller instead of copied.
+ *
+ * Unlike {@link OH_NNModel_SetTensorData}, the model keeps a pointer to <b>dataBuffer</b> instead of a copy of it.
+ * The value is copied into the model when {@link OH_NNModel_Finish} builds it. Compiling the model for a device
+ * copies it twice more, each time the weights are uploaded: out of the model, then into the buffer shared with the
+ * device, which is released once the device has prepared the model. The caller must keep the buffer valid and
+ * unchanged until {@link OH_NNModel_Finish} succeeds or the model is destroyed, and releases it itself. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param model Pointer to the {@link OH_NNModel} instance.
+ * @param index Index of the tensor.
+ * @param dataBuffer Pointer to the value, which must not be <b>nullptr</b>.
+ * @param length Length of the value in bytes, which must equal the byte size of the tensor.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNModel_SetTensorDataBorrowed(OH_NNModel *model,
+                                                  uint32_t index,
+                                                  const void *dataBuffer,
+                                                  size_t length);
+
+/**
+ * @brief Sets the value of a tensor from a range of a file, e.g. a weight file.
+ *
+ * The range is mapped read-only and shared with the page cache, it is not copied until {@link OH_NNModel_Finish}
+ * builds the model, from then on the value is copied as for {@link OH_NNModel_SetTensorDataBorrowed}. The mapping
+ * is released once the model is built or destroyed, the caller may close <b>fd</b> right after this call. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param model Pointer to the {@link OH_NNModel} instance.
+ * @param index Index of the tensor.
+ * @param fd File descriptor of the file which holds the value.
+ * @param offset Offset of the value in the file in bytes, which does not have to be aligned.
+ * @param length Length of the value in bytes, which must equal the byte size of the tensor.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the range exceeds the file, <b>OH_NN_INVALID_PARAMETER</b> is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNModel_SetTensorDataFromFd(OH_NNModel *model, uint32_t index, int fd, size_t offset,
+                                                size_t length);
+
+/**
+ * @brief 定义模型构建时图优化的标志位。
+ *
+ * @since 11
+ * @version 1.0
+ */
+typedef enum {
+    /** The model is built without the graph passes. */
+    OH_NN_GRAPH_PASS_NONE = 0,
+    /** Evaluate the operations whose results only depend on constant tensors on the host. */
+    OH_NN_GRAPH_PASS_CONSTANT_FOLDING = 1,
+    /** Absorb a batch normalization, scale, bias addition or ReLU into the convolution or matrix multiplication
+     * which produces its input. */
+    OH_NN_GRAPH_PASS_OPERATOR_FUSION = 2,
+    /** Remove the operations whose results no output of the model needs. */
+    OH_NN_GRAPH_PASS_DEAD_CODE_ELIMINATION = 4,
+    /** Merge the operations of the same type, attributes and inputs into one of them. */
+    OH_NN_GRAPH_PASS_COMMON_SUBEXPRESSION_ELIMINATION = 8,
+    /** All of the graph passes, which run by default. */
+    OH_NN_GRAPH_PASS_ALL = 15
+} OH_NN_GraphPass;
+
+/**
+ * @brief Sets the graph passes which optimize the model when it is built.
+ *
+ * The passes run by {@link OH_NNModel_Finish} or {@link OH_NNModel_BuildFromLiteGraph}, so this method is called
+ * before them. The compilations of the model send the operations the passes leave to the device, a model built
+ * without them, e.g. to compare the results with the original operations, sends all of them. \n
+ *
+ * The passes are chosen for the model, not for a compilation: every compilation of the model sends the same
+ * operations, and a compilation with other passes needs another model built with them. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param model Pointer to the {@link OH_NNModel} instance.
+ * @param passes Bitwise OR of {@link OH_NN_GraphPass}, <b>OH_NN_GRAPH_PASS_ALL</b> by default.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If <b>passes</b> has an unknown bit, <b>OH_NN_INVALID_PARAMETER</b> is returned.
+ *         If the model has been built, <b>OH_NN_OPERATION_FORBIDDEN</b> is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNModel_SetGraphPasses(OH_NNModel *model, uint32_t passes);
+
+/**
+ * @brief 定义模型构建时图优化的统计信息。
+ *
+ * @since 11
+ * @version 1.0
+ */
+typedef struct OH_NN_GraphPassSummary {
+    /** Number of the operations of the model before the graph passes. */
+    uint32_t originalNodeCount;
+    /** Number of the operations which are sent to the device after the graph passes. */
+    uint32_t nodeCount;
+    /** Number of the operations which are evaluated on the host by constant folding. */
+    uint32_t foldedCount;
+    /** Number of the operations absorbed into a convolution or matrix multiplication by operator fusion. */
+    uint32_t fusedCount;
+    /** Number of the operations removed by dead code elimination, whose results no output of the model needs. */
+    uint32_t eliminatedCount;
+    /** Number of the operations merged into an identical operation by common subexpression elimination. */
+    uint32_t mergedCount;
+    /** Number of the tensors removed with the operations. */
+    uint32_t removedTensorCount;
+    /** Bytes of the removed tensors, excluding the tensors whose size is unknown before execution. */
+    uint64_t removedBytes;
+    /** Bytes of the constant tensors which hold the results of the folded operations read by the remaining ones. */
+    uint64_t foldedBytes;
+} OH_NN_GraphPassSummary;
+
+/**
+ * @brief Obtains the summary of the graph passes which optimize a model when it is built.
+ *
+ * When a model is built by {@link OH_NNModel_Finish} or {@link OH_NNModel_BuildFromLiteGraph}, the operations whose
+ * results only depend on constant tensors, e.g. a Shape of a tensor of static dims and the Gather and Reshape of its
+ * result, are evaluated once on the host. Their results become constant tensors and the operations are not sent to
+ * the device. Then a batch normalization, scale, bias addition or ReLU which follows a convolution or matrix
+ * multiplication is absorbed into its weights, bias or activation type. The operations whose results are not needed
+ * are removed, and identical operations on the same inputs are merged. The passes are chosen by
+ * {@link OH_NNModel_SetGraphPasses}. {@link OH_NNModel_GetAvailableOperations} still reports one result for each
+ * operation of the model, a folded or removed operation is reported as supported, and an absorbed or merged operation
+ * as the operation which replaces it. \n
+ *
+ * 本接口不作为Neural Network Runtime接口对外开放。\n
+ *
+ * @param model Pointer to the {@link OH_NNModel} instance.
+ * @param summary Pointer to the {@link OH_NN_GraphPassSummary} which receives the summary.
+ * @return Execution result of the function. If the operation is successful, <b>OH_NN_SUCCESS</b> is returned.
+ *         If the model has not been built, <b>OH_NN_OPERATION_FORBIDDEN</b> is returned.
+ *         For details about the error codes, see {@link OH_NN_ReturnCode}.
+ * @since 11
+ * @version 1.0
+ */
+OH_NN_ReturnCode OH_NNModel_GetGraphPassSummary(const OH_NNModel *model, OH_NN_GraphPassSummary *summary);
+
 /**
  * @brief 对cache进行crc校验和检验
  *
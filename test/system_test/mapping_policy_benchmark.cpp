@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "interfaces/innerkits/c/neural_network_runtime_inner.h"
+#include "neural_network_runtime/neural_network_runtime.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace SystemTest {
+namespace {
+constexpr size_t TENSOR_SIZE = 64 * 1024 * 1024;
+constexpr int32_t ROUND_NUM = 9;
+
+struct ColdRunCost {
+    double createMs {0};
+    double firstFillMs {0};
+};
+
+double ElapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+} // namespace
+
+class MappingPolicyBenchmark : public testing::Test {
+public:
+    void SetUp()
+    {
+        const size_t* allDevicesID = nullptr;
+        uint32_t deviceCount {0};
+        ASSERT_EQ(OH_NN_SUCCESS, OH_NNDevice_GetAllDevicesID(&allDevicesID, &deviceCount));
+        ASSERT_GT(deviceCount, 0u);
+        m_deviceId = allDevicesID[0];
+        // A pooled buffer has been touched by an earlier round, every round has to map a new one.
+        ASSERT_EQ(OH_NN_SUCCESS, OH_NNDevice_SetBufferPoolHighWaterMark(m_deviceId, 0));
+
+        m_tensorDesc = OH_NNTensorDesc_Create();
+        ASSERT_NE(nullptr, m_tensorDesc);
+        int32_t shape[] = {static_cast<int32_t>(TENSOR_SIZE)};
+        ASSERT_EQ(OH_NN_SUCCESS, OH_NNTensorDesc_SetDataType(m_tensorDesc, OH_NN_UINT8));
+        ASSERT_EQ(OH_NN_SUCCESS, OH_NNTensorDesc_SetShape(m_tensorDesc, shape, 1));
+    }
+
+    void TearDown()
+    {
+        OH_NN_SetMappingPolicy(OH_NN_MAPPING_DEFAULT, 0);
+        OH_NNTensorDesc_Destroy(&m_tensorDesc);
+    }
+
+protected:
+    // Median cost of creating a tensor and filling it for the first time, like the inputs of a cold run.
+    ColdRunCost MeasureColdRun(uint32_t flags)
+    {
+        EXPECT_EQ(OH_NN_SUCCESS, OH_NN_SetMappingPolicy(flags, 0));
+        std::vector<double> createMs;
+        std::vector<double> firstFillMs;
+        for (int32_t i = 0; i < ROUND_NUM; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            NN_Tensor* tensor = OH_NNTensor_CreateWithSize(m_deviceId, m_tensorDesc, TENSOR_SIZE);
+            createMs.emplace_back(ElapsedMs(start));
+            EXPECT_NE(nullptr, tensor);
+            if (tensor == nullptr) {
+                return {};
+            }
+
+            start = std::chrono::steady_clock::now();
+            memset(OH_NNTensor_GetDataBuffer(tensor), i, TENSOR_SIZE);
+            firstFillMs.emplace_back(ElapsedMs(start));
+            OH_NNTensor_Destroy(&tensor);
+        }
+
+        std::sort(createMs.begin(), createMs.end());
+        std::sort(firstFillMs.begin(), firstFillMs.end());
+        return {createMs[ROUND_NUM / 2], firstFillMs[ROUND_NUM / 2]};
+    }
+
+protected:
+    size_t m_deviceId {0};
+    NN_TensorDesc* m_tensorDesc {nullptr};
+};
+
+/*
+ * @tc.name: mapping_policy_benchmark_001
+ * @tc.desc: Compare the cold run cost of a 64 MB input tensor mapped with each mapping policy.
+ * @tc.type: PERF
+ */
+HWTEST_F(MappingPolicyBenchmark, mapping_policy_benchmark_001, testing::ext::TestSize.Level3)
+{
+    const std::vector<std::pair<const char*, uint32_t>> policies = {
+        {"default", OH_NN_MAPPING_DEFAULT},
+        {"prefault", OH_NN_MAPPING_PREFAULT},
+        {"prefault+hugepage", OH_NN_MAPPING_PREFAULT | OH_NN_MAPPING_HUGE_PAGE},
+    };
+    for (const auto& [name, flags] : policies) {
+        ColdRunCost cost = MeasureColdRun(flags);
+        printf("[MappingPolicyBenchmark] %-18s create %8.3f ms, first fill %8.3f ms, total %8.3f ms\n",
+            name, cost.createMs, cost.firstFillMs, cost.createMs + cost.firstFillMs);
+    }
+}
+} // namespace SystemTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
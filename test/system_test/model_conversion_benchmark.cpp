@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "lite_graph_to_hdi_model_v2_1.h"
+#include "mindir.h"
+#include "weight_store.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace SystemTest {
+namespace {
+constexpr int32_t LAYER_NUM = 64;
+constexpr int32_t WEIGHT_ELEMENT_NUM = 1024 * 1024;
+constexpr int32_t ROUND_NUM = 5;
+constexpr size_t BYTES_PER_KILOBYTE = 1024;
+
+double ElapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Reads a field of /proc/self/status in kB, 0 if it is not found.
+size_t ReadStatusKb(const std::string& field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, field.size(), field) == 0) {
+            return std::stoul(line.substr(field.size()));
+        }
+    }
+    return 0;
+}
+
+// Lets VmHWM start again from the current resident set size.
+void ResetPeakRss()
+{
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+}
+
+OH_NN_ReturnCode AllocateBuffer(size_t length, int& fd)
+{
+    fd = memfd_create("conversionBenchmark", 0);
+    if (fd < 0 || ftruncate(fd, length) != 0) {
+        return OH_NN_MEMORY_ERROR;
+    }
+    return OH_NN_SUCCESS;
+}
+
+OH_NN_ReturnCode ReleaseBuffer(int fd, size_t length)
+{
+    (void)length;
+    close(fd);
+    return OH_NN_SUCCESS;
+}
+
+struct ConversionResult {
+    double medianMs {0};
+    size_t peakGrowthKb {0};
+};
+} // namespace
+
+class ModelConversionBenchmark : public testing::Test {
+public:
+    void SetUp()
+    {
+        // A chain of AddFusion nodes, each of them adds a 4 MB constant weight, like the layers of a real-size model.
+        m_liteGraph.name_ = "conversionBenchmark";
+        std::vector<float> weight(WEIGHT_ELEMENT_NUM, 1.0f);
+        const uint8_t* weightData = reinterpret_cast<const uint8_t*>(weight.data());
+        std::vector<uint8_t> weightBytes(weightData, weightData + weight.size() * sizeof(float));
+
+        uint32_t previous = AddTensor({});
+        m_liteGraph.input_indices_ = {previous};
+        auto* subGraph = new (std::nothrow) mindspore::lite::LiteGraph::SubGraph();
+        ASSERT_NE(nullptr, subGraph);
+        m_liteGraph.sub_graphs_.emplace_back(subGraph);
+        for (int32_t i = 0; i < LAYER_NUM; ++i) {
+            uint32_t weightIndex = AddTensor(weightBytes);
+            m_weightIndices.emplace_back(weightIndex);
+            uint32_t output = AddTensor({});
+            auto* node = new (std::nothrow) mindspore::lite::LiteGraph::Node();
+            ASSERT_NE(nullptr, node);
+            node->name_ = "add" + std::to_string(i);
+            node->primitive_ = mindspore::lite::MindIR_AddFusion_CreatePrimitive(
+                mindspore::lite::ACTIVATION_TYPE_NO_ACTIVATION);
+            node->input_indices_ = {previous, weightIndex};
+            node->output_indices_ = {output};
+            subGraph->node_indices_.emplace_back(static_cast<uint32_t>(m_liteGraph.all_nodes_.size()));
+            m_liteGraph.all_nodes_.emplace_back(node);
+            previous = output;
+        }
+        m_liteGraph.output_indices_ = {previous};
+        subGraph->input_indices_ = m_liteGraph.input_indices_;
+        subGraph->output_indices_ = m_liteGraph.output_indices_;
+
+        m_constSize = mindspore::lite::MindIR_LiteGraph_GetConstTensorSize(&m_liteGraph);
+    }
+
+    void TearDown()
+    {
+        for (auto& tensor : m_liteGraph.all_tensors_) {
+            mindspore::lite::MindIR_Tensor_Destroy(&tensor);
+        }
+        for (auto node : m_liteGraph.all_nodes_) {
+            mindspore::lite::MindIR_Primitive_Destroy(&node->primitive_);
+            delete node;
+        }
+        for (auto subGraph : m_liteGraph.sub_graphs_) {
+            delete subGraph;
+        }
+    }
+
+protected:
+    uint32_t AddTensor(const std::vector<uint8_t>& data)
+    {
+        std::vector<int32_t> dims = {WEIGHT_ELEMENT_NUM};
+        m_liteGraph.all_tensors_.emplace_back(mindspore::lite::MindIR_Tensor_Create("tensor",
+            mindspore::lite::DATA_TYPE_FLOAT32, dims, mindspore::lite::FORMAT_NCHW, data, {}));
+        return static_cast<uint32_t>(m_liteGraph.all_tensors_.size() - 1);
+    }
+
+    // The pages of the shared buffer are resident once written, the growth beyond the weights is the extra copies.
+    ConversionResult Measure(const std::function<bool()>& convert)
+    {
+        std::vector<double> convertMs;
+        ConversionResult result;
+        for (int32_t i = 0; i < ROUND_NUM; ++i) {
+            ResetPeakRss();
+            size_t rssKb = ReadStatusKb("VmRSS:");
+            auto start = std::chrono::steady_clock::now();
+            EXPECT_TRUE(convert());
+            convertMs.emplace_back(ElapsedMs(start));
+            size_t peakKb = ReadStatusKb("VmHWM:");
+            result.peakGrowthKb = std::max(result.peakGrowthKb, (peakKb > rssKb) ? peakKb - rssKb : 0);
+        }
+        std::sort(convertMs.begin(), convertMs.end());
+        result.medianMs = convertMs[ROUND_NUM / 2];
+        return result;
+    }
+
+    // Gives the weights shapes which do not describe their data, so that their layout is not known in advance and
+    // they are copied on the calling thread, the way it was done before the copy was parallel.
+    void SetSequentialCopy(bool isSequential)
+    {
+        std::vector<int32_t> dims = {isSequential ? 2 * WEIGHT_ELEMENT_NUM : WEIGHT_ELEMENT_NUM};
+        for (uint32_t index : m_weightIndices) {
+            mindspore::lite::MindIR_Tensor_SetDims(&m_liteGraph.all_tensors_[index], dims);
+        }
+    }
+
+    static bool IsConverted(OHOS::HDI::Nnrt::V2_1::Model* model, size_t tensorNum)
+    {
+        if (model == nullptr) {
+            return false;
+        }
+        bool isConverted = (model->allTensors.size() == tensorNum);
+        NNRt_V2_1::HDIModel_Destroy(&model);
+        return isConverted;
+    }
+
+    // Conversion of the two-argument LiteGraph_To_HDIModel, which copies the weights to a new shared buffer while it
+    // converts the graph.
+    bool ConvertToBuffer()
+    {
+        int fd {-1};
+        if (AllocateBuffer(m_constSize, fd) != OH_NN_SUCCESS) {
+            return false;
+        }
+        OHOS::HDI::Nnrt::V2_1::SharedBuffer buffer {fd, static_cast<uint32_t>(m_constSize), 0,
+            static_cast<uint32_t>(m_constSize)};
+        bool isConverted = IsConverted(NNRt_V2_1::LiteGraph_To_HDIModel(&m_liteGraph, buffer),
+            m_liteGraph.all_tensors_.size());
+        ReleaseBuffer(fd, m_constSize);
+        return isConverted;
+    }
+
+    // Conversion of HDIDeviceV2_1::PrepareModel: the weight store uploads the weights, or shares the blob of a
+    // prepared model with the same weights, then the graph is converted over the blob.
+    bool ConvertWithWeightStore(WeightStore& store)
+    {
+        std::shared_ptr<const WeightBlob> blob;
+        if (store.Acquire(&m_liteGraph, blob) != OH_NN_SUCCESS) {
+            return false;
+        }
+        OHOS::HDI::Nnrt::V2_1::SharedBuffer buffer {blob->fd, static_cast<uint32_t>(blob->size), 0,
+            static_cast<uint32_t>(blob->size)};
+        return IsConverted(NNRt_V2_1::LiteGraph_To_HDIModel(&m_liteGraph, buffer, blob->dataSizes),
+            m_liteGraph.all_tensors_.size());
+    }
+
+    void Print(const char* name, const ConversionResult& result, const ConversionResult& baseline)
+    {
+        printf("[ModelConversionBenchmark] %-28s convert %8.3f ms, peak rss growth %4zu MB, speedup %.2fx\n", name,
+            result.medianMs, result.peakGrowthKb / BYTES_PER_KILOBYTE,
+            (result.medianMs > 0) ? baseline.medianMs / result.medianMs : 0);
+    }
+
+protected:
+    mindspore::lite::LiteGraph m_liteGraph;
+    std::vector<uint32_t> m_weightIndices;
+    size_t m_constSize {0};
+};
+
+/*
+ * @tc.name: model_conversion_benchmark_001
+ * @tc.desc: Measure the time and the peak memory growth of converting a graph with 256 MB of weights into an HDI
+ *           model, through the two-argument LiteGraph_To_HDIModel and through the weight store of
+ *           HDIDeviceV2_1::PrepareModel, with the weights copied sequentially and in parallel.
+ * @tc.type: PERF
+ */
+HWTEST_F(ModelConversionBenchmark, model_conversion_benchmark_001, testing::ext::TestSize.Level3)
+{
+    // The blob is released at the end of each round, every round of the weight store uploads the weights.
+    WeightStore store(AllocateBuffer, ReleaseBuffer);
+    SetSequentialCopy(true);
+    ConversionResult baseline = Measure([this]() { return ConvertToBuffer(); });
+    ConversionResult storeSequential = Measure([this, &store]() { return ConvertWithWeightStore(store); });
+    SetSequentialCopy(false);
+    ConversionResult bufferParallel = Measure([this]() { return ConvertToBuffer(); });
+    ConversionResult storeParallel = Measure([this, &store]() { return ConvertWithWeightStore(store); });
+    EXPECT_EQ(0, store.GetShareCount());
+
+    // While a prepared model holds the weights, the other prepares compare them with the graph instead of uploading.
+    std::shared_ptr<const WeightBlob> preparedWeights;
+    ASSERT_EQ(OH_NN_SUCCESS, store.Acquire(&m_liteGraph, preparedWeights));
+    ConversionResult storeShared = Measure([this, &store]() { return ConvertWithWeightStore(store); });
+    EXPECT_EQ(ROUND_NUM, store.GetShareCount());
+
+    printf("[ModelConversionBenchmark] %d layers, %zu MB of weights\n", LAYER_NUM,
+        m_constSize / BYTES_PER_KILOBYTE / BYTES_PER_KILOBYTE);
+    Print("buffer, sequential copy:", baseline, baseline);
+    Print("weight store, sequential copy:", storeSequential, baseline);
+    Print("buffer, parallel copy:", bufferParallel, baseline);
+    Print("weight store, parallel copy:", storeParallel, baseline);
+    Print("weight store, shared:", storeShared, baseline);
+}
+} // namespace SystemTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
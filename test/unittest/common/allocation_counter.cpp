@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "allocation_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace {
+thread_local ScopedAllocationCounter* g_currentCounter = nullptr;
+
+void* CountedAllocate(size_t size)
+{
+    ScopedAllocationCounter::RecordAllocation();
+    return malloc(size == 0 ? 1 : size);
+}
+} // namespace
+
+ScopedAllocationCounter::ScopedAllocationCounter() : m_previous(g_currentCounter)
+{
+    g_currentCounter = this;
+}
+
+ScopedAllocationCounter::~ScopedAllocationCounter()
+{
+    g_currentCounter = m_previous;
+}
+
+size_t ScopedAllocationCounter::GetCount() const
+{
+    return m_count;
+}
+
+void ScopedAllocationCounter::RecordAllocation()
+{
+    if (g_currentCounter != nullptr) {
+        ++g_currentCounter->m_count;
+    }
+}
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+
+// Only the test binaries built with this file see the replacements, they forward to malloc and free and only count
+// inside the scope of a ScopedAllocationCounter.
+void* operator new(size_t size)
+{
+    void* ptr = OHOS::NeuralNetworkRuntime::CountedAllocate(size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return OHOS::NeuralNetworkRuntime::CountedAllocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return OHOS::NeuralNetworkRuntime::CountedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    free(ptr);
+}
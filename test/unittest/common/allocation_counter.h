@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_UNITTEST_ALLOCATION_COUNTER_H
+#define NEURAL_NETWORK_RUNTIME_UNITTEST_ALLOCATION_COUNTER_H
+
+#include <cstddef>
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+// Counts the heap allocations made by the current thread while the counter is alive. The allocations of other
+// threads and the ones made out of the scope of a counter are not counted. Counters nest, an allocation is only
+// counted by the innermost one.
+class ScopedAllocationCounter {
+public:
+    ScopedAllocationCounter();
+    ~ScopedAllocationCounter();
+    ScopedAllocationCounter(const ScopedAllocationCounter&) = delete;
+    ScopedAllocationCounter& operator=(const ScopedAllocationCounter&) = delete;
+
+    size_t GetCount() const;
+    static void RecordAllocation();
+
+private:
+    ScopedAllocationCounter* m_previous {nullptr};
+    size_t m_count {0};
+};
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_UNITTEST_ALLOCATION_COUNTER_H
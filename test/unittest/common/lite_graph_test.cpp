@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "lite_graph_test.h"
+
+namespace MSLITE = mindspore::lite;
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+void LiteGraphTest::TearDown()
+{
+    for (auto& tensor : m_liteGraph.all_tensors_) {
+        MSLITE::MindIR_Tensor_Destroy(&tensor);
+    }
+    for (auto node : m_liteGraph.all_nodes_) {
+        MSLITE::MindIR_Primitive_Destroy(&node->primitive_);
+        delete node;
+    }
+    for (auto subGraph : m_liteGraph.sub_graphs_) {
+        delete subGraph;
+    }
+}
+
+uint32_t LiteGraphTest::AddTensor(const std::vector<int32_t>& dims, MSLITE::DataType dataType, MSLITE::Format format,
+    const std::vector<uint8_t>& data)
+{
+    m_liteGraph.all_tensors_.emplace_back(MSLITE::MindIR_Tensor_Create("tensor", dataType, dims, format, data, {}));
+    return static_cast<uint32_t>(m_liteGraph.all_tensors_.size() - 1);
+}
+
+uint32_t LiteGraphTest::AddConstTensor(const std::vector<int32_t>& dims, const std::vector<float>& values,
+    MSLITE::Format format)
+{
+    std::vector<uint8_t> data(values.size() * sizeof(float));
+    if (!data.empty()) {
+        memcpy(data.data(), values.data(), data.size());
+    }
+    return AddTensor(dims, MSLITE::DATA_TYPE_FLOAT32, format, data);
+}
+
+void LiteGraphTest::AddNode(MSLITE::PrimitivePtr primitive, const std::vector<uint32_t>& inputs,
+    const std::vector<uint32_t>& outputs)
+{
+    auto node = new MSLITE::LiteGraph::Node();
+    node->primitive_ = primitive;
+    node->input_indices_ = inputs;
+    node->output_indices_ = outputs;
+    node->quant_type_ = MSLITE::QUANT_TYPE_NONE;
+    m_liteGraph.all_nodes_.emplace_back(node);
+}
+
+void LiteGraphTest::AddSubGraph()
+{
+    auto subGraph = new MSLITE::LiteGraph::SubGraph();
+    subGraph->input_indices_ = m_liteGraph.input_indices_;
+    subGraph->output_indices_ = m_liteGraph.output_indices_;
+    for (uint32_t i = 0; i < m_liteGraph.all_nodes_.size(); ++i) {
+        subGraph->node_indices_.emplace_back(i);
+    }
+    m_liteGraph.sub_graphs_.emplace_back(subGraph);
+}
+
+MSLITE::PrimitivePtr LiteGraphTest::CreateActivation(MSLITE::ActivationType activation)
+{
+    return MSLITE::MindIR_Activation_CreatePrimitive(activation, 0.0f, 0.0f, 0.0f, false);
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEURAL_NETWORK_RUNTIME_UNITTEST_LITE_GRAPH_TEST_H
+#define NEURAL_NETWORK_RUNTIME_UNITTEST_LITE_GRAPH_TEST_H
+
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mindir.h"
+
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+// Fixture of the tests of the graph passes, which builds a lite graph tensor by tensor and node by node.
+class LiteGraphTest : public testing::Test {
+public:
+    LiteGraphTest() = default;
+    ~LiteGraphTest() = default;
+
+    void TearDown() override;
+
+protected:
+    uint32_t AddTensor(const std::vector<int32_t>& dims,
+        mindspore::lite::DataType dataType = mindspore::lite::DATA_TYPE_FLOAT32,
+        mindspore::lite::Format format = mindspore::lite::FORMAT_NHWC, const std::vector<uint8_t>& data = {});
+    uint32_t AddConstTensor(const std::vector<int32_t>& dims, const std::vector<float>& values,
+        mindspore::lite::Format format = mindspore::lite::FORMAT_NHWC);
+    void AddNode(mindspore::lite::PrimitivePtr primitive, const std::vector<uint32_t>& inputs,
+        const std::vector<uint32_t>& outputs);
+    // Adds the single subgraph of all the nodes added so far, and the inputs and outputs of the graph.
+    void AddSubGraph();
+    mindspore::lite::PrimitivePtr CreateActivation(mindspore::lite::ActivationType activation);
+
+    template <typename T>
+    uint32_t AddConstTensor(mindspore::lite::DataType dataType, const std::vector<int32_t>& dims,
+        const std::vector<T>& values)
+    {
+        std::vector<uint8_t> data(values.size() * sizeof(T));
+        if (!data.empty()) {
+            memcpy(data.data(), values.data(), data.size());
+        }
+        return AddTensor(dims, dataType, mindspore::lite::FORMAT_NHWC, data);
+    }
+
+    template <typename T>
+    std::vector<T> GetValues(uint32_t tensorIndex)
+    {
+        std::vector<uint8_t> data = mindspore::lite::MindIR_Tensor_GetData(m_liteGraph.all_tensors_[tensorIndex]);
+        std::vector<T> values(data.size() / sizeof(T));
+        if (!values.empty()) {
+            memcpy(values.data(), data.data(), values.size() * sizeof(T));
+        }
+        return values;
+    }
+
+protected:
+    mindspore::lite::LiteGraph m_liteGraph;
+};
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
+#endif // NEURAL_NETWORK_RUNTIME_UNITTEST_LITE_GRAPH_TEST_H
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "async_run_pool.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+// Limits of async_run_pool.cpp
+constexpr size_t ASYNC_RUN_MAX_WORKERS = 4;
+constexpr size_t ASYNC_RUN_QUEUE_MAX_SIZE = 256;
+
+class AsyncRunPoolTest : public testing::Test {
+public:
+    AsyncRunPoolTest() = default;
+    ~AsyncRunPoolTest() = default;
+
+protected:
+    // Posts a task which returns once the gate is opened.
+    OH_NN_ReturnCode PostBlockedTask()
+    {
+        OH_NN_ReturnCode ret = AsyncRunPool::GetInstance()->PostTask([this]() {
+            std::unique_lock<std::mutex> lock(m_mtx);
+            ++m_startedNum;
+            m_cv.notify_all();
+            m_cv.wait(lock, [this] { return m_isOpened; });
+            ++m_finishedNum;
+            m_cv.notify_all();
+        });
+        if (ret == OH_NN_SUCCESS) {
+            ++m_postedNum;
+        }
+        return ret;
+    }
+
+    void WaitStarted(size_t taskNum)
+    {
+        std::unique_lock<std::mutex> lock(m_mtx);
+        m_cv.wait(lock, [this, taskNum] { return m_startedNum == taskNum; });
+    }
+
+    // Returns once all posted tasks have finished.
+    void OpenGate()
+    {
+        std::unique_lock<std::mutex> lock(m_mtx);
+        m_isOpened = true;
+        m_cv.notify_all();
+        m_cv.wait(lock, [this] { return m_finishedNum == m_postedNum; });
+    }
+
+protected:
+    std::mutex m_mtx;
+    std::condition_variable m_cv;
+    size_t m_startedNum {0};
+    size_t m_finishedNum {0};
+    size_t m_postedNum {0};
+    bool m_isOpened {false};
+};
+
+/**
+ * @tc.name: asyncrunpooltest_parallelfor_001
+ * @tc.desc: Verify ParallelFor invokes the task with every index once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AsyncRunPoolTest, asyncrunpooltest_parallelfor_001, TestSize.Level0)
+{
+    constexpr size_t taskNum = 100;
+    std::vector<std::atomic<size_t>> counts(taskNum);
+    AsyncRunPool::GetInstance()->ParallelFor(taskNum, [&counts](size_t index) { ++counts[index]; });
+    for (size_t i = 0; i < taskNum; ++i) {
+        EXPECT_EQ(1, counts[i].load());
+    }
+}
+
+/**
+ * @tc.name: asyncrunpooltest_parallelfor_002
+ * @tc.desc: Verify ParallelFor completes on the calling thread while all workers are busy, and its helpers do not
+ *           take the queue slots of the posted tasks.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AsyncRunPoolTest, asyncrunpooltest_parallelfor_002, TestSize.Level0)
+{
+    size_t workerNum = std::thread::hardware_concurrency();
+    workerNum = (workerNum == 0) ? 1 : std::min(workerNum, ASYNC_RUN_MAX_WORKERS);
+    for (size_t i = 0; i < workerNum; ++i) {
+        ASSERT_EQ(OH_NN_SUCCESS, PostBlockedTask());
+    }
+    WaitStarted(workerNum);
+
+    // Leaves as many free slots as ParallelFor would queue helpers.
+    for (size_t i = 0; i < ASYNC_RUN_QUEUE_MAX_SIZE - ASYNC_RUN_MAX_WORKERS; ++i) {
+        ASSERT_EQ(OH_NN_SUCCESS, PostBlockedTask());
+    }
+
+    constexpr size_t taskNum = 16;
+    std::atomic<size_t> finishedNum {0};
+    AsyncRunPool::GetInstance()->ParallelFor(taskNum, [&finishedNum](size_t) { ++finishedNum; });
+    EXPECT_EQ(taskNum, finishedNum.load());
+
+    for (size_t i = 0; i < ASYNC_RUN_MAX_WORKERS; ++i) {
+        EXPECT_EQ(OH_NN_SUCCESS, PostBlockedTask());
+    }
+    EXPECT_EQ(OH_NN_FAILED, PostBlockedTask());
+
+    OpenGate();
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "constant_folder.h"
+#include "test/unittest/common/lite_graph_test.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+namespace MSLITE = mindspore::lite;
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class ConstantFolderTest : public LiteGraphTest {
+protected:
+    void Optimize(GraphPassSummary& summary, std::vector<uint32_t>& nodeMap)
+    {
+        LiteGraphRewriter rewriter;
+        ASSERT_EQ(OH_NN_SUCCESS, rewriter.Init(&m_liteGraph));
+        summary.originalNodeCount = static_cast<uint32_t>(m_liteGraph.all_nodes_.size());
+        ConstantFolder().Fold(rewriter, summary);
+        rewriter.Commit(summary);
+        nodeMap = rewriter.GetNodeMap();
+    }
+};
+
+/**
+ * @tc.name: constantfoldertest_fold_001
+ * @tc.desc: Verify a Shape->Gather chain is folded into the constant shape of a Reshape, and its tensors are removed.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ConstantFolderTest, constantfoldertest_fold_001, TestSize.Level0)
+{
+    uint32_t input = AddTensor({2, 3, 4});
+    uint32_t shape = AddTensor({-1}, MSLITE::DATA_TYPE_INT32);
+    uint32_t indices = AddConstTensor<int32_t>(MSLITE::DATA_TYPE_INT32, {2}, {0, -1});
+    uint32_t axis = AddConstTensor<int32_t>(MSLITE::DATA_TYPE_INT32, {}, {0});
+    uint32_t newShape = AddTensor({-1}, MSLITE::DATA_TYPE_INT32);
+    uint32_t output = AddTensor({-1, -1});
+    m_liteGraph.input_indices_ = {input};
+    m_liteGraph.output_indices_ = {output};
+    AddNode(MSLITE::MindIR_Shape_CreatePrimitive(), {input}, {shape});
+    AddNode(MSLITE::MindIR_Gather_CreatePrimitive(), {shape, indices, axis}, {newShape});
+    AddNode(MSLITE::MindIR_Reshape_CreatePrimitive(), {input, newShape}, {output});
+    AddSubGraph();
+
+    GraphPassSummary summary;
+    std::vector<uint32_t> nodeMap;
+    Optimize(summary, nodeMap);
+    EXPECT_EQ(3, summary.originalNodeCount);
+    EXPECT_EQ(1, summary.nodeCount);
+    EXPECT_EQ(2, summary.foldedCount);
+    EXPECT_EQ(3, summary.removedTensorCount);
+    EXPECT_EQ(24, summary.removedBytes);
+    EXPECT_EQ(8, summary.foldedBytes);
+    EXPECT_EQ((std::vector<uint32_t> {LiteGraphRewriter::NO_NODE, LiteGraphRewriter::NO_NODE, 0}), nodeMap);
+
+    ASSERT_EQ(1, m_liteGraph.all_nodes_.size());
+    ASSERT_EQ(3, m_liteGraph.all_tensors_.size());
+    EXPECT_EQ((std::vector<uint32_t> {0, 1}), m_liteGraph.all_nodes_[0]->input_indices_);
+    EXPECT_EQ((std::vector<uint32_t> {2}), m_liteGraph.all_nodes_[0]->output_indices_);
+    EXPECT_EQ((std::vector<uint32_t> {2}), m_liteGraph.output_indices_);
+    EXPECT_EQ((std::vector<uint32_t> {0}), m_liteGraph.sub_graphs_[0]->node_indices_);
+    EXPECT_EQ((std::vector<int32_t> {2, 4}), GetValues<int32_t>(1));
+    EXPECT_EQ((std::vector<int32_t> {2}), MSLITE::MindIR_Tensor_GetDims(m_liteGraph.all_tensors_[1]));
+}
+
+/**
+ * @tc.name: constantfoldertest_fold_002
+ * @tc.desc: Verify Range, ConstantOfShape, Fill and Cast of constants are folded, but not into an output of the graph.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ConstantFolderTest, constantfoldertest_fold_002, TestSize.Level0)
+{
+    uint32_t input = AddTensor({4});
+    uint32_t range = AddTensor({-1}, MSLITE::DATA_TYPE_INT64);
+    uint32_t shape = AddConstTensor<int64_t>(MSLITE::DATA_TYPE_INT64, {1}, {4});
+    uint32_t ones = AddTensor({-1});
+    uint32_t value = AddConstTensor<int32_t>(MSLITE::DATA_TYPE_INT32, {}, {7});
+    uint32_t filled = AddTensor({-1}, MSLITE::DATA_TYPE_INT32);
+    uint32_t castType = AddConstTensor<int64_t>(MSLITE::DATA_TYPE_INT64, {}, {MSLITE::DATA_TYPE_FLOAT32});
+    uint32_t casted = AddTensor({-1});
+    uint32_t output = AddTensor({4});
+    uint32_t constOutput = AddTensor({-1}, MSLITE::DATA_TYPE_INT32);
+    m_liteGraph.input_indices_ = {input};
+    m_liteGraph.output_indices_ = {output, constOutput};
+    AddNode(MSLITE::MindIR_Range_CreatePrimitive(MSLITE::DATA_TYPE_INT64, 1, 9, 2), {input}, {range});
+    AddNode(MSLITE::MindIR_ConstantOfShape_CreatePrimitive(MSLITE::DATA_TYPE_FLOAT32, {1.0f}), {shape}, {ones});
+    AddNode(MSLITE::MindIR_Fill_CreatePrimitive(), {value, shape}, {filled});
+    AddNode(MSLITE::MindIR_Cast_CreatePrimitive(), {filled, castType}, {casted});
+    AddNode(MSLITE::MindIR_AddFusion_CreatePrimitive(MSLITE::ACTIVATION_TYPE_NO_ACTIVATION), {input, ones}, {output});
+    AddNode(MSLITE::MindIR_Fill_CreatePrimitive(), {value, shape}, {constOutput});
+
+    GraphPassSummary summary;
+    std::vector<uint32_t> nodeMap;
+    Optimize(summary, nodeMap);
+    EXPECT_EQ(4, summary.foldedCount);
+    EXPECT_EQ(2, summary.nodeCount);
+    EXPECT_EQ(16, summary.foldedBytes);
+    EXPECT_EQ((std::vector<uint32_t> {LiteGraphRewriter::NO_NODE, LiteGraphRewriter::NO_NODE,
+        LiteGraphRewriter::NO_NODE, LiteGraphRewriter::NO_NODE, 0, 1}), nodeMap);
+
+    // The results which no node reads any more are removed with the nodes, the Cast of the Fill among them.
+    ASSERT_EQ(6, m_liteGraph.all_tensors_.size());
+    uint32_t onesIndex = m_liteGraph.all_nodes_[0]->input_indices_[1];
+    EXPECT_EQ((std::vector<float> {1.0f, 1.0f, 1.0f, 1.0f}), GetValues<float>(onesIndex));
+    EXPECT_EQ((std::vector<int32_t> {4}), MSLITE::MindIR_Tensor_GetDims(m_liteGraph.all_tensors_[onesIndex]));
+    EXPECT_EQ((std::vector<int32_t> {7}), GetValues<int32_t>(m_liteGraph.all_nodes_[1]->input_indices_[0]));
+    EXPECT_TRUE(MSLITE::MindIR_Tensor_GetData(m_liteGraph.all_tensors_[m_liteGraph.output_indices_[1]]).empty());
+}
+
+/**
+ * @tc.name: constantfoldertest_fold_003
+ * @tc.desc: Verify the nodes of dynamic or quantized inputs are not folded, and an invalid graph is not rewritten.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ConstantFolderTest, constantfoldertest_fold_003, TestSize.Level0)
+{
+    uint32_t input = AddTensor({-1, 4});
+    uint32_t shape = AddTensor({2}, MSLITE::DATA_TYPE_INT32);
+    m_liteGraph.all_tensors_.emplace_back(MSLITE::MindIR_Tensor_Create("weight", MSLITE::DATA_TYPE_INT8, {2},
+        MSLITE::FORMAT_NCHW, {1, 2}, {{0, 0.5, 8}}));
+    uint32_t weight = static_cast<uint32_t>(m_liteGraph.all_tensors_.size() - 1);
+    uint32_t newShape = AddConstTensor<int32_t>(MSLITE::DATA_TYPE_INT32, {1}, {2});
+    uint32_t reshaped = AddTensor({-1}, MSLITE::DATA_TYPE_INT8);
+    uint32_t output = AddTensor({-1});
+    m_liteGraph.input_indices_ = {input};
+    m_liteGraph.output_indices_ = {output};
+    AddNode(MSLITE::MindIR_Shape_CreatePrimitive(), {input}, {shape});
+    AddNode(MSLITE::MindIR_Reshape_CreatePrimitive(), {weight, newShape}, {reshaped});
+    AddNode(MSLITE::MindIR_AddFusion_CreatePrimitive(MSLITE::ACTIVATION_TYPE_NO_ACTIVATION), {shape, reshaped},
+        {output});
+
+    GraphPassSummary summary;
+    std::vector<uint32_t> nodeMap;
+    Optimize(summary, nodeMap);
+    EXPECT_EQ(0, summary.foldedCount);
+    EXPECT_EQ(3, summary.nodeCount);
+    EXPECT_EQ(0, summary.removedTensorCount);
+    EXPECT_EQ((std::vector<uint32_t> {0, 1, 2}), nodeMap);
+
+    m_liteGraph.output_indices_.emplace_back(m_liteGraph.all_tensors_.size());
+    LiteGraphRewriter rewriter;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, rewriter.Init(&m_liteGraph));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, rewriter.Init(nullptr));
+    m_liteGraph.output_indices_.pop_back();
+}
+/**
+ * @tc.name: constantfoldertest_fold_004
+ * @tc.desc: Verify a Range of tensor inputs and a Gather of a result over the size limit are not folded.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ConstantFolderTest, constantfoldertest_fold_004, TestSize.Level0)
+{
+    const size_t rowSize = 1024;
+    const size_t indexNum = CONSTANT_FOLDING_MAX_SIZE / (rowSize * sizeof(float)) + 1;
+    uint32_t input = AddTensor({}, MSLITE::DATA_TYPE_INT64);
+    uint32_t limit = AddConstTensor<int64_t>(MSLITE::DATA_TYPE_INT64, {}, {9});
+    uint32_t range = AddTensor({-1}, MSLITE::DATA_TYPE_INT64);
+    uint32_t table = AddConstTensor<float>(MSLITE::DATA_TYPE_FLOAT32, {2, static_cast<int32_t>(rowSize)},
+        std::vector<float>(2 * rowSize, 1.0f));
+    uint32_t indices = AddConstTensor<int32_t>(MSLITE::DATA_TYPE_INT32, {static_cast<int32_t>(indexNum)},
+        std::vector<int32_t>(indexNum, 0));
+    uint32_t axis = AddConstTensor<int32_t>(MSLITE::DATA_TYPE_INT32, {}, {0});
+    uint32_t gathered = AddTensor({-1, -1});
+    uint32_t output = AddTensor({-1}, MSLITE::DATA_TYPE_INT64);
+    uint32_t gatherOutput = AddTensor({-1, -1});
+    m_liteGraph.input_indices_ = {input};
+    m_liteGraph.output_indices_ = {output, gatherOutput};
+    AddNode(MSLITE::MindIR_Range_CreatePrimitive(MSLITE::DATA_TYPE_INT64, 1, 9, 2), {input, limit}, {range});
+    AddNode(MSLITE::MindIR_AddFusion_CreatePrimitive(MSLITE::ACTIVATION_TYPE_NO_ACTIVATION), {range, input},
+        {output});
+    AddNode(MSLITE::MindIR_Gather_CreatePrimitive(), {table, indices, axis}, {gathered});
+    AddNode(MSLITE::MindIR_AddFusion_CreatePrimitive(MSLITE::ACTIVATION_TYPE_NO_ACTIVATION), {gathered, gathered},
+        {gatherOutput});
+    AddSubGraph();
+
+    GraphPassSummary summary;
+    std::vector<uint32_t> nodeMap;
+    Optimize(summary, nodeMap);
+    EXPECT_EQ(0, summary.foldedCount);
+    EXPECT_EQ(4, summary.nodeCount);
+    EXPECT_EQ((std::vector<uint32_t> {0, 1, 2, 3}), nodeMap);
+    EXPECT_TRUE(MSLITE::MindIR_Tensor_GetData(m_liteGraph.all_tensors_[range]).empty());
+    EXPECT_TRUE(MSLITE::MindIR_Tensor_GetData(m_liteGraph.all_tensors_[gathered]).empty());
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
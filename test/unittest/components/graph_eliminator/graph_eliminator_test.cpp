@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "graph_eliminator.h"
+#include "test/unittest/common/lite_graph_test.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+namespace MSLITE = mindspore::lite;
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class GraphEliminatorTest : public LiteGraphTest {
+protected:
+    void Optimize(GraphPassSummary& summary, std::vector<uint32_t>& nodeMap)
+    {
+        LiteGraphRewriter rewriter;
+        ASSERT_EQ(OH_NN_SUCCESS, rewriter.Init(&m_liteGraph));
+        GraphEliminator eliminator;
+        eliminator.EliminateDeadNodes(rewriter, summary);
+        eliminator.MergeCommonNodes(rewriter, summary);
+        rewriter.Commit(summary);
+        nodeMap = rewriter.GetNodeMap();
+    }
+};
+
+/**
+ * @tc.name: grapheliminatortest_eliminate_001
+ * @tc.desc: Verify the nodes from which no output of the graph is reachable are removed with their tensors.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GraphEliminatorTest, grapheliminatortest_eliminate_001, TestSize.Level0)
+{
+    uint32_t input = AddTensor({1, 4});
+    uint32_t shape = AddTensor({2}, MSLITE::DATA_TYPE_INT32);
+    uint32_t sigmoid = AddTensor({1, 4});
+    uint32_t unused = AddTensor({1, 4});
+    uint32_t output = AddTensor({1, 4});
+    m_liteGraph.input_indices_ = {input};
+    m_liteGraph.output_indices_ = {output};
+    AddNode(MSLITE::MindIR_Shape_CreatePrimitive(), {input}, {shape});
+    AddNode(CreateActivation(MSLITE::ACTIVATION_TYPE_SIGMOID), {input}, {sigmoid});
+    AddNode(CreateActivation(MSLITE::ACTIVATION_TYPE_RELU), {sigmoid}, {unused});
+    AddNode(CreateActivation(MSLITE::ACTIVATION_TYPE_RELU), {input}, {output});
+
+    GraphPassSummary summary;
+    std::vector<uint32_t> nodeMap;
+    Optimize(summary, nodeMap);
+    EXPECT_EQ(3, summary.eliminatedCount);
+    EXPECT_EQ(0, summary.mergedCount);
+    EXPECT_EQ(1, summary.nodeCount);
+    EXPECT_EQ(3, summary.removedTensorCount);
+    EXPECT_EQ((std::vector<uint32_t> {LiteGraphRewriter::NO_NODE, LiteGraphRewriter::NO_NODE,
+        LiteGraphRewriter::NO_NODE, 0}), nodeMap);
+
+    ASSERT_EQ(1, m_liteGraph.all_nodes_.size());
+    ASSERT_EQ(2, m_liteGraph.all_tensors_.size());
+    EXPECT_EQ((std::vector<uint32_t> {0}), m_liteGraph.all_nodes_[0]->input_indices_);
+    EXPECT_EQ((std::vector<uint32_t> {1}), m_liteGraph.all_nodes_[0]->output_indices_);
+    EXPECT_EQ((std::vector<uint32_t> {1}), m_liteGraph.output_indices_);
+}
+
+/**
+ * @tc.name: grapheliminatortest_merge_001
+ * @tc.desc: Verify the duplicated Shape and Reshape of a tensor are merged into the first of them, and the nodes
+ *           which read the merged outputs read the kept ones.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GraphEliminatorTest, grapheliminatortest_merge_001, TestSize.Level0)
+{
+    uint32_t input = AddTensor({1, 4});
+    uint32_t shape = AddTensor({2}, MSLITE::DATA_TYPE_INT32);
+    uint32_t reshape = AddTensor({1, 4});
+    uint32_t sameShape = AddTensor({2}, MSLITE::DATA_TYPE_INT32);
+    uint32_t sameReshape = AddTensor({1, 4});
+    uint32_t output = AddTensor({1, 4});
+    m_liteGraph.input_indices_ = {input};
+    m_liteGraph.output_indices_ = {output};
+    AddNode(MSLITE::MindIR_Shape_CreatePrimitive(), {input}, {shape});
+    AddNode(MSLITE::MindIR_Reshape_CreatePrimitive(), {input, shape}, {reshape});
+    AddNode(MSLITE::MindIR_Shape_CreatePrimitive(), {input}, {sameShape});
+    AddNode(MSLITE::MindIR_Reshape_CreatePrimitive(), {input, sameShape}, {sameReshape});
+    AddNode(MSLITE::MindIR_AddFusion_CreatePrimitive(MSLITE::ACTIVATION_TYPE_NO_ACTIVATION),
+        {reshape, sameReshape}, {output});
+
+    GraphPassSummary summary;
+    std::vector<uint32_t> nodeMap;
+    Optimize(summary, nodeMap);
+    EXPECT_EQ(0, summary.eliminatedCount);
+    EXPECT_EQ(2, summary.mergedCount);
+    EXPECT_EQ(3, summary.nodeCount);
+    EXPECT_EQ(2, summary.removedTensorCount);
+    EXPECT_EQ((std::vector<uint32_t> {0, 1, 0, 1, 2}), nodeMap);
+
+    ASSERT_EQ(3, m_liteGraph.all_nodes_.size());
+    ASSERT_EQ(4, m_liteGraph.all_tensors_.size());
+    EXPECT_EQ((std::vector<uint32_t> {0, 1}), m_liteGraph.all_nodes_[1]->input_indices_);
+    EXPECT_EQ((std::vector<uint32_t> {2, 2}), m_liteGraph.all_nodes_[2]->input_indices_);
+    EXPECT_EQ((std::vector<uint32_t> {3}), m_liteGraph.output_indices_);
+}
+
+/**
+ * @tc.name: grapheliminatortest_merge_002
+ * @tc.desc: Verify the nodes of different attributes or output types are kept, and so is a duplicated node which
+ *           writes an output of the graph.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GraphEliminatorTest, grapheliminatortest_merge_002, TestSize.Level0)
+{
+    uint32_t input = AddTensor({1, 4});
+    uint32_t relu = AddTensor({1, 4});
+    uint32_t relu6 = AddTensor({1, 4});
+    uint32_t shape = AddTensor({2}, MSLITE::DATA_TYPE_INT32);
+    uint32_t longShape = AddTensor({2}, MSLITE::DATA_TYPE_INT64);
+    uint32_t output = AddTensor({1, 4});
+    m_liteGraph.input_indices_ = {input};
+    m_liteGraph.output_indices_ = {relu, relu6, shape, longShape, output};
+    AddNode(CreateActivation(MSLITE::ACTIVATION_TYPE_RELU), {input}, {relu});
+    AddNode(CreateActivation(MSLITE::ACTIVATION_TYPE_RELU6), {input}, {relu6});
+    AddNode(MSLITE::MindIR_Shape_CreatePrimitive(), {input}, {shape});
+    AddNode(MSLITE::MindIR_Shape_CreatePrimitive(), {input}, {longShape});
+    AddNode(CreateActivation(MSLITE::ACTIVATION_TYPE_RELU), {input}, {output});
+
+    GraphPassSummary summary;
+    std::vector<uint32_t> nodeMap;
+    Optimize(summary, nodeMap);
+    EXPECT_EQ(0, summary.eliminatedCount);
+    EXPECT_EQ(0, summary.mergedCount);
+    EXPECT_EQ(5, summary.nodeCount);
+    EXPECT_EQ(0, summary.removedTensorCount);
+    EXPECT_EQ((std::vector<uint32_t> {0, 1, 2, 3, 4}), nodeMap);
+    EXPECT_EQ(6, m_liteGraph.all_tensors_.size());
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
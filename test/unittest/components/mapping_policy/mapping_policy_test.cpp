@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mapping_policy.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+constexpr size_t BUFFER_SIZE = 1024 * 1024;
+
+class MappingPolicyTest : public testing::Test {
+public:
+    MappingPolicyTest() = default;
+    ~MappingPolicyTest() = default;
+
+    void SetUp() override
+    {
+        m_fd = memfd_create("mapping_policy_test", 0);
+        ASSERT_GE(m_fd, 0);
+        ASSERT_EQ(0, ftruncate(m_fd, BUFFER_SIZE));
+    }
+
+    void TearDown() override
+    {
+        MappingPolicy::Set(OH_NN_MAPPING_DEFAULT, 0);
+        close(m_fd);
+    }
+
+protected:
+    // Number of pages of the mapping which are resident without being touched.
+    size_t CountResidentPages(void* addr, size_t length)
+    {
+        size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        std::vector<unsigned char> residency((length + pageSize - 1) / pageSize);
+        if (mincore(addr, length, residency.data()) != 0) {
+            return 0;
+        }
+        size_t count {0};
+        for (auto page : residency) {
+            count += (page & 1);
+        }
+        return count;
+    }
+
+protected:
+    int m_fd {-1};
+};
+
+/**
+ * @tc.name: mappingpolicytest_set_001
+ * @tc.desc: Verify the Set function rejects unknown flags and keeps the previous policy.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MappingPolicyTest, mappingpolicytest_set_001, TestSize.Level0)
+{
+    EXPECT_EQ(OH_NN_SUCCESS, MappingPolicy::Set(OH_NN_MAPPING_PREFAULT | OH_NN_MAPPING_HUGE_PAGE, BUFFER_SIZE));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, MappingPolicy::Set(0x4, 0));
+
+    uint32_t flags {0};
+    size_t threshold {0};
+    MappingPolicy::Get(flags, threshold);
+    EXPECT_EQ(OH_NN_MAPPING_PREFAULT | OH_NN_MAPPING_HUGE_PAGE, flags);
+    EXPECT_EQ(BUFFER_SIZE, threshold);
+}
+
+/**
+ * @tc.name: mappingpolicytest_map_001
+ * @tc.desc: Verify the buffers are only prefaulted by the prefault policy, and only from the threshold on.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MappingPolicyTest, mappingpolicytest_map_001, TestSize.Level0)
+{
+    size_t pageNum = BUFFER_SIZE / static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    void* addr = MappingPolicy::Map(BUFFER_SIZE, PROT_READ | PROT_WRITE, m_fd, 0);
+    ASSERT_NE(MAP_FAILED, addr);
+    EXPECT_EQ(0, CountResidentPages(addr, BUFFER_SIZE));
+    munmap(addr, BUFFER_SIZE);
+
+    EXPECT_EQ(OH_NN_SUCCESS, MappingPolicy::Set(OH_NN_MAPPING_PREFAULT, BUFFER_SIZE + 1));
+    addr = MappingPolicy::Map(BUFFER_SIZE, PROT_READ | PROT_WRITE, m_fd, 0);
+    ASSERT_NE(MAP_FAILED, addr);
+    EXPECT_EQ(0, CountResidentPages(addr, BUFFER_SIZE));
+    munmap(addr, BUFFER_SIZE);
+
+    EXPECT_EQ(OH_NN_SUCCESS, MappingPolicy::Set(OH_NN_MAPPING_PREFAULT, BUFFER_SIZE));
+    addr = MappingPolicy::Map(BUFFER_SIZE, PROT_READ | PROT_WRITE, m_fd, 0);
+    ASSERT_NE(MAP_FAILED, addr);
+    EXPECT_EQ(pageNum, CountResidentPages(addr, BUFFER_SIZE));
+    munmap(addr, BUFFER_SIZE);
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
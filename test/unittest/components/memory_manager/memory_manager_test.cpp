@@ -226,6 +226,65 @@ HWTEST_F(MemoryManagerTest, memorymanagertest_getmemory_003, TestSize.Level0)
     EXPECT_EQ('D', static_cast<char>(tmpData[3]));
     memoryManager->UnMapMemory(buffer);
 }
+
+/**
+ * @tc.name: memorymanagertest_importmemory_001
+ * @tc.desc: Verify the ImportMemory function registers a user buffer which is never unmapped by the manager.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MemoryManagerTest, memorymanagertest_importmemory_001, TestSize.Level0)
+{
+    const auto& memoryManager = MemoryManager::GetInstance();
+    char data[4] {'A', 'B', 'C', 'D'};
+    int fd = 0;
+    size_t length = sizeof(data);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->ImportMemory(-1, data, length));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->ImportMemory(fd, nullptr, length));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->ImportMemory(fd, data, 0));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->RemoveImportedMemory(data));
+
+    EXPECT_EQ(OH_NN_SUCCESS, memoryManager->ImportMemory(fd, data, length));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->ImportMemory(fd, data, length));
+
+    Memory memory;
+    EXPECT_EQ(OH_NN_SUCCESS, memoryManager->GetMemory(data, memory));
+    EXPECT_EQ(fd, memory.fd);
+    EXPECT_EQ(length, memory.length);
+    EXPECT_TRUE(memory.isImported);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->UnMapMemory(data));
+
+    EXPECT_EQ(OH_NN_SUCCESS, memoryManager->RemoveImportedMemory(data));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->GetMemory(data, memory));
+}
+
+/**
+ * @tc.name: memorymanagertest_findmemory_001
+ * @tc.desc: Verify the FindMemory function finds the memory of an address in the middle of it, across chunks.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MemoryManagerTest, memorymanagertest_findmemory_001, TestSize.Level0)
+{
+    const auto& memoryManager = MemoryManager::GetInstance();
+    // Only registered, never accessed, so a fake address of a memory across several chunks is enough.
+    char* data = reinterpret_cast<char*>(0x7f0000100000);
+    int fd = 0;
+    size_t length = 64 * 1024 * 1024;
+    EXPECT_EQ(OH_NN_SUCCESS, memoryManager->ImportMemory(fd, data, length));
+
+    Memory memory;
+    EXPECT_EQ(OH_NN_SUCCESS, memoryManager->FindMemory(data, memory));
+    EXPECT_EQ(data, memory.data);
+    EXPECT_EQ(OH_NN_SUCCESS, memoryManager->FindMemory(data + length / 2, memory));
+    EXPECT_EQ(data, memory.data);
+    EXPECT_EQ(OH_NN_SUCCESS, memoryManager->FindMemory(data + length - 1, memory));
+    EXPECT_EQ(length, memory.length);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->FindMemory(data + length, memory));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->FindMemory(data - 1, memory));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->GetMemory(data + 1, memory));
+
+    EXPECT_EQ(OH_NN_SUCCESS, memoryManager->RemoveImportedMemory(data));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, memoryManager->FindMemory(data + length / 2, memory));
+}
 } // namespace UnitTest
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
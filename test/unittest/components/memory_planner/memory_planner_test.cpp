@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "memory_planner.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class MemoryPlannerTest : public testing::Test {
+public:
+    MemoryPlannerTest() = default;
+    ~MemoryPlannerTest() = default;
+
+    void TearDown() override
+    {
+        for (auto& tensor : m_liteGraph.all_tensors_) {
+            mindspore::lite::MindIR_Tensor_Destroy(&tensor);
+        }
+        for (auto node : m_liteGraph.all_nodes_) {
+            delete node;
+        }
+    }
+
+protected:
+    uint32_t AddTensor(const std::vector<int32_t>& dims, const std::vector<uint8_t>& data = {})
+    {
+        m_liteGraph.all_tensors_.emplace_back(mindspore::lite::MindIR_Tensor_Create("tensor",
+            mindspore::lite::DATA_TYPE_FLOAT32, dims, mindspore::lite::FORMAT_NCHW, data, {}));
+        return static_cast<uint32_t>(m_liteGraph.all_tensors_.size() - 1);
+    }
+
+    void AddNode(const std::vector<uint32_t>& inputs, const std::vector<uint32_t>& outputs)
+    {
+        auto node = new mindspore::lite::LiteGraph::Node();
+        node->input_indices_ = inputs;
+        node->output_indices_ = outputs;
+        m_liteGraph.all_nodes_.emplace_back(node);
+    }
+
+    const TensorPlacement* FindPlacement(const MemoryPlan& plan, uint32_t tensorIndex)
+    {
+        for (const auto& placement : plan.placements) {
+            if (placement.tensorIndex == tensorIndex) {
+                return &placement;
+            }
+        }
+        return nullptr;
+    }
+
+protected:
+    mindspore::lite::LiteGraph m_liteGraph;
+};
+
+/**
+ * @tc.name: memoryplannertest_plan_001
+ * @tc.desc: Verify the intermediate tensors which are not live at the same time share the arena.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MemoryPlannerTest, memoryplannertest_plan_001, TestSize.Level0)
+{
+    uint32_t input = AddTensor({256});
+    uint32_t first = AddTensor({256});
+    uint32_t second = AddTensor({100});
+    uint32_t third = AddTensor({256});
+    uint32_t output = AddTensor({256});
+    uint32_t weight = AddTensor({1}, {0, 0, 0, 0});
+    m_liteGraph.input_indices_ = {input};
+    m_liteGraph.output_indices_ = {output};
+    AddNode({input, weight}, {first});
+    AddNode({first}, {second});
+    AddNode({second}, {third});
+    AddNode({third}, {output});
+
+    MemoryPlan plan;
+    EXPECT_EQ(OH_NN_SUCCESS, MemoryPlanner().Plan(&m_liteGraph, plan));
+    ASSERT_EQ(3, plan.placements.size());
+    EXPECT_EQ((std::vector<uint32_t> {0, 1, 2, 3}), plan.executionOrder);
+    EXPECT_EQ(2448, plan.naiveSize);
+    EXPECT_EQ(1424, plan.arenaSize);
+    EXPECT_EQ(0, FindPlacement(plan, first)->offset);
+    EXPECT_EQ(1024, FindPlacement(plan, second)->offset);
+    EXPECT_EQ(0, FindPlacement(plan, third)->offset);
+    EXPECT_EQ(1, FindPlacement(plan, second)->firstUse);
+    EXPECT_EQ(2, FindPlacement(plan, second)->lastUse);
+    EXPECT_EQ(nullptr, FindPlacement(plan, weight));
+}
+
+/**
+ * @tc.name: memoryplannertest_plan_002
+ * @tc.desc: Verify the nodes are ordered topologically, and the tensors of unknown size are not planned.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MemoryPlannerTest, memoryplannertest_plan_002, TestSize.Level0)
+{
+    uint32_t input = AddTensor({-1, 16});
+    uint32_t dynamic = AddTensor({-1, 16});
+    uint32_t fixed = AddTensor({16});
+    uint32_t output = AddTensor({16});
+    m_liteGraph.input_indices_ = {input};
+    m_liteGraph.output_indices_ = {output};
+    AddNode({fixed}, {output});
+    AddNode({dynamic}, {fixed});
+    AddNode({input}, {dynamic});
+
+    MemoryPlan plan;
+    EXPECT_EQ(OH_NN_SUCCESS, MemoryPlanner().Plan(&m_liteGraph, plan));
+    EXPECT_EQ((std::vector<uint32_t> {2, 1, 0}), plan.executionOrder);
+    ASSERT_EQ(1, plan.placements.size());
+    EXPECT_EQ(fixed, plan.placements[0].tensorIndex);
+    EXPECT_EQ(1, plan.unplannedCount);
+
+    m_liteGraph.all_nodes_[2]->input_indices_.emplace_back(output);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, MemoryPlanner().Plan(&m_liteGraph, plan));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, MemoryPlanner().Plan(nullptr, plan));
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
@@ -1091,6 +1091,32 @@ HWTEST_F(NNCompilerTest, nncompilertest_setextensionconfig_001, TestSize.Level0)
     testing::Mock::AllowLeak(device.get());
 }
 
+/**
+ * @tc.name: nncompilertest_setextensionconfig_002
+ * @tc.desc: Verify the SetExtensionConfig function accepts the reload policy and rejects an empty one.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNCompilerTest, nncompilertest_setextensionconfig_002, TestSize.Level0)
+{
+    LOGE("SetExtensionConfig nncompilertest_setextensionconfig_002");
+    size_t backendID = 1;
+    std::shared_ptr<MockIDevice> device = std::make_shared<MockIDevice>();
+
+    NNCompiler* nncompiler = new (std::nothrow) NNCompiler(device, backendID);
+    EXPECT_NE(nullptr, nncompiler);
+
+    std::unordered_map<std::string, std::vector<char>> configs;
+    configs["ReloadPolicy"] = {'1'};
+    OH_NN_ReturnCode ret = nncompiler->SetExtensionConfig(configs);
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+
+    configs["ReloadPolicy"] = {};
+    ret = nncompiler->SetExtensionConfig(configs);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, ret);
+
+    testing::Mock::AllowLeak(device.get());
+}
+
 /**
  * @tc.name: nncompilertest_setoptions_001
  * @tc.desc: Verify the QuantParams function return nullptr in case of fd -1.
@@ -13,17 +13,39 @@
  * limitations under the License.
  */
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
 #include "nnexecutor.h"
+#include "auto_unload_tracker.h"
+#include "backend_manager.h"
+#include "executor_pool.h"
+#include "latency_histogram.h"
+#include "memory_account.h"
+#include "memory_manager.h"
 #include "nncompiler.h"
 #include "nnbackend.h"
+#include "nntensor.h"
+#include "reload_predictor.h"
+#include "run_sync_reporter.h"
+#include "shared_buffer_pool.h"
 #include "device.h"
 #include "prepared_model.h"
 #include "neural_network_runtime/neural_network_runtime_type.h"
 #include "utils.h"
 #include "log.h"
+#include "test/unittest/common/allocation_counter.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -920,7 +942,7 @@ HWTEST_F(NNExecutorTest, nnexecutortest_setonrundone_001, TestSize.Level0)
         false, performance, priority);
 
     OH_NN_ReturnCode ret = nnExecutor->SetOnRunDone(MyOnRunDone);
-    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, ret);
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
 }
 
 void MyOnServiceDied(void *userData)
@@ -950,7 +972,7 @@ HWTEST_F(NNExecutorTest, nnexecutortest_setonservicedied_001, TestSize.Level0)
         false, performance, priority);
 
     OH_NN_ReturnCode ret = nnExecutor->SetOnServiceDied(MyOnServiceDied);
-    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, ret);
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
 }
 
 /**
@@ -1229,7 +1251,7 @@ HWTEST_F(NNExecutorTest, nnexecutortest_runasync_001, TestSize.Level0)
     size_t outputSize = 1;
     int32_t timeout = 10;
     OH_NN_ReturnCode ret = nnExecutor->RunAsync(nullptr, inputSize, nullptr, outputSize, timeout, buffer);
-    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, ret);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, ret);
 }
 
 /**
@@ -1258,7 +1280,7 @@ HWTEST_F(NNExecutorTest, nnexecutortest_runasync_002, TestSize.Level0)
     size_t outputSize = 1;
     int32_t timeout = 10;
     OH_NN_ReturnCode ret = nnExecutor->RunAsync(nullptr, inputSize, nullptr, outputSize, timeout, buffer);
-    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, ret);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, ret);
 }
 
 /**
@@ -1327,6 +1349,666 @@ HWTEST_F(NNExecutorTest, nnexecutortest_runasync_003, TestSize.Level0)
     testing::Mock::AllowLeak(mockIPreparedMode.get());
 }
 
+struct AsyncRunResult {
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool isDone {false};
+    OH_NN_ReturnCode errCode {OH_NN_FAILED};
+    int32_t outputCount {0};
+};
+
+void RecordOnRunDone(void *userData, OH_NN_ReturnCode errCode, void *outputTensor[], int32_t outputCount)
+{
+    AsyncRunResult* result = reinterpret_cast<AsyncRunResult*>(userData);
+    std::lock_guard<std::mutex> lock(result->mtx);
+    result->errCode = errCode;
+    result->outputCount = outputCount;
+    result->isDone = true;
+    result->cv.notify_all();
+}
+
+bool WaitAsyncRunResult(AsyncRunResult& result)
+{
+    std::unique_lock<std::mutex> lock(result.mtx);
+    return result.cv.wait_for(lock, std::chrono::seconds(5), [&result] { return result.isDone; });
+}
+
+NNExecutor* CreateAsyncExecutor(std::shared_ptr<MockIPreparedModel> mockIPreparedMode,
+    const ExtensionConfig& extensionConfig = ExtensionConfig())
+{
+    EXPECT_CALL(*mockIPreparedMode, GetInputDimRanges(::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Return(OH_NN_OPERATION_FORBIDDEN));
+
+    std::shared_ptr<TensorDesc> tensorDesr = std::make_shared<TensorDesc>();
+    int32_t expectDim[2] = {3, 3};
+    tensorDesr->SetShape(expectDim, 2);
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> inputTensorDescs;
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> outputTensorDescs;
+    inputTensorDescs.emplace_back(tensorDesr, OH_NN_TENSOR);
+    outputTensorDescs.emplace_back(std::make_shared<TensorDesc>(*tensorDesr), OH_NN_TENSOR);
+
+    return new (std::nothrow) NNExecutor(0, nullptr, mockIPreparedMode, inputTensorDescs, outputTensorDescs,
+        "", 0, extensionConfig, false, OH_NN_PERFORMANCE_EXTREME, OH_NN_PRIORITY_HIGH);
+}
+
+/**
+ * @tc.name: nnexecutortest_runasync_004
+ * @tc.desc: Verify the RunAsync function delivers outputs through NN_OnRunDone when prepared model succeeds.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_runasync_004, TestSize.Level0)
+{
+    LOGE("RunAsync nnexecutortest_runasync_004");
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    EXPECT_CALL(*mockIPreparedMode, Run(::testing::An<const std::vector<NN_Tensor*>&>(),
+        ::testing::An<const std::vector<NN_Tensor*>&>(), ::testing::_, ::testing::_))
+        .WillOnce(Invoke([](const std::vector<NN_Tensor*>& inputs, const std::vector<NN_Tensor*>& outputs,
+            std::vector<std::vector<int32_t>>& outputsDims, std::vector<bool>& isOutputBufferEnough) {
+                outputsDims = {{3, 3}};
+                isOutputBufferEnough = {true};
+                return OH_NN_SUCCESS;
+            }));
+    NNExecutor* nnExecutor = CreateAsyncExecutor(mockIPreparedMode);
+    EXPECT_NE(nullptr, nnExecutor);
+
+    std::shared_ptr<MockIDevice> device = std::make_shared<MockIDevice>();
+    std::unique_ptr<NNBackend> hdiDevice = std::make_unique<NNBackend>(device, 1);
+    TensorDesc desc;
+    desc.SetShape(m_dimArry, m_dimensionCount);
+    NN_Tensor* tensor = reinterpret_cast<NN_Tensor*>(hdiDevice->CreateTensor(&desc));
+
+    AsyncRunResult result;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, nnExecutor->RunAsync(&tensor, 1, &tensor, 1, 0, &result));
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, nnExecutor->RunAsync(&tensor, 1, &tensor, 1, 1000, &result));
+
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->SetOnRunDone(RecordOnRunDone));
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->RunAsync(&tensor, 1, &tensor, 1, 1000, &result));
+    EXPECT_TRUE(WaitAsyncRunResult(result));
+    EXPECT_EQ(OH_NN_SUCCESS, result.errCode);
+    EXPECT_EQ(1, result.outputCount);
+
+    delete nnExecutor;
+    hdiDevice->DestroyTensor(reinterpret_cast<Tensor*>(tensor));
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
+
+/**
+ * @tc.name: nnexecutortest_runasync_005
+ * @tc.desc: Verify the RunAsync function reports OH_NN_TIMEOUT, once the device has returned, when prepared model runs
+ *           longer than timeout.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_runasync_005, TestSize.Level0)
+{
+    LOGE("RunAsync nnexecutortest_runasync_005");
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    std::atomic<bool> isDeviceReturned {false};
+    EXPECT_CALL(*mockIPreparedMode, Run(::testing::An<const std::vector<NN_Tensor*>&>(),
+        ::testing::An<const std::vector<NN_Tensor*>&>(), ::testing::_, ::testing::_))
+        .WillOnce(Invoke([&isDeviceReturned](const std::vector<NN_Tensor*>& inputs,
+            const std::vector<NN_Tensor*>& outputs, std::vector<std::vector<int32_t>>& outputsDims,
+            std::vector<bool>& isOutputBufferEnough) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                outputsDims = {{3, 3}};
+                isOutputBufferEnough = {true};
+                isDeviceReturned = true;
+                return OH_NN_SUCCESS;
+            }));
+    NNExecutor* nnExecutor = CreateAsyncExecutor(mockIPreparedMode);
+    EXPECT_NE(nullptr, nnExecutor);
+
+    std::shared_ptr<MockIDevice> device = std::make_shared<MockIDevice>();
+    std::unique_ptr<NNBackend> hdiDevice = std::make_unique<NNBackend>(device, 1);
+    TensorDesc desc;
+    desc.SetShape(m_dimArry, m_dimensionCount);
+    NN_Tensor* tensor = reinterpret_cast<NN_Tensor*>(hdiDevice->CreateTensor(&desc));
+
+    AsyncRunResult result;
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->SetOnRunDone(RecordOnRunDone));
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->RunAsync(&tensor, 1, &tensor, 1, 10, &result));
+    EXPECT_TRUE(WaitAsyncRunResult(result));
+    EXPECT_EQ(OH_NN_TIMEOUT, result.errCode);
+    EXPECT_EQ(0, result.outputCount);
+    // The device still uses the tensors of the caller until it returns, the timeout is only delivered after that.
+    EXPECT_TRUE(isDeviceReturned.load());
+
+    delete nnExecutor;
+    hdiDevice->DestroyTensor(reinterpret_cast<Tensor*>(tensor));
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
+
+/**
+ * @tc.name: nnexecutortest_runsyncincontext_001
+ * @tc.desc: Verify the RunSyncInContext function keeps the output shapes in the context and sets them to the tensors,
+ *           not to the executor.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_runsyncincontext_001, TestSize.Level0)
+{
+    LOGE("RunSyncInContext nnexecutortest_runsyncincontext_001");
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    EXPECT_CALL(*mockIPreparedMode, Run(::testing::An<const std::vector<NN_Tensor*>&>(),
+        ::testing::An<const std::vector<NN_Tensor*>&>(), ::testing::_, ::testing::_))
+        .WillOnce(Invoke([](const std::vector<NN_Tensor*>& inputs, const std::vector<NN_Tensor*>& outputs,
+            std::vector<std::vector<int32_t>>& outputsDims, std::vector<bool>& isOutputBufferEnough) {
+                outputsDims = {{1, 9}};
+                isOutputBufferEnough = {true};
+                return OH_NN_SUCCESS;
+            }));
+    NNExecutor* nnExecutor = CreateAsyncExecutor(mockIPreparedMode);
+    EXPECT_NE(nullptr, nnExecutor);
+
+    std::shared_ptr<MockIDevice> device = std::make_shared<MockIDevice>();
+    std::unique_ptr<NNBackend> hdiDevice = std::make_unique<NNBackend>(device, 1);
+    TensorDesc desc;
+    desc.SetShape(m_dimArry, m_dimensionCount);
+    NN_Tensor* tensor = reinterpret_cast<NN_Tensor*>(hdiDevice->CreateTensor(&desc));
+
+    ExecutionContext context;
+    OH_NN_ReturnCode ret = nnExecutor->RunSyncInContext(context, &tensor, 1, &tensor, 1);
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+    EXPECT_EQ((std::vector<std::vector<int32_t>> {{1, 9}}), context.outputsDims);
+    int32_t* shape = nullptr;
+    size_t tensorShapeNum = 0;
+    EXPECT_EQ(OH_NN_SUCCESS, reinterpret_cast<NNTensor2_0*>(tensor)->GetTensorDesc()->GetShape(&shape,
+        &tensorShapeNum));
+    ASSERT_EQ(2, tensorShapeNum);
+    EXPECT_EQ(1, shape[0]);
+    EXPECT_EQ(9, shape[1]);
+
+    shape = nullptr;
+    uint32_t shapeNum = 0;
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->GetOutputShape(0, &shape, &shapeNum));
+    ASSERT_EQ(2, shapeNum);
+    EXPECT_EQ(3, shape[0]);
+    EXPECT_EQ(3, shape[1]);
+
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
+
+// A prepared model without gmock bookkeeping, so that the allocations counted are the ones of the executor.
+class FakePreparedModel : public PreparedModel {
+public:
+    OH_NN_ReturnCode ExportModelCache(std::vector<Buffer>& modelCache) override
+    {
+        return OH_NN_SUCCESS;
+    }
+
+    OH_NN_ReturnCode Run(const std::vector<IOTensor>& inputs, const std::vector<IOTensor>& outputs,
+        std::vector<std::vector<int32_t>>& outputsDims, std::vector<bool>& isOutputBufferEnough) override
+    {
+        return OH_NN_OPERATION_FORBIDDEN;
+    }
+
+    OH_NN_ReturnCode Run(const std::vector<NN_Tensor*>& inputs, const std::vector<NN_Tensor*>& outputs,
+        std::vector<std::vector<int32_t>>& outputsDims, std::vector<bool>& isOutputBufferEnough) override
+    {
+        outputsDims.resize(outputs.size());
+        for (auto& dims : outputsDims) {
+            dims.assign(m_outputDims.begin(), m_outputDims.end());
+        }
+        return OH_NN_SUCCESS;
+    }
+
+    OH_NN_ReturnCode GetModelID(uint32_t& modelId) const override
+    {
+        modelId = 0;
+        return OH_NN_SUCCESS;
+    }
+
+    OH_NN_ReturnCode ReleaseBuiltModel() override
+    {
+        return OH_NN_SUCCESS;
+    }
+
+    OH_NN_ReturnCode GetInputDimRanges(std::vector<std::vector<uint32_t>>& minInputDims,
+        std::vector<std::vector<uint32_t>>& maxInputDims) override
+    {
+        const uint32_t minDim = 1;
+        const uint32_t maxDim = 10;
+        minInputDims.resize(1);
+        maxInputDims.resize(1);
+        minInputDims[0].assign(m_outputDims.size(), minDim);
+        maxInputDims[0].assign(m_outputDims.size(), maxDim);
+        return OH_NN_SUCCESS;
+    }
+
+    OH_NN_ReturnCode SetAippString(const std::string& aippStrings) override
+    {
+        return OH_NN_SUCCESS;
+    }
+
+private:
+    const std::vector<int32_t> m_outputDims {3, 3};
+};
+
+/**
+ * @tc.name: nnexecutortest_runsync_006
+ * @tc.desc: Verify a steady-state RunSync makes no heap allocation, its run vectors are kept by the executor.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_runsync_006, TestSize.Level0)
+{
+    LOGE("RunSync nnexecutortest_runsync_006");
+    const size_t runTimes = 100;
+    std::shared_ptr<TensorDesc> tensorDesc = std::make_shared<TensorDesc>();
+    tensorDesc->SetShape(m_dimArry, m_dimensionCount);
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> inputTensorDescs;
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> outputTensorDescs;
+    inputTensorDescs.emplace_back(tensorDesc, OH_NN_TENSOR);
+    outputTensorDescs.emplace_back(std::make_shared<TensorDesc>(*tensorDesc), OH_NN_TENSOR);
+    std::unique_ptr<NNExecutor> nnExecutor = std::make_unique<NNExecutor>(0, nullptr,
+        std::make_shared<FakePreparedModel>(), inputTensorDescs, outputTensorDescs, "", 0, ExtensionConfig(), false,
+        OH_NN_PERFORMANCE_EXTREME, OH_NN_PRIORITY_HIGH);
+
+    NNTensor2_0 input(0);
+    NNTensor2_0 output(0);
+    EXPECT_EQ(OH_NN_SUCCESS, input.SetTensorDesc(tensorDesc.get()));
+    EXPECT_EQ(OH_NN_SUCCESS, output.SetTensorDesc(tensorDesc.get()));
+    NN_Tensor* inputTensor = reinterpret_cast<NN_Tensor*>(&input);
+    NN_Tensor* outputTensor = reinterpret_cast<NN_Tensor*>(&output);
+
+    // The first run sizes the vectors, the following ones only clear and refill them.
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->RunSync(&inputTensor, 1, &outputTensor, 1));
+
+    OH_NN_ReturnCode ret = OH_NN_SUCCESS;
+    size_t allocationCount = 0;
+    {
+        ScopedAllocationCounter allocationCounter;
+        for (size_t i = 0; i < runTimes && ret == OH_NN_SUCCESS; ++i) {
+            ret = nnExecutor->RunSync(&inputTensor, 1, &outputTensor, 1);
+        }
+        allocationCount = allocationCounter.GetCount();
+    }
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+    EXPECT_EQ(0, allocationCount);
+}
+
+// Backend whose device allocates the tensor buffers from memfd, so that NNRt can create and grow them.
+constexpr size_t MEMFD_BACKEND_ID = 2;
+
+std::shared_ptr<Backend> CreateMemfdBackend()
+{
+    std::shared_ptr<MockIDevice> device = std::make_shared<MockIDevice>();
+    EXPECT_CALL(*device, GetDeviceStatus(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(AVAILABLE), ::testing::Return(OH_NN_SUCCESS)));
+    std::string backendName = "memfd";
+    EXPECT_CALL(*device, GetDeviceName(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(backendName), ::testing::Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*device, GetVendorName(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(backendName), ::testing::Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*device, GetVersion(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(backendName), ::testing::Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*device, AllocateBuffer(::testing::_, ::testing::An<int&>()))
+        .WillRepeatedly(Invoke([](size_t length, int& fd) {
+            fd = memfd_create("nn_executor_test", 0);
+            if (fd < 0 || ftruncate(fd, length) != 0) {
+                return OH_NN_MEMORY_ERROR;
+            }
+            return OH_NN_SUCCESS;
+        }));
+    EXPECT_CALL(*device, ReleaseBuffer(::testing::An<int>(), ::testing::_))
+        .WillRepeatedly(Invoke([](int fd, size_t length) {
+            close(fd);
+            return OH_NN_SUCCESS;
+        }));
+    testing::Mock::AllowLeak(device.get());
+    return std::make_shared<NNBackend>(device, MEMFD_BACKEND_ID);
+}
+
+/**
+ * @tc.name: nnexecutortest_regrowoutputs_001
+ * @tc.desc: Verify an output created by NNRt which is smaller than the dimensions reported by the device is grown,
+ *           although the device does not report the buffer as insufficient, and the model is run again.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_regrowoutputs_001, TestSize.Level0)
+{
+    LOGE("RegrowOutputsAndRun nnexecutortest_regrowoutputs_001");
+    BackendManager& backendManager = BackendManager::GetInstance();
+    EXPECT_EQ(OH_NN_SUCCESS, backendManager.RegisterBackend("memfd", CreateMemfdBackend));
+
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    std::vector<size_t> runOutputSizes;
+    EXPECT_CALL(*mockIPreparedMode, Run(::testing::An<const std::vector<NN_Tensor*>&>(),
+        ::testing::An<const std::vector<NN_Tensor*>&>(), ::testing::_, ::testing::_))
+        .Times(2)
+        .WillRepeatedly(Invoke([&runOutputSizes](const std::vector<NN_Tensor*>& inputs,
+            const std::vector<NN_Tensor*>& outputs, std::vector<std::vector<int32_t>>& outputsDims,
+            std::vector<bool>& isOutputBufferEnough) {
+                runOutputSizes.emplace_back(reinterpret_cast<NNTensor2_0*>(outputs[0])->GetSize());
+                outputsDims = {{3, 6}};
+                return OH_NN_SUCCESS;
+            }));
+    ExtensionConfig extensionConfig;
+    extensionConfig.isOutputRegrowEnabled = true;
+    NNExecutor* nnExecutor = CreateAsyncExecutor(mockIPreparedMode, extensionConfig);
+    ASSERT_NE(nullptr, nnExecutor);
+
+    TensorDesc desc;
+    desc.SetDataType(OH_NN_FLOAT32);
+    desc.SetShape(m_dimArry, m_dimensionCount);
+    auto input = std::make_unique<NNTensor2_0>(MEMFD_BACKEND_ID);
+    auto output = std::make_unique<NNTensor2_0>(MEMFD_BACKEND_ID);
+    EXPECT_EQ(OH_NN_SUCCESS, input->SetTensorDesc(&desc));
+    EXPECT_EQ(OH_NN_SUCCESS, output->SetTensorDesc(&desc));
+    EXPECT_EQ(OH_NN_SUCCESS, output->CreateData());
+    NN_Tensor* inputTensor = reinterpret_cast<NN_Tensor*>(input.get());
+    NN_Tensor* outputTensor = reinterpret_cast<NN_Tensor*>(output.get());
+
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->RunSync(&inputTensor, 1, &outputTensor, 1));
+    EXPECT_EQ(std::vector<size_t>({9 * sizeof(float), 18 * sizeof(float)}), runOutputSizes);
+    EXPECT_NE(nullptr, output->GetData());
+    int32_t* shape = nullptr;
+    size_t shapeNum = 0;
+    EXPECT_EQ(OH_NN_SUCCESS, output->GetTensorDesc()->GetShape(&shape, &shapeNum));
+    ASSERT_EQ(2, shapeNum);
+    EXPECT_EQ(6, shape[1]);
+
+    // The buffers are released through the backend, before it is removed.
+    delete nnExecutor;
+    input.reset();
+    output.reset();
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+    backendManager.RemoveBackend("memfd");
+}
+
+NNExecutor* CreateAliasExecutor(std::shared_ptr<MockIPreparedModel> mockIPreparedMode, size_t tensorNum)
+{
+    EXPECT_CALL(*mockIPreparedMode, GetInputDimRanges(::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Return(OH_NN_OPERATION_FORBIDDEN));
+    EXPECT_CALL(*mockIPreparedMode, Run(::testing::An<const std::vector<NN_Tensor*>&>(),
+        ::testing::An<const std::vector<NN_Tensor*>&>(), ::testing::_, ::testing::_))
+        .WillRepeatedly(Invoke([tensorNum](const std::vector<NN_Tensor*>& inputs,
+            const std::vector<NN_Tensor*>& outputs, std::vector<std::vector<int32_t>>& outputsDims,
+            std::vector<bool>& isOutputBufferEnough) {
+                outputsDims.assign(tensorNum, {3, 3});
+                return OH_NN_SUCCESS;
+            }));
+
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> inputTensorDescs;
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> outputTensorDescs;
+    int32_t expectDim[2] = {3, 3};
+    for (size_t i = 0; i < tensorNum; ++i) {
+        std::shared_ptr<TensorDesc> tensorDesr = std::make_shared<TensorDesc>();
+        tensorDesr->SetShape(expectDim, 2);
+        inputTensorDescs.emplace_back(tensorDesr, OH_NN_TENSOR);
+        outputTensorDescs.emplace_back(std::make_shared<TensorDesc>(*tensorDesr), OH_NN_TENSOR);
+    }
+
+    ExtensionConfig extensionConfig;
+    NNExecutor* nnExecutor = new (std::nothrow) NNExecutor(0, nullptr, mockIPreparedMode, inputTensorDescs,
+        outputTensorDescs, "", 0, extensionConfig, false, OH_NN_PERFORMANCE_EXTREME, OH_NN_PRIORITY_HIGH);
+    if (nnExecutor != nullptr) {
+        // Every output may alias every input.
+        std::vector<uint32_t> inputIndices;
+        for (size_t i = 0; i < tensorNum; ++i) {
+            inputIndices.emplace_back(static_cast<uint32_t>(i));
+        }
+        nnExecutor->SetAliasableInputs(std::vector<std::vector<uint32_t>>(tensorNum, inputIndices));
+    }
+    return nnExecutor;
+}
+
+// Tensor over a buffer of the test, which is left to the test when the tensor is destroyed.
+class BorrowedTensor {
+public:
+    BorrowedTensor(void* data, size_t size) : m_tensor(0)
+    {
+        TensorDesc desc;
+        int32_t dims[2] = {3, 3};
+        desc.SetDataType(OH_NN_FLOAT32);
+        desc.SetShape(dims, 2);
+        m_tensor.SetTensorDesc(&desc);
+        m_tensor.SetData(data);
+        m_tensor.SetSize(size);
+        m_tensor.SetFd(-1);
+    }
+
+    ~BorrowedTensor()
+    {
+        m_tensor.SetData(nullptr);
+        m_tensor.SetSize(0);
+    }
+
+    NN_Tensor* Get()
+    {
+        return reinterpret_cast<NN_Tensor*>(&m_tensor);
+    }
+
+private:
+    NNTensor2_0 m_tensor;
+};
+
+/**
+ * @tc.name: nnexecutortest_outputalias_001
+ * @tc.desc: Verify one tensor can be passed as both input and output, with or without a declared alias.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_outputalias_001, TestSize.Level0)
+{
+    LOGE("CheckOutputAliases nnexecutortest_outputalias_001");
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    NNExecutor* nnExecutor = CreateAliasExecutor(mockIPreparedMode, 1);
+    ASSERT_NE(nullptr, nnExecutor);
+
+    BorrowedTensor tensor(m_dataArry, sizeof(m_dataArry));
+    NN_Tensor* nnTensor = tensor.Get();
+    // Callers which pass one tensor as both from before the aliases keep working.
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->RunSync(&nnTensor, 1, &nnTensor, 1));
+
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->SetOutputAlias(0, 0));
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->RunSync(&nnTensor, 1, &nnTensor, 1));
+
+    // A declared alias shares the whole buffer, an output which only overlaps the input is rejected.
+    BorrowedTensor shifted(reinterpret_cast<uint8_t*>(m_dataArry) + sizeof(float), sizeof(m_dataArry) - sizeof(float));
+    NN_Tensor* shiftedTensor = shifted.Get();
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, nnExecutor->RunSync(&nnTensor, 1, &shiftedTensor, 1));
+
+    delete nnExecutor;
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
+
+/**
+ * @tc.name: nnexecutortest_outputalias_002
+ * @tc.desc: Verify an undeclared overlap is rejected once an alias is declared, and not checked before.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_outputalias_002, TestSize.Level0)
+{
+    LOGE("CheckOutputAliases nnexecutortest_outputalias_002");
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    NNExecutor* nnExecutor = CreateAliasExecutor(mockIPreparedMode, 2);
+    ASSERT_NE(nullptr, nnExecutor);
+
+    float otherData[9] {0};
+    float outputData[9] {0};
+    BorrowedTensor input0(m_dataArry, sizeof(m_dataArry));
+    BorrowedTensor input1(otherData, sizeof(otherData));
+    BorrowedTensor output1(outputData, sizeof(outputData));
+    NN_Tensor* inputs[2] {input0.Get(), input1.Get()};
+    // Output 1 is passed the buffer of input 1, which it does not alias.
+    NN_Tensor* outputs[2] {input0.Get(), input1.Get()};
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->RunSync(inputs, 2, outputs, 2));
+
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->SetOutputAlias(0, 0));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, nnExecutor->RunSync(inputs, 2, outputs, 2));
+
+    outputs[1] = output1.Get();
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->RunSync(inputs, 2, outputs, 2));
+
+    delete nnExecutor;
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
+
+/**
+ * @tc.name: nnexecutortest_outputalias_003
+ * @tc.desc: Verify an input aliased by an output already cannot be aliased by another one, and the aliases are only
+ *           declared for the inputs the graph allows.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_outputalias_003, TestSize.Level0)
+{
+    LOGE("SetOutputAlias nnexecutortest_outputalias_003");
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    NNExecutor* nnExecutor = CreateAliasExecutor(mockIPreparedMode, 2);
+    ASSERT_NE(nullptr, nnExecutor);
+
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->SetOutputAlias(0, 0));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, nnExecutor->SetOutputAlias(1, 0));
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->SetOutputAlias(1, 1));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, nnExecutor->SetOutputAlias(2, 0));
+    delete nnExecutor;
+
+    NNExecutor* unknownGraphExecutor = CreateAsyncExecutor(mockIPreparedMode);
+    ASSERT_NE(nullptr, unknownGraphExecutor);
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, unknownGraphExecutor->SetOutputAlias(0, 0));
+    delete unknownGraphExecutor;
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
+
+/**
+ * @tc.name: nnexecutortest_executorpool_001
+ * @tc.desc: Verify the ExecutorPool runs requests from several threads on one executor and counts each run.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_executorpool_001, TestSize.Level0)
+{
+    LOGE("ExecutorPool nnexecutortest_executorpool_001");
+    const size_t threadNum = 4;
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    EXPECT_CALL(*mockIPreparedMode, Run(::testing::An<const std::vector<NN_Tensor*>&>(),
+        ::testing::An<const std::vector<NN_Tensor*>&>(), ::testing::_, ::testing::_))
+        .Times(threadNum)
+        .WillRepeatedly(Invoke([](const std::vector<NN_Tensor*>& inputs, const std::vector<NN_Tensor*>& outputs,
+            std::vector<std::vector<int32_t>>& outputsDims, std::vector<bool>& isOutputBufferEnough) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                outputsDims = {{3, 3}};
+                isOutputBufferEnough = {true};
+                return OH_NN_SUCCESS;
+            }));
+    NNExecutor* nnExecutor = CreateAsyncExecutor(mockIPreparedMode);
+    EXPECT_NE(nullptr, nnExecutor);
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->SetExtensionConfig({}));
+
+    ExecutorPool executorPool(nnExecutor, 2);
+    EXPECT_EQ(2, executorPool.GetContextNum());
+
+    std::shared_ptr<MockIDevice> device = std::make_shared<MockIDevice>();
+    std::unique_ptr<NNBackend> hdiDevice = std::make_unique<NNBackend>(device, 1);
+    std::vector<OH_NN_ReturnCode> rets(threadNum, OH_NN_FAILED);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadNum; ++i) {
+        threads.emplace_back([&executorPool, &hdiDevice, &rets, i, this]() {
+            TensorDesc desc;
+            desc.SetShape(m_dimArry, m_dimensionCount);
+            NN_Tensor* tensor = reinterpret_cast<NN_Tensor*>(hdiDevice->CreateTensor(&desc));
+            rets[i] = executorPool.RunSync(&tensor, 1, &tensor, 1);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (size_t i = 0; i < threadNum; ++i) {
+        EXPECT_EQ(OH_NN_SUCCESS, rets[i]);
+    }
+    EXPECT_EQ(static_cast<int>(threadNum), nnExecutor->modelInferenceCount.load());
+
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
+
+/**
+ * @tc.name: nnexecutortest_runsyncreporter_001
+ * @tc.desc: Verify the RunSyncReporter only samples after a run is notified and coalesces the runs in one report.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_runsyncreporter_001, TestSize.Level0)
+{
+    LOGE("RunSyncReporter nnexecutortest_runsyncreporter_001");
+    const int64_t reportIntervalMs = 20;
+    const int runTimes = 3;
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    NNExecutor* nnExecutor = CreateAsyncExecutor(mockIPreparedMode);
+    ASSERT_NE(nullptr, nnExecutor);
+    nnExecutor->nnrtModelId = 1;
+
+    std::mutex reportMutex;
+    std::condition_variable reportCv;
+    std::vector<std::pair<size_t, int>> reports;
+    RunSyncReporter reporter([&](size_t nnrtModelId, int modelInferenceCount, size_t modelInferenceTotalTime) {
+        std::lock_guard<std::mutex> lock(reportMutex);
+        reports.emplace_back(nnrtModelId, modelInferenceCount);
+        reportCv.notify_one();
+    }, reportIntervalMs);
+    reporter.Register(nnExecutor);
+
+    // Idle executors never wake the worker up.
+    std::this_thread::sleep_for(std::chrono::milliseconds(reportIntervalMs * 3));
+    EXPECT_EQ(0, reporter.GetSampleCount());
+
+    for (int i = 0; i < runTimes; ++i) {
+        nnExecutor->modelInferenceCount.fetch_add(1);
+        reporter.NotifyRun();
+    }
+    {
+        std::unique_lock<std::mutex> lock(reportMutex);
+        EXPECT_TRUE(reportCv.wait_for(lock, std::chrono::seconds(1), [&reports] { return !reports.empty(); }));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(reportIntervalMs * 3));
+    EXPECT_EQ(1, reporter.GetSampleCount());
+    {
+        std::lock_guard<std::mutex> lock(reportMutex);
+        ASSERT_EQ(1, reports.size());
+        EXPECT_EQ(1, reports[0].first);
+        EXPECT_EQ(runTimes, reports[0].second);
+    }
+
+    reporter.Unregister(nnExecutor);
+    delete nnExecutor;
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
+
+/**
+ * @tc.name: nnexecutortest_runsyncreporter_002
+ * @tc.desc: Verify the RunSyncReporter does not report an unregistered executor and stops while it is waiting.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_runsyncreporter_002, TestSize.Level0)
+{
+    LOGE("RunSyncReporter nnexecutortest_runsyncreporter_002");
+    const int64_t reportIntervalMs = 20;
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    NNExecutor* nnExecutor = CreateAsyncExecutor(mockIPreparedMode);
+    ASSERT_NE(nullptr, nnExecutor);
+
+    std::atomic<size_t> reportNum {0};
+    {
+        RunSyncReporter reporter([&reportNum](size_t nnrtModelId, int modelInferenceCount,
+            size_t modelInferenceTotalTime) {
+            reportNum.fetch_add(1);
+        }, reportIntervalMs);
+        reporter.Register(nnExecutor);
+        reporter.Unregister(nnExecutor);
+
+        nnExecutor->modelInferenceCount.fetch_add(1);
+        reporter.NotifyRun();
+        std::this_thread::sleep_for(std::chrono::milliseconds(reportIntervalMs * 3));
+        EXPECT_EQ(1, reporter.GetSampleCount());
+
+        // Destroyed in the middle of an interval, the worker does not wait for it to end.
+        std::unique_ptr<RunSyncReporter> longReporter = std::make_unique<RunSyncReporter>(
+            [](size_t, int, size_t) {}, 60000);
+        longReporter->NotifyRun();
+        auto start = std::chrono::steady_clock::now();
+        longReporter.reset();
+        EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+    }
+    EXPECT_EQ(0, reportNum.load());
+
+    delete nnExecutor;
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
+
 /**
  * @tc.name: nnexecutortest_getbackendid_001
  * @tc.desc: Verify the QuantParams function return nullptr in case of fd -1.
@@ -2545,6 +3227,547 @@ HWTEST_F(NNExecutorTest, nnexecutortest_setextensionconfig_001, TestSize.Level0)
 
     testing::Mock::AllowLeak(mockIPreparedMode.get());
 }
+
+/**
+ * @tc.name: nnexecutortest_autounloadtracker_001
+ * @tc.desc: Verify the AutoUnloadTracker invokes the callback once per idle period, and not after Suppress.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_autounloadtracker_001, TestSize.Level0)
+{
+    LOGE("AutoUnloadTracker nnexecutortest_autounloadtracker_001");
+    const int64_t idleTimeoutMs = 20;
+    const auto waitTime = std::chrono::milliseconds(idleTimeoutMs * 5);
+    std::atomic<int64_t> lastUsedTime {0};
+    std::atomic<int> idleCount {0};
+
+    AutoUnloadTracker* tracker = AutoUnloadTracker::GetInstance();
+    AutoUnloadTracker::StoreNow(lastUsedTime);
+    uint64_t id = tracker->Register(lastUsedTime, idleTimeoutMs, [&idleCount]() { ++idleCount; });
+
+    std::this_thread::sleep_for(waitTime);
+    EXPECT_EQ(1, idleCount.load());
+
+    // A new use starts a new idle period.
+    AutoUnloadTracker::StoreNow(lastUsedTime);
+    std::this_thread::sleep_for(waitTime);
+    EXPECT_EQ(2, idleCount.load());
+
+    AutoUnloadTracker::StoreNow(lastUsedTime);
+    tracker->Suppress(id);
+    std::this_thread::sleep_for(waitTime);
+    EXPECT_EQ(2, idleCount.load());
+
+    tracker->Unregister(id);
+    AutoUnloadTracker::StoreNow(lastUsedTime);
+    std::this_thread::sleep_for(waitTime);
+    EXPECT_EQ(2, idleCount.load());
+}
+
+/**
+ * @tc.name: nnexecutortest_autounloadtracker_002
+ * @tc.desc: Verify the AutoUnloadTracker evicts the least recently used loaded model once the budget is exceeded.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_autounloadtracker_002, TestSize.Level0)
+{
+    LOGE("AutoUnloadTracker nnexecutortest_autounloadtracker_002");
+    const int64_t idleTimeoutMs = 60 * 1000;
+    const size_t modelSize = 1024;
+    const auto waitTime = std::chrono::milliseconds(100);
+    std::atomic<int64_t> lastUsedTime1 {0};
+    std::atomic<int64_t> lastUsedTime2 {0};
+    std::atomic<int> evictCount1 {0};
+    std::atomic<int> evictCount2 {0};
+
+    AutoUnloadTracker* tracker = AutoUnloadTracker::GetInstance();
+    AutoUnloadTracker::StoreNow(lastUsedTime1);
+    uint64_t id1 = tracker->Register(lastUsedTime1, idleTimeoutMs, []() {});
+    uint64_t id2 = tracker->Register(lastUsedTime2, idleTimeoutMs, []() {});
+    tracker->TrackMemory(id1, modelSize, [tracker, &id1, &evictCount1]() {
+        ++evictCount1;
+        tracker->SetLoaded(id1, false);
+        return true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    AutoUnloadTracker::StoreNow(lastUsedTime2);
+    tracker->TrackMemory(id2, modelSize, [tracker, &id2, &evictCount2]() {
+        ++evictCount2;
+        tracker->SetLoaded(id2, false);
+        return true;
+    });
+
+    OH_NN_ModelMemoryStatistics statistics;
+    tracker->GetMemoryStatistics(statistics);
+    EXPECT_EQ(modelSize * 2, statistics.loadedBytes);
+
+    tracker->SetMemoryBudget(modelSize + modelSize / 2);
+    std::this_thread::sleep_for(waitTime);
+    EXPECT_EQ(1, evictCount1.load());
+    EXPECT_EQ(0, evictCount2.load());
+    tracker->GetMemoryStatistics(statistics);
+    EXPECT_EQ(modelSize, statistics.loadedBytes);
+    EXPECT_EQ(1, statistics.loadedCount);
+
+    // A reloaded model counts as used, the other one is evicted.
+    tracker->SetLoaded(id1, true);
+    std::this_thread::sleep_for(waitTime);
+    EXPECT_EQ(1, evictCount1.load());
+    EXPECT_EQ(1, evictCount2.load());
+
+    tracker->SetMemoryBudget(0);
+    tracker->Unregister(id1);
+    tracker->Unregister(id2);
+    tracker->GetMemoryStatistics(statistics);
+    EXPECT_EQ(0, statistics.loadedBytes);
+}
+
+/**
+ * @tc.name: nnexecutortest_autounloadtracker_003
+ * @tc.desc: Verify the AutoUnloadTracker trims the idle shared buffers over the budget before evicting a model.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_autounloadtracker_003, TestSize.Level0)
+{
+    LOGE("AutoUnloadTracker nnexecutortest_autounloadtracker_003");
+    const int64_t idleTimeoutMs = 60 * 1000;
+    const size_t modelSize = 8192;
+    const size_t bufferSize = 8192;
+    const auto waitTime = std::chrono::milliseconds(100);
+    int lastFd = 0;
+    // Written by the sweeper thread.
+    std::atomic<int> releasedCount {0};
+    std::atomic<int> lastReleasedFd {-1};
+    SharedBufferPool pool(
+        [&lastFd](size_t length, int& fd) {
+            fd = ++lastFd;
+            return OH_NN_SUCCESS;
+        },
+        [&releasedCount, &lastReleasedFd](int fd, size_t length) {
+            lastReleasedFd = fd;
+            ++releasedCount;
+            return OH_NN_SUCCESS;
+        });
+    int fd1 = -1;
+    int fd2 = -1;
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Allocate(bufferSize, fd1));
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Allocate(bufferSize, fd2));
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Release(fd1, bufferSize));
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Release(fd2, bufferSize));
+
+    std::atomic<int64_t> lastUsedTime1 {0};
+    std::atomic<int64_t> lastUsedTime2 {0};
+    std::atomic<int> evictCount {0};
+    AutoUnloadTracker* tracker = AutoUnloadTracker::GetInstance();
+    AutoUnloadTracker::StoreNow(lastUsedTime1);
+    AutoUnloadTracker::StoreNow(lastUsedTime2);
+    uint64_t id1 = tracker->Register(lastUsedTime1, idleTimeoutMs, []() {});
+    uint64_t id2 = tracker->Register(lastUsedTime2, idleTimeoutMs, []() {});
+    tracker->TrackMemory(id1, modelSize, [&evictCount]() {
+        ++evictCount;
+        return false;
+    });
+    tracker->TrackMemory(id2, modelSize, [&evictCount]() {
+        ++evictCount;
+        return false;
+    });
+
+    // The models and one of the idle buffers fit in the budget, the least recently released buffer is trimmed.
+    tracker->SetMemoryBudget(modelSize * 2 + bufferSize);
+    std::this_thread::sleep_for(waitTime);
+    EXPECT_EQ(0, evictCount.load());
+    EXPECT_EQ(1, releasedCount.load());
+    EXPECT_EQ(fd1, lastReleasedFd.load());
+    OH_NN_ModelMemoryStatistics statistics;
+    tracker->GetMemoryStatistics(statistics);
+    EXPECT_EQ(bufferSize, statistics.pooledBytes);
+
+    // The models alone exceed the budget, all idle buffers are trimmed before a model is evicted.
+    tracker->SetMemoryBudget(modelSize);
+    std::this_thread::sleep_for(waitTime);
+    EXPECT_EQ(2, releasedCount.load());
+    EXPECT_EQ(fd2, lastReleasedFd.load());
+    EXPECT_LE(1, evictCount.load());
+
+    tracker->SetMemoryBudget(0);
+    tracker->Unregister(id1);
+    tracker->Unregister(id2);
+}
+
+/**
+ * @tc.name: nnexecutortest_latencyhistogram_001
+ * @tc.desc: Verify the LatencyHistogram estimates the percentiles with the upper bound of their buckets.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_latencyhistogram_001, TestSize.Level0)
+{
+    LOGE("LatencyHistogram nnexecutortest_latencyhistogram_001");
+    LatencyHistogram histogram;
+    OH_NN_LatencyStatistics statistics;
+    histogram.GetStatistics(statistics);
+    EXPECT_EQ(0, statistics.count);
+    EXPECT_EQ(0, statistics.p99);
+
+    const int64_t maxLatency = 100;
+    for (int64_t latency = 1; latency <= maxLatency; ++latency) {
+        histogram.Record(latency);
+    }
+    histogram.GetStatistics(statistics);
+    EXPECT_EQ(100, statistics.count);
+    EXPECT_EQ(55, statistics.p50);
+    EXPECT_EQ(95, statistics.p90);
+    EXPECT_EQ(100, statistics.p99);
+    EXPECT_EQ(100, statistics.max);
+
+    // Negative latencies of a clock going backwards are counted as 0.
+    histogram.Record(-1);
+    histogram.GetStatistics(statistics);
+    EXPECT_EQ(101, statistics.count);
+}
+
+/**
+ * @tc.name: nnexecutortest_reloadpredictor_001
+ * @tc.desc: Verify the ReloadPredictor starts the reload before the predicted demand by the lead of the reload cost.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_reloadpredictor_001, TestSize.Level0)
+{
+    LOGE("ReloadPredictor nnexecutortest_reloadpredictor_001");
+    const int64_t second = 1000 * 1000 * 1000;
+    ReloadPredictor predictor([]() {});
+    int64_t delay = 0;
+    EXPECT_FALSE(predictor.GetReloadDelay(0, 0, delay));
+
+    // The lead is at least 1s.
+    predictor.RecordIdleGap(10 * second);
+    EXPECT_TRUE(predictor.GetReloadDelay(0, 0, delay));
+    EXPECT_EQ(9 * second, delay);
+
+    // Or twice the reload cost.
+    predictor.RecordReloadCost(2 * second);
+    EXPECT_TRUE(predictor.GetReloadDelay(0, 0, delay));
+    EXPECT_EQ(6 * second, delay);
+
+    // A new idle gap weighs 1/4, 10s + (2s - 10s) / 4.
+    predictor.RecordIdleGap(2 * second);
+    EXPECT_TRUE(predictor.GetReloadDelay(0, 0, delay));
+    EXPECT_EQ(4 * second, delay);
+    EXPECT_TRUE(predictor.GetReloadDelay(second, 2 * second, delay));
+    EXPECT_EQ(3 * second, delay);
+
+    // The predicted demand is too close to reload in time.
+    EXPECT_FALSE(predictor.GetReloadDelay(0, 5 * second, delay));
+}
+
+/**
+ * @tc.name: nnexecutortest_reloadpredictor_002
+ * @tc.desc: Verify the ReloadPredictor invokes the scheduled reload once, and not after it is stopped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_reloadpredictor_002, TestSize.Level0)
+{
+    LOGE("ReloadPredictor nnexecutortest_reloadpredictor_002");
+    const int64_t millisecond = 1000 * 1000;
+    const int64_t minLead = 1000 * millisecond;
+    const auto waitTime = std::chrono::milliseconds(500);
+    std::atomic<int> reloadCount {0};
+
+    ReloadPredictor predictor([&reloadCount]() { ++reloadCount; });
+    // Nothing is predicted yet.
+    EXPECT_EQ(OH_NN_SUCCESS, predictor.Schedule(AutoUnloadTracker::Now()));
+    std::this_thread::sleep_for(waitTime);
+    EXPECT_EQ(0, reloadCount.load());
+
+    // The reload is due 50ms after the idle period started.
+    predictor.RecordIdleGap(minLead + 50 * millisecond);
+    EXPECT_EQ(OH_NN_SUCCESS, predictor.Schedule(AutoUnloadTracker::Now()));
+    EXPECT_EQ(OH_NN_SUCCESS, predictor.Schedule(AutoUnloadTracker::Now()));
+    std::this_thread::sleep_for(waitTime);
+    EXPECT_EQ(1, reloadCount.load());
+
+    // A pending reload is cancelled by Stop, and nothing is scheduled afterwards.
+    EXPECT_EQ(OH_NN_SUCCESS, predictor.Schedule(AutoUnloadTracker::Now()));
+    predictor.Stop();
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, predictor.Schedule(AutoUnloadTracker::Now()));
+    std::this_thread::sleep_for(waitTime);
+    EXPECT_EQ(1, reloadCount.load());
+}
+
+/**
+ * @tc.name: nnexecutortest_reloadpredictor_003
+ * @tc.desc: Verify Stop of the ReloadPredictor returns only after the reload being invoked has finished.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_reloadpredictor_003, TestSize.Level0)
+{
+    LOGE("ReloadPredictor nnexecutortest_reloadpredictor_003");
+    const int64_t millisecond = 1000 * 1000;
+    const int64_t minLead = 1000 * millisecond;
+    const auto reloadTime = std::chrono::milliseconds(100);
+    std::atomic<bool> isStarted {false};
+    std::atomic<bool> isFinished {false};
+
+    // Stands for the executor, which must not be reloaded once it is being destroyed.
+    std::unique_ptr<ReloadPredictor> predictor = std::make_unique<ReloadPredictor>([&]() {
+        isStarted = true;
+        std::this_thread::sleep_for(reloadTime);
+        isFinished = true;
+    });
+    predictor->RecordIdleGap(minLead + millisecond);
+    EXPECT_EQ(OH_NN_SUCCESS, predictor->Schedule(AutoUnloadTracker::Now()));
+    while (!isStarted) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    predictor.reset();
+    EXPECT_TRUE(isFinished.load());
+}
+
+/**
+ * @tc.name: nnexecutortest_getstatistics_001
+ * @tc.desc: Verify the GetStatistics function counts every stage of the successful executions.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_getstatistics_001, TestSize.Level0)
+{
+    LOGE("GetStatistics nnexecutortest_getstatistics_001");
+    const auto runTime = std::chrono::milliseconds(2);
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    EXPECT_CALL(*mockIPreparedMode, Run(::testing::An<const std::vector<NN_Tensor*>&>(),
+        ::testing::An<const std::vector<NN_Tensor*>&>(), ::testing::_, ::testing::_))
+        .WillRepeatedly(Invoke([runTime](const std::vector<NN_Tensor*>& inputs,
+            const std::vector<NN_Tensor*>& outputs, std::vector<std::vector<int32_t>>& outputsDims,
+            std::vector<bool>& isOutputBufferEnough) {
+                std::this_thread::sleep_for(runTime);
+                outputsDims = {{3, 3}};
+                isOutputBufferEnough = {true};
+                return OH_NN_SUCCESS;
+            }));
+    NNExecutor* nnExecutor = CreateAsyncExecutor(mockIPreparedMode);
+    EXPECT_NE(nullptr, nnExecutor);
+
+    std::shared_ptr<MockIDevice> device = std::make_shared<MockIDevice>();
+    std::unique_ptr<NNBackend> hdiDevice = std::make_unique<NNBackend>(device, 1);
+    TensorDesc desc;
+    desc.SetShape(m_dimArry, m_dimensionCount);
+    NN_Tensor* tensor = reinterpret_cast<NN_Tensor*>(hdiDevice->CreateTensor(&desc));
+
+    const size_t runNum = 3;
+    ExecutionContext context;
+    for (size_t i = 0; i < runNum; ++i) {
+        EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->RunSyncInContext(context, &tensor, 1, &tensor, 1));
+    }
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, nnExecutor->RunSync(&tensor, 1, &tensor, 0));
+
+    OH_NN_ExecutorStatistics statistics;
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->GetStatistics(statistics));
+    EXPECT_EQ(runNum, statistics.queue.count);
+    EXPECT_EQ(runNum, statistics.run.count);
+    EXPECT_EQ(runNum, statistics.postProcess.count);
+    EXPECT_EQ(runNum, statistics.total.count);
+    const uint64_t runTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(runTime).count();
+    EXPECT_LE(runTimeUs, statistics.run.p50);
+    EXPECT_LE(statistics.run.p99, statistics.run.max);
+    EXPECT_LE(statistics.run.max, statistics.total.max);
+
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
+
+/**
+ * @tc.name: nnexecutortest_registerbuffer_001
+ * @tc.desc: Verify the SetOutput function sets a registered buffer to the output without a device buffer.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_registerbuffer_001, TestSize.Level0)
+{
+    LOGE("RegisterBuffer nnexecutortest_registerbuffer_001");
+    size_t m_backendID {0};
+    std::shared_ptr<Device> m_device {nullptr};
+    std::shared_ptr<PreparedModel> m_preparedModel {nullptr};
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_inputTensorDescs;
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> m_outputTensorDescs;
+    std::shared_ptr<TensorDesc> tensorDesc = std::make_shared<TensorDesc>();
+    tensorDesc->SetDataType(OH_NN_FLOAT32);
+    tensorDesc->SetShape(m_dimArry, m_dimensionCount);
+    m_outputTensorDescs.emplace_back(tensorDesc, OH_NN_TENSOR);
+    ExtensionConfig extensionConfig;
+    OH_NN_PerformanceMode performance {OH_NN_PERFORMANCE_EXTREME};
+    OH_NN_Priority priority {OH_NN_PRIORITY_HIGH};
+
+    NNExecutor* nnExecutor = new (std::nothrow) NNExecutor(
+        m_backendID, m_device, m_preparedModel, m_inputTensorDescs, m_outputTensorDescs, "", 0, extensionConfig,
+        false, performance, priority);
+
+    int fd = 0;
+    size_t length = 9 * sizeof(float);
+    void* buffer = m_dataArry;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, nnExecutor->UnregisterBuffer(buffer));
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->RegisterBuffer(buffer, length, fd));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, nnExecutor->RegisterBuffer(buffer, length, fd));
+
+    // Without a device, only the registered buffer can be set to the output.
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->SetOutput(m_index, buffer, length));
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, nnExecutor->UnregisterBuffer(buffer));
+
+    OH_NN_ExecutorStatistics statistics;
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->GetStatistics(statistics));
+    EXPECT_EQ(0, statistics.inputCopyCount);
+    EXPECT_EQ(0, statistics.outputCopyCount);
+
+    // The registration ends with the executor.
+    delete nnExecutor;
+    Memory memory;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, MemoryManager::GetInstance()->GetMemory(buffer, memory));
+}
+
+/**
+ * @tc.name: nnexecutortest_registerbuffer_002
+ * @tc.desc: Verify the buffers are registered and unregistered from several threads at the same time.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_registerbuffer_002, TestSize.Level0)
+{
+    LOGE("RegisterBuffer nnexecutortest_registerbuffer_002");
+    const size_t threadNum = 4;
+    const size_t repeatTimes = 100;
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> inputTensorDescs;
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> outputTensorDescs;
+    ExtensionConfig extensionConfig;
+    NNExecutor* nnExecutor = new (std::nothrow) NNExecutor(0, nullptr, nullptr, inputTensorDescs,
+        outputTensorDescs, "", 0, extensionConfig, false, OH_NN_PERFORMANCE_NONE, OH_NN_PRIORITY_NONE);
+    ASSERT_NE(nullptr, nnExecutor);
+
+    float buffers[threadNum][9] {};
+    std::vector<size_t> failNums(threadNum, 0);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadNum; ++i) {
+        threads.emplace_back([nnExecutor, &buffers, &failNums, i]() {
+            for (size_t j = 0; j < repeatTimes; ++j) {
+                if (nnExecutor->RegisterBuffer(buffers[i], sizeof(buffers[i]), 0) != OH_NN_SUCCESS ||
+                    nnExecutor->UnregisterBuffer(buffers[i]) != OH_NN_SUCCESS) {
+                    ++failNums[i];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (size_t i = 0; i < threadNum; ++i) {
+        EXPECT_EQ(0, failNums[i]);
+        EXPECT_EQ(OH_NN_INVALID_PARAMETER, nnExecutor->UnregisterBuffer(buffers[i]));
+    }
+
+    delete nnExecutor;
+}
+
+/**
+ * @tc.name: nnexecutortest_memoryaccount_001
+ * @tc.desc: Verify the memory of an executor is counted by its account and the process, and dumped to a file.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_memoryaccount_001, TestSize.Level0)
+{
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> inputTensorDescs;
+    std::vector<std::pair<std::shared_ptr<TensorDesc>, OH_NN_TensorType>> outputTensorDescs;
+    ExtensionConfig extensionConfig;
+    OH_NN_MemoryStatistics processBefore;
+    MemoryAccount::GetProcessAccount().GetStatistics(processBefore);
+
+    NNExecutor* nnExecutor = new (std::nothrow) NNExecutor(0, nullptr, nullptr, inputTensorDescs,
+        outputTensorDescs, "", 0, extensionConfig, false, OH_NN_PERFORMANCE_NONE, OH_NN_PRIORITY_NONE);
+    ASSERT_NE(nullptr, nnExecutor);
+    nnExecutor->TrackModelMemory(1024);
+
+    OH_NN_MemoryStatistics statistics;
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->GetMemoryStatistics(statistics));
+    EXPECT_EQ(1024, statistics.weights.liveBytes);
+    EXPECT_EQ(1024, statistics.weights.peakBytes);
+    EXPECT_EQ(0, statistics.staging.liveBytes);
+
+    {
+        MemoryAccount account("test", this);
+        account.Add(MemoryCategory::STAGING, 100);
+        account.Add(MemoryCategory::STAGING, 50);
+        account.Sub(MemoryCategory::STAGING, 120);
+        account.GetStatistics(statistics);
+        EXPECT_EQ(30, statistics.staging.liveBytes);
+        EXPECT_EQ(150, statistics.staging.peakBytes);
+
+        OH_NN_MemoryStatistics process;
+        MemoryAccount::GetProcessAccount().GetStatistics(process);
+        EXPECT_EQ(processBefore.weights.liveBytes + 1024, process.weights.liveBytes);
+        EXPECT_EQ(processBefore.staging.liveBytes + 30, process.staging.liveBytes);
+
+        std::error_code errorCode;
+        std::string dumpDir = (std::filesystem::temp_directory_path(errorCode) / "nnrt_memory_XXXXXX").string();
+        ASSERT_NE(nullptr, mkdtemp(dumpDir.data()));
+        std::string dumpPath = dumpDir + "/memory_dump.txt";
+        EXPECT_EQ(OH_NN_SUCCESS, MemoryAccount::Dump(dumpPath));
+        std::ifstream dumpStream(dumpPath);
+        std::stringstream dump;
+        dump << dumpStream.rdbuf();
+        EXPECT_NE(std::string::npos, dump.str().find("weights=1024/1024"));
+        EXPECT_NE(std::string::npos, dump.str().find("staging=30/150"));
+        std::remove(dumpPath.c_str());
+        rmdir(dumpDir.c_str());
+    }
+
+    // The live bytes left by the owners are removed from the process once they are destroyed.
+    delete nnExecutor;
+    OH_NN_MemoryStatistics processAfter;
+    MemoryAccount::GetProcessAccount().GetStatistics(processAfter);
+    EXPECT_EQ(processBefore.weights.liveBytes, processAfter.weights.liveBytes);
+    EXPECT_EQ(processBefore.staging.liveBytes, processAfter.staging.liveBytes);
+}
+
+/**
+ * @tc.name: nnexecutortest_memoryaccount_002
+ * @tc.desc: Verify the weights of a prepared model shared by several executors are counted once by the process.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNExecutorTest, nnexecutortest_memoryaccount_002, TestSize.Level0)
+{
+    const size_t modelSize = 1024;
+    OH_NN_MemoryStatistics processBefore;
+    MemoryAccount::GetProcessAccount().GetStatistics(processBefore);
+
+    std::shared_ptr<MockIPreparedModel> mockIPreparedMode = std::make_shared<MockIPreparedModel>();
+    NNExecutor* nnExecutor = CreateAsyncExecutor(mockIPreparedMode);
+    NNExecutor* sharedExecutor = CreateAsyncExecutor(mockIPreparedMode);
+    ASSERT_NE(nullptr, nnExecutor);
+    ASSERT_NE(nullptr, sharedExecutor);
+    nnExecutor->TrackModelMemory(modelSize);
+    sharedExecutor->TrackModelMemory(modelSize);
+
+    OH_NN_MemoryStatistics statistics;
+    EXPECT_EQ(OH_NN_SUCCESS, nnExecutor->GetMemoryStatistics(statistics));
+    EXPECT_EQ(modelSize, statistics.weights.liveBytes);
+    EXPECT_EQ(OH_NN_SUCCESS, sharedExecutor->GetMemoryStatistics(statistics));
+    EXPECT_EQ(modelSize, statistics.weights.liveBytes);
+    MemoryAccount::GetProcessAccount().GetStatistics(statistics);
+    EXPECT_EQ(processBefore.weights.liveBytes + modelSize, statistics.weights.liveBytes);
+
+    // The process keeps the weights while another executor still holds the prepared model.
+    delete nnExecutor;
+    MemoryAccount::GetProcessAccount().GetStatistics(statistics);
+    EXPECT_EQ(processBefore.weights.liveBytes + modelSize, statistics.weights.liveBytes);
+
+    {
+        // An account destroyed while it holds shared memory only releases its share.
+        MemoryAccount account("test", this);
+        account.AddShared(MemoryCategory::WEIGHTS, mockIPreparedMode.get(), modelSize);
+        account.AddShared(MemoryCategory::WEIGHTS, mockIPreparedMode.get(), modelSize);
+        EXPECT_EQ(modelSize, account.GetLiveBytes(MemoryCategory::WEIGHTS));
+    }
+    MemoryAccount::GetProcessAccount().GetStatistics(statistics);
+    EXPECT_EQ(processBefore.weights.liveBytes + modelSize, statistics.weights.liveBytes);
+
+    delete sharedExecutor;
+    MemoryAccount::GetProcessAccount().GetStatistics(statistics);
+    EXPECT_EQ(processBefore.weights.liveBytes, statistics.weights.liveBytes);
+    testing::Mock::AllowLeak(mockIPreparedMode.get());
+}
 } // namespace UnitTest
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
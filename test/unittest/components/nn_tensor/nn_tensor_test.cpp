@@ -13,6 +13,10 @@
  * limitations under the License.
  */
 
+#include <atomic>
+#include <sys/mman.h>
+#include <unistd.h>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -27,6 +31,7 @@
 #include "utils.h"
 #include "log.h"
 #include "hdi_device_v1_0.h"
+#include "tensor_arena.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -1478,6 +1483,256 @@ HWTEST_F(NNTensor2Test, nntensor2_0test_checkdimranges_004, TestSize.Level0)
     OH_NN_ReturnCode ret = nnTensor->CheckDimRanges(minDimRanges, maxDimRanges);
     EXPECT_EQ(OH_NN_INVALID_PARAMETER, ret);
 }
+
+/**
+ * @tc.name: nntensor2_0test_resizedata_001
+ * @tc.desc: Verify the ResizeData function keeps the tensor unchanged when the new buffer cannot be created.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNTensor2Test, nntensor2_0test_resizedata_001, TestSize.Level0)
+{
+    LOGE("ResizeData nntensor2_0test_resizedata_001");
+    size_t backendId = 1;
+
+    NNTensor2_0* nnTensor = new (std::nothrow) NNTensor2_0(backendId);
+    EXPECT_NE(nullptr, nnTensor);
+
+    OH_NN_ReturnCode ret = nnTensor->ResizeData(ALLOCATE_BUFFER_LIMIT + 1);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, ret);
+
+    ret = nnTensor->ResizeData(10);
+    EXPECT_EQ(OH_NN_NULL_PTR, ret);
+    EXPECT_EQ(nullptr, nnTensor->GetData());
+    EXPECT_EQ(0, nnTensor->GetSize());
+
+    delete nnTensor;
+}
+
+/**
+ * @tc.name: nntensor2_0test_createview_001
+ * @tc.desc: Verify the CreateView function shares the data of base at the offset and keeps base alive.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNTensor2Test, nntensor2_0test_createview_001, TestSize.Level0)
+{
+    LOGE("CreateView nntensor2_0test_createview_001");
+    size_t backendId = 1;
+    char data[64] = {0};
+    int fd = 5;
+
+    std::shared_ptr<NNTensor2_0> base = std::make_shared<NNTensor2_0>(backendId);
+    base->SetData(data);
+    base->SetFd(fd);
+    base->SetSize(sizeof(data));
+
+    TensorDesc desc;
+    desc.SetDataType(OH_NN_FLOAT32);
+    int32_t shape[] = {2, 2};
+    desc.SetShape(shape, 2);
+
+    NNTensor2_0* view = new (std::nothrow) NNTensor2_0(backendId);
+    EXPECT_NE(nullptr, view);
+    EXPECT_EQ(OH_NN_NULL_PTR, view->CreateView(base, 0));
+    EXPECT_EQ(OH_NN_SUCCESS, view->SetTensorDesc(&desc));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, view->CreateView(base, 49));
+    EXPECT_EQ(OH_NN_SUCCESS, view->CreateView(base, 48));
+    EXPECT_EQ(data + 48, view->GetData());
+    EXPECT_EQ(fd, view->GetFd());
+    EXPECT_EQ(sizeof(data), view->GetSize());
+    EXPECT_EQ(48, view->GetOffset());
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, view->ResizeData(32));
+    EXPECT_EQ(2, base.use_count());
+
+    delete view;
+    EXPECT_EQ(1, base.use_count());
+    // The data is not created by the backend and must not be released by base.
+    base->SetData(nullptr);
+}
+
+// Backend whose device allocates the buffers from memfd, so that the arena maps a real buffer.
+constexpr size_t ARENA_BACKEND_ID = 3;
+std::atomic<int> g_arenaReleaseCount {0};
+
+std::shared_ptr<Backend> CreateArenaBackend()
+{
+    std::shared_ptr<MockIDevice> device = std::make_shared<MockIDevice>();
+    EXPECT_CALL(*device, GetDeviceStatus(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(AVAILABLE), ::testing::Return(OH_NN_SUCCESS)));
+    std::string backendName = "arena";
+    EXPECT_CALL(*device, GetDeviceName(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(backendName), ::testing::Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*device, GetVendorName(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(backendName), ::testing::Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*device, GetVersion(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(backendName), ::testing::Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*device, AllocateBuffer(::testing::_, ::testing::An<int&>()))
+        .WillRepeatedly(Invoke([](size_t length, int& fd) {
+            fd = memfd_create("nn_tensor_test", 0);
+            if (fd < 0 || ftruncate(fd, length) != 0) {
+                return OH_NN_MEMORY_ERROR;
+            }
+            return OH_NN_SUCCESS;
+        }));
+    EXPECT_CALL(*device, ReleaseBuffer(::testing::An<int>(), ::testing::_))
+        .WillRepeatedly(Invoke([](int fd, size_t length) {
+            close(fd);
+            ++g_arenaReleaseCount;
+            return OH_NN_SUCCESS;
+        }));
+    testing::Mock::AllowLeak(device.get());
+    return std::make_shared<NNBackend>(device, ARENA_BACKEND_ID);
+}
+
+TensorDesc CreateFloatDesc(int32_t elementNum)
+{
+    TensorDesc desc;
+    desc.SetDataType(OH_NN_FLOAT32);
+    desc.SetShape(&elementNum, 1);
+    return desc;
+}
+
+/**
+ * @tc.name: nntensor2_0test_tensorarena_001
+ * @tc.desc: Verify the TensorArena creates each tensor right after the previous one, until the buffer is full.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNTensor2Test, nntensor2_0test_tensorarena_001, TestSize.Level0)
+{
+    LOGE("TensorArena nntensor2_0test_tensorarena_001");
+    BackendManager& backendManager = BackendManager::GetInstance();
+    EXPECT_EQ(OH_NN_SUCCESS, backendManager.RegisterBackend("arena", CreateArenaBackend));
+    TensorDesc smallDesc = CreateFloatDesc(4);
+    TensorDesc largeDesc = CreateFloatDesc(56);
+
+    TensorArena arena(ARENA_BACKEND_ID);
+    EXPECT_EQ(nullptr, arena.CreateTensor(&smallDesc, 1));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, arena.Init(0));
+    EXPECT_EQ(OH_NN_SUCCESS, arena.Init(256));
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, arena.Init(256));
+    EXPECT_EQ(256, arena.GetSize());
+    EXPECT_EQ(0, arena.GetUsedSize());
+
+    auto* first = reinterpret_cast<NNTensor2_0*>(arena.CreateTensor(&smallDesc, 1));
+    auto* second = reinterpret_cast<NNTensor2_0*>(arena.CreateTensor(&smallDesc, 1));
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    EXPECT_EQ(0, first->GetOffset());
+    EXPECT_EQ(16, second->GetOffset());
+    EXPECT_EQ(static_cast<char*>(first->GetData()) + 16, second->GetData());
+    EXPECT_EQ(first->GetFd(), second->GetFd());
+    EXPECT_EQ(32, arena.GetUsedSize());
+
+    // 224 bytes fill the buffer, nothing is left for the next tensor.
+    auto* last = reinterpret_cast<NNTensor2_0*>(arena.CreateTensor(&largeDesc, 1));
+    ASSERT_NE(nullptr, last);
+    EXPECT_EQ(32, last->GetOffset());
+    EXPECT_EQ(256, arena.GetUsedSize());
+    EXPECT_EQ(nullptr, arena.CreateTensor(&smallDesc, 1));
+    EXPECT_EQ(256, arena.GetUsedSize());
+
+    // A view at an explicit offset may overlap the others and does not advance the arena.
+    auto* slice = reinterpret_cast<NNTensor2_0*>(arena.CreateTensorAt(&smallDesc, 8));
+    ASSERT_NE(nullptr, slice);
+    EXPECT_EQ(static_cast<char*>(first->GetData()) + 8, slice->GetData());
+    EXPECT_EQ(nullptr, arena.CreateTensorAt(&smallDesc, 248));
+    EXPECT_EQ(256, arena.GetUsedSize());
+
+    delete first;
+    delete second;
+    delete last;
+    delete slice;
+    backendManager.RemoveBackend("arena");
+}
+
+/**
+ * @tc.name: nntensor2_0test_tensorarena_002
+ * @tc.desc: Verify the TensorArena creates the tensors at offsets aligned to the power of 2 which is passed.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNTensor2Test, nntensor2_0test_tensorarena_002, TestSize.Level0)
+{
+    LOGE("TensorArena nntensor2_0test_tensorarena_002");
+    BackendManager& backendManager = BackendManager::GetInstance();
+    EXPECT_EQ(OH_NN_SUCCESS, backendManager.RegisterBackend("arena", CreateArenaBackend));
+    TensorDesc scalarDesc = CreateFloatDesc(1);
+    TensorDesc smallDesc = CreateFloatDesc(4);
+
+    TensorArena arena(ARENA_BACKEND_ID);
+    EXPECT_EQ(OH_NN_SUCCESS, arena.Init(256));
+    auto* scalar = reinterpret_cast<NNTensor2_0*>(arena.CreateTensor(&scalarDesc, TENSOR_ARENA_DEFAULT_ALIGNMENT));
+    ASSERT_NE(nullptr, scalar);
+    EXPECT_EQ(0, scalar->GetOffset());
+    EXPECT_EQ(4, arena.GetUsedSize());
+
+    EXPECT_EQ(nullptr, arena.CreateTensor(&smallDesc, 0));
+    EXPECT_EQ(nullptr, arena.CreateTensor(&smallDesc, 48));
+    EXPECT_EQ(4, arena.GetUsedSize());
+
+    // The padding up to the alignment is skipped.
+    auto* aligned = reinterpret_cast<NNTensor2_0*>(arena.CreateTensor(&smallDesc, TENSOR_ARENA_DEFAULT_ALIGNMENT));
+    ASSERT_NE(nullptr, aligned);
+    EXPECT_EQ(64, aligned->GetOffset());
+    EXPECT_EQ(static_cast<char*>(scalar->GetData()) + 64, aligned->GetData());
+    EXPECT_EQ(80, arena.GetUsedSize());
+
+    auto* packed = reinterpret_cast<NNTensor2_0*>(arena.CreateTensor(&scalarDesc, 4));
+    ASSERT_NE(nullptr, packed);
+    EXPECT_EQ(80, packed->GetOffset());
+    EXPECT_EQ(84, arena.GetUsedSize());
+
+    // The aligned offset is at the end of the buffer.
+    EXPECT_EQ(nullptr, arena.CreateTensor(&scalarDesc, 256));
+    EXPECT_EQ(84, arena.GetUsedSize());
+
+    delete scalar;
+    delete aligned;
+    delete packed;
+    backendManager.RemoveBackend("arena");
+}
+
+/**
+ * @tc.name: nntensor2_0test_tensorarena_003
+ * @tc.desc: Verify the TensorArena is not reset while its tensors are alive, and its buffer outlives the arena
+ *           until the last tensor is destroyed.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NNTensor2Test, nntensor2_0test_tensorarena_003, TestSize.Level0)
+{
+    LOGE("TensorArena nntensor2_0test_tensorarena_003");
+    BackendManager& backendManager = BackendManager::GetInstance();
+    EXPECT_EQ(OH_NN_SUCCESS, backendManager.RegisterBackend("arena", CreateArenaBackend));
+    TensorDesc smallDesc = CreateFloatDesc(4);
+    g_arenaReleaseCount = 0;
+
+    auto arena = std::make_unique<TensorArena>(ARENA_BACKEND_ID);
+    EXPECT_EQ(OH_NN_SUCCESS, arena->Reset());
+    EXPECT_EQ(OH_NN_SUCCESS, arena->Init(256));
+    auto* first = reinterpret_cast<NNTensor2_0*>(arena->CreateTensor(&smallDesc, 1));
+    auto* second = reinterpret_cast<NNTensor2_0*>(arena->CreateTensor(&smallDesc, 1));
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, arena->Reset());
+    EXPECT_EQ(32, arena->GetUsedSize());
+    delete first;
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, arena->Reset());
+    delete second;
+    EXPECT_EQ(OH_NN_SUCCESS, arena->Reset());
+    EXPECT_EQ(0, arena->GetUsedSize());
+
+    // The whole buffer is available again.
+    auto* reused = reinterpret_cast<NNTensor2_0*>(arena->CreateTensor(&smallDesc, 1));
+    ASSERT_NE(nullptr, reused);
+    EXPECT_EQ(0, reused->GetOffset());
+    static_cast<float*>(reused->GetData())[3] = 1.0f;
+
+    arena.reset();
+    EXPECT_EQ(0, g_arenaReleaseCount.load());
+    EXPECT_EQ(1.0f, static_cast<float*>(reused->GetData())[3]);
+    delete reused;
+    EXPECT_EQ(1, g_arenaReleaseCount.load());
+    backendManager.RemoveBackend("arena");
+}
 } // namespace UnitTest
 } // namespace NeuralNetworkRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "operator_fuser.h"
+#include "test/unittest/common/lite_graph_test.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+namespace MSLITE = mindspore::lite;
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class OperatorFuserTest : public LiteGraphTest {
+protected:
+    MSLITE::PrimitivePtr CreateConv2D()
+    {
+        return MSLITE::MindIR_Conv2DFusion_CreatePrimitive({1, 1}, {1, 1}, {1, 1}, MSLITE::PAD_MODE_PAD,
+            {0, 0, 0, 0}, 1, 2, 2, MSLITE::ACTIVATION_TYPE_NO_ACTIVATION);
+    }
+
+    void Optimize(GraphPassSummary& summary, std::vector<uint32_t>& nodeMap)
+    {
+        LiteGraphRewriter rewriter;
+        ASSERT_EQ(OH_NN_SUCCESS, rewriter.Init(&m_liteGraph));
+        OperatorFuser().Fuse(rewriter, summary);
+        rewriter.Commit(summary);
+        nodeMap = rewriter.GetNodeMap();
+    }
+};
+
+/**
+ * @tc.name: operatorfusertest_fuse_001
+ * @tc.desc: Verify a Conv2DFusion absorbs a chain of FusedBatchNorm, BiasAdd and ReLU into its weight, bias and
+ *           activation type.
+ * @tc.type: FUNC
+ */
+HWTEST_F(OperatorFuserTest, operatorfusertest_fuse_001, TestSize.Level0)
+{
+    uint32_t input = AddTensor({1, 4, 4, 2});
+    uint32_t weight = AddConstTensor({2, 1, 1, 2}, {1.0f, 2.0f, 3.0f, 4.0f});
+    uint32_t bias = AddConstTensor({2}, {0.5f, -1.0f});
+    uint32_t convOutput = AddTensor({1, 4, 4, 2});
+    uint32_t scale = AddConstTensor({2}, {2.0f, 1.0f});
+    uint32_t offset = AddConstTensor({2}, {1.0f, 0.0f});
+    uint32_t mean = AddConstTensor({2}, {0.5f, 1.0f});
+    uint32_t variance = AddConstTensor({2}, {3.0f, 3.0f});
+    uint32_t normOutput = AddTensor({1, 4, 4, 2});
+    uint32_t addend = AddConstTensor({2}, {1.0f, 2.0f});
+    uint32_t addOutput = AddTensor({1, 4, 4, 2});
+    uint32_t output = AddTensor({1, 4, 4, 2});
+    m_liteGraph.input_indices_ = {input};
+    m_liteGraph.output_indices_ = {output};
+    AddNode(CreateConv2D(), {input, weight, bias}, {convOutput});
+    AddNode(MSLITE::MindIR_FusedBatchNorm_CreatePrimitive(1.0f), {convOutput, scale, offset, mean, variance},
+        {normOutput});
+    AddNode(MSLITE::MindIR_BiasAdd_CreatePrimitive(), {normOutput, addend}, {addOutput});
+    AddNode(CreateActivation(MSLITE::ACTIVATION_TYPE_RELU), {addOutput}, {output});
+
+    GraphPassSummary summary;
+    std::vector<uint32_t> nodeMap;
+    Optimize(summary, nodeMap);
+    EXPECT_EQ(3, summary.fusedCount);
+    EXPECT_EQ(1, summary.nodeCount);
+    EXPECT_EQ(8, summary.removedTensorCount);
+    EXPECT_EQ((std::vector<uint32_t> {0, 0, 0, 0}), nodeMap);
+
+    ASSERT_EQ(1, m_liteGraph.all_nodes_.size());
+    ASSERT_EQ(4, m_liteGraph.all_tensors_.size());
+    const auto* node = m_liteGraph.all_nodes_[0];
+    EXPECT_EQ((std::vector<uint32_t> {0, 1, 2}), node->input_indices_);
+    EXPECT_EQ((std::vector<uint32_t> {3}), node->output_indices_);
+    EXPECT_EQ((std::vector<uint32_t> {3}), m_liteGraph.output_indices_);
+    EXPECT_EQ(MSLITE::ACTIVATION_TYPE_RELU, MSLITE::MindIR_Conv2DFusion_GetActivationType(node->primitive_));
+    EXPECT_EQ((std::vector<float> {1.0f, 2.0f, 1.5f, 2.0f}), GetValues<float>(1));
+    EXPECT_EQ((std::vector<float> {2.0f, 1.0f}), GetValues<float>(2));
+}
+
+/**
+ * @tc.name: operatorfusertest_fuse_002
+ * @tc.desc: Verify a Conv2DFusion without bias absorbs a ScaleFusion with its activation, and a MatMulFusion absorbs
+ *           a ReLU6.
+ * @tc.type: FUNC
+ */
+HWTEST_F(OperatorFuserTest, operatorfusertest_fuse_002, TestSize.Level0)
+{
+    uint32_t input = AddTensor({1, 4, 4, 2});
+    uint32_t weight = AddConstTensor({2, 1, 1, 2}, {1.0f, 2.0f, 3.0f, 4.0f});
+    uint32_t convOutput = AddTensor({1, 4, 4, 2});
+    uint32_t scale = AddConstTensor({2}, {2.0f, 3.0f});
+    uint32_t offset = AddConstTensor({2}, {1.0f, 1.0f});
+    uint32_t output = AddTensor({1, 4, 4, 2});
+    uint32_t matrix = AddTensor({2, 2});
+    uint32_t matMulOutput = AddTensor({4, 2});
+    uint32_t matMulWeight = AddConstTensor({2, 2}, {1.0f, 0.0f, 0.0f, 1.0f});
+    uint32_t secondOutput = AddTensor({4, 2});
+    m_liteGraph.input_indices_ = {input, matrix};
+    m_liteGraph.output_indices_ = {output, secondOutput};
+    AddNode(CreateConv2D(), {input, weight}, {convOutput});
+    AddNode(MSLITE::MindIR_ScaleFusion_CreatePrimitive(-1, MSLITE::ACTIVATION_TYPE_RELU6), {convOutput, scale, offset},
+        {output});
+    AddNode(MSLITE::MindIR_MatMulFusion_CreatePrimitive(false, false, MSLITE::ACTIVATION_TYPE_NO_ACTIVATION),
+        {matrix, matMulWeight}, {matMulOutput});
+    AddNode(CreateActivation(MSLITE::ACTIVATION_TYPE_RELU6), {matMulOutput}, {secondOutput});
+
+    GraphPassSummary summary;
+    std::vector<uint32_t> nodeMap;
+    Optimize(summary, nodeMap);
+    EXPECT_EQ(2, summary.fusedCount);
+    EXPECT_EQ((std::vector<uint32_t> {0, 0, 1, 1}), nodeMap);
+
+    ASSERT_EQ(2, m_liteGraph.all_nodes_.size());
+    const auto* conv = m_liteGraph.all_nodes_[0];
+    ASSERT_EQ(3, conv->input_indices_.size());
+    EXPECT_EQ(MSLITE::ACTIVATION_TYPE_RELU6, MSLITE::MindIR_Conv2DFusion_GetActivationType(conv->primitive_));
+    EXPECT_EQ((std::vector<float> {2.0f, 4.0f, 9.0f, 12.0f}), GetValues<float>(conv->input_indices_[1]));
+    EXPECT_EQ((std::vector<float> {1.0f, 1.0f}), GetValues<float>(conv->input_indices_[2]));
+    EXPECT_EQ(m_liteGraph.output_indices_[0], conv->output_indices_[0]);
+
+    const auto* matMul = m_liteGraph.all_nodes_[1];
+    EXPECT_EQ(MSLITE::ACTIVATION_TYPE_RELU6, MSLITE::MindIR_MatMulFusion_GetActivationType(matMul->primitive_));
+    EXPECT_EQ(m_liteGraph.output_indices_[1], matMul->output_indices_[0]);
+}
+
+/**
+ * @tc.name: operatorfusertest_fuse_003
+ * @tc.desc: Verify nothing is fused into a node whose output is read twice or is an output of the graph, nor into a
+ *           weight shared by another node.
+ * @tc.type: FUNC
+ */
+HWTEST_F(OperatorFuserTest, operatorfusertest_fuse_003, TestSize.Level0)
+{
+    uint32_t input = AddTensor({1, 4, 4, 2});
+    uint32_t weight = AddConstTensor({2, 1, 1, 2}, {1.0f, 2.0f, 3.0f, 4.0f});
+    uint32_t bias = AddConstTensor({2}, {0.0f, 0.0f});
+    uint32_t firstOutput = AddTensor({1, 4, 4, 2});
+    uint32_t reluOutput = AddTensor({1, 4, 4, 2});
+    uint32_t secondBias = AddConstTensor({2}, {0.0f, 0.0f});
+    uint32_t secondOutput = AddTensor({1, 4, 4, 2});
+    uint32_t addend = AddConstTensor({2}, {1.0f, 2.0f});
+    uint32_t addOutput = AddTensor({1, 4, 4, 2});
+    uint32_t thirdOutput = AddTensor({1, 4, 4, 2});
+    uint32_t output = AddTensor({1, 4, 4, 2});
+    m_liteGraph.input_indices_ = {input};
+    m_liteGraph.output_indices_ = {thirdOutput, output};
+    AddNode(CreateConv2D(), {input, weight, bias}, {firstOutput});
+    AddNode(CreateActivation(MSLITE::ACTIVATION_TYPE_RELU), {firstOutput}, {reluOutput});
+    AddNode(CreateConv2D(), {reluOutput, weight, secondBias}, {secondOutput});
+    AddNode(MSLITE::MindIR_BiasAdd_CreatePrimitive(), {secondOutput, addend}, {addOutput});
+    AddNode(CreateConv2D(), {addOutput, weight, bias}, {thirdOutput});
+    AddNode(CreateActivation(MSLITE::ACTIVATION_TYPE_RELU), {thirdOutput}, {output});
+    m_liteGraph.all_nodes_[5]->input_indices_.emplace_back(firstOutput);
+
+    GraphPassSummary summary;
+    std::vector<uint32_t> nodeMap;
+    Optimize(summary, nodeMap);
+    EXPECT_EQ(0, summary.fusedCount);
+    EXPECT_EQ(6, summary.nodeCount);
+    EXPECT_EQ((std::vector<uint32_t> {0, 1, 2, 3, 4, 5}), nodeMap);
+    EXPECT_EQ((std::vector<float> {1.0f, 2.0f, 3.0f, 4.0f}), GetValues<float>(weight));
+}
+/**
+ * @tc.name: operatorfusertest_fuse_004
+ * @tc.desc: Verify a ScaleFusion of an NCHW output is fused only if its axis is the channels, the second dimension.
+ * @tc.type: FUNC
+ */
+HWTEST_F(OperatorFuserTest, operatorfusertest_fuse_004, TestSize.Level0)
+{
+    uint32_t input = AddTensor({1, 2, 4, 4}, MSLITE::DATA_TYPE_FLOAT32, MSLITE::FORMAT_NCHW);
+    uint32_t weight = AddConstTensor({2, 1, 1, 2}, {1.0f, 2.0f, 3.0f, 4.0f});
+    uint32_t convOutput = AddTensor({1, 2, 4, 4}, MSLITE::DATA_TYPE_FLOAT32, MSLITE::FORMAT_NCHW);
+    uint32_t scale = AddConstTensor({2}, {2.0f, 3.0f});
+    uint32_t output = AddTensor({1, 2, 4, 4}, MSLITE::DATA_TYPE_FLOAT32, MSLITE::FORMAT_NCHW);
+    uint32_t secondWeight = AddConstTensor({2, 1, 1, 2}, {1.0f, 2.0f, 3.0f, 4.0f});
+    uint32_t secondConvOutput = AddTensor({1, 2, 4, 4}, MSLITE::DATA_TYPE_FLOAT32, MSLITE::FORMAT_NCHW);
+    uint32_t secondScale = AddConstTensor({2}, {2.0f, 3.0f});
+    uint32_t secondOutput = AddTensor({1, 2, 4, 4}, MSLITE::DATA_TYPE_FLOAT32, MSLITE::FORMAT_NCHW);
+    m_liteGraph.input_indices_ = {input};
+    m_liteGraph.output_indices_ = {output, secondOutput};
+    AddNode(CreateConv2D(), {input, weight}, {convOutput});
+    AddNode(MSLITE::MindIR_ScaleFusion_CreatePrimitive(-1, MSLITE::ACTIVATION_TYPE_NO_ACTIVATION),
+        {convOutput, scale}, {output});
+    AddNode(CreateConv2D(), {input, secondWeight}, {secondConvOutput});
+    AddNode(MSLITE::MindIR_ScaleFusion_CreatePrimitive(1, MSLITE::ACTIVATION_TYPE_NO_ACTIVATION),
+        {secondConvOutput, secondScale}, {secondOutput});
+
+    GraphPassSummary summary;
+    std::vector<uint32_t> nodeMap;
+    Optimize(summary, nodeMap);
+    EXPECT_EQ(1, summary.fusedCount);
+    EXPECT_EQ((std::vector<uint32_t> {0, 1, 2, 2}), nodeMap);
+
+    ASSERT_EQ(3, m_liteGraph.all_nodes_.size());
+    EXPECT_EQ((std::vector<float> {1.0f, 2.0f, 3.0f, 4.0f}), GetValues<float>(weight));
+    const auto* conv = m_liteGraph.all_nodes_[2];
+    ASSERT_EQ(3, conv->input_indices_.size());
+    EXPECT_EQ((std::vector<float> {2.0f, 4.0f, 9.0f, 12.0f}), GetValues<float>(conv->input_indices_[1]));
+    EXPECT_EQ((std::vector<float> {0.0f, 0.0f}), GetValues<float>(conv->input_indices_[2]));
+    EXPECT_EQ(m_liteGraph.output_indices_[1], conv->output_indices_[0]);
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
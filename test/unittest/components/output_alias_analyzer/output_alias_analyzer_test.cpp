@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "output_alias_analyzer.h"
+#include "test/unittest/common/lite_graph_test.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class OutputAliasAnalyzerTest : public LiteGraphTest {
+protected:
+    void* CreateRelu()
+    {
+        return CreateActivation(mindspore::lite::ACTIVATION_TYPE_RELU);
+    }
+
+    void* CreateAdd()
+    {
+        return mindspore::lite::MindIR_AddFusion_CreatePrimitive(mindspore::lite::ACTIVATION_TYPE_NO_ACTIVATION);
+    }
+
+    void* CreateSoftmax()
+    {
+        return mindspore::lite::MindIR_Softmax_CreatePrimitive({-1});
+    }
+};
+
+/**
+ * @tc.name: outputaliasanalyzertest_analyze_001
+ * @tc.desc: Verify the output of an elementwise tail may alias the input which is only read before it is written.
+ * @tc.type: FUNC
+ */
+HWTEST_F(OutputAliasAnalyzerTest, outputaliasanalyzertest_analyze_001, TestSize.Level0)
+{
+    // input -> softmax -> hidden, output = add(input, hidden): the residual input is read by the add itself.
+    uint32_t input = AddTensor({1, 64});
+    uint32_t hidden = AddTensor({1, 64});
+    uint32_t output = AddTensor({1, 64});
+    AddNode(CreateSoftmax(), {input}, {hidden});
+    AddNode(CreateAdd(), {input, hidden}, {output});
+    m_liteGraph.input_indices_ = {input};
+    m_liteGraph.output_indices_ = {output};
+
+    OutputAliasAnalyzer analyzer;
+    std::vector<std::vector<uint32_t>> aliasableInputs;
+    EXPECT_EQ(OH_NN_SUCCESS, analyzer.Analyze(&m_liteGraph, aliasableInputs));
+    ASSERT_EQ(1u, aliasableInputs.size());
+    EXPECT_EQ(std::vector<uint32_t>({0}), aliasableInputs[0]);
+}
+
+/**
+ * @tc.name: outputaliasanalyzertest_analyze_002
+ * @tc.desc: Verify the outputs do not alias an input which is broadcast, read later, or not written elementwise.
+ * @tc.type: FUNC
+ */
+HWTEST_F(OutputAliasAnalyzerTest, outputaliasanalyzertest_analyze_002, TestSize.Level0)
+{
+    uint32_t input = AddTensor({1, 64});
+    uint32_t bias = AddTensor({1, 1});
+    uint32_t dynamic = AddTensor({-1, 64});
+    uint32_t relu = AddTensor({1, 64});
+    uint32_t softmax = AddTensor({1, 64});
+    uint32_t add = AddTensor({1, 64});
+    uint32_t dynamicRelu = AddTensor({-1, 64});
+    // relu is written while the softmax of another branch may still read the input.
+    AddNode(CreateRelu(), {input}, {relu});
+    AddNode(CreateSoftmax(), {input}, {softmax});
+    // The bias is broadcast over the output.
+    AddNode(CreateAdd(), {relu, bias}, {add});
+    AddNode(CreateRelu(), {dynamic}, {dynamicRelu});
+    m_liteGraph.input_indices_ = {input, bias, dynamic};
+    m_liteGraph.output_indices_ = {relu, softmax, add, dynamicRelu};
+
+    OutputAliasAnalyzer analyzer;
+    std::vector<std::vector<uint32_t>> aliasableInputs;
+    EXPECT_EQ(OH_NN_SUCCESS, analyzer.Analyze(&m_liteGraph, aliasableInputs));
+    ASSERT_EQ(4u, aliasableInputs.size());
+    for (const auto& inputs : aliasableInputs) {
+        EXPECT_TRUE(inputs.empty());
+    }
+
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, analyzer.Analyze(nullptr, aliasableInputs));
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
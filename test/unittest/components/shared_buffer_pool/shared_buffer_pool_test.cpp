@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "shared_buffer_pool.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class SharedBufferPoolTest : public testing::Test {
+public:
+    SharedBufferPoolTest() = default;
+    ~SharedBufferPoolTest() = default;
+
+protected:
+    int m_lastFd {0};
+    std::vector<size_t> m_allocatedLengths;
+    std::vector<int> m_releasedFds;
+};
+
+/**
+ * @tc.name: sharedbufferpooltest_getclasssize_001
+ * @tc.desc: Verify the GetClassSize function rounds up to a page and to a quarter of the power of two.
+ * @tc.type: FUNC
+ */
+HWTEST_F(SharedBufferPoolTest, sharedbufferpooltest_getclasssize_001, TestSize.Level0)
+{
+    EXPECT_EQ(4096, SharedBufferPool::GetClassSize(1));
+    EXPECT_EQ(4096, SharedBufferPool::GetClassSize(4096));
+    EXPECT_EQ(8192, SharedBufferPool::GetClassSize(4097));
+    EXPECT_EQ(20480, SharedBufferPool::GetClassSize(20000));
+    EXPECT_EQ(1310720, SharedBufferPool::GetClassSize(1048577));
+    EXPECT_EQ(1310720, SharedBufferPool::GetClassSize(1310720));
+}
+
+/**
+ * @tc.name: sharedbufferpooltest_allocate_001
+ * @tc.desc: Verify the released buffer is reused by the next allocation of the same size class.
+ * @tc.type: FUNC
+ */
+HWTEST_F(SharedBufferPoolTest, sharedbufferpooltest_allocate_001, TestSize.Level0)
+{
+    SharedBufferPool pool(
+        [this](size_t length, int& fd) {
+            m_allocatedLengths.emplace_back(length);
+            fd = ++m_lastFd;
+            return OH_NN_SUCCESS;
+        },
+        [this](int fd, size_t length) {
+            m_releasedFds.emplace_back(fd);
+            return OH_NN_SUCCESS;
+        });
+
+    int fd = -1;
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Allocate(5000, fd));
+    EXPECT_EQ(1, fd);
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Release(fd, 5000));
+    EXPECT_TRUE(m_releasedFds.empty());
+
+    int reusedFd = -1;
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Allocate(6000, reusedFd));
+    EXPECT_EQ(fd, reusedFd);
+    ASSERT_EQ(1, m_allocatedLengths.size());
+    EXPECT_EQ(8192, m_allocatedLengths[0]);
+
+    OH_NN_BufferPoolStatistics statistics;
+    pool.GetStatistics(statistics);
+    EXPECT_EQ(1, statistics.hitCount);
+    EXPECT_EQ(1, statistics.missCount);
+    EXPECT_EQ(0, statistics.cachedBytes);
+}
+
+/**
+ * @tc.name: sharedbufferpooltest_trim_001
+ * @tc.desc: Verify the least recently released buffers are released to the device above the high-water mark.
+ * @tc.type: FUNC
+ */
+HWTEST_F(SharedBufferPoolTest, sharedbufferpooltest_trim_001, TestSize.Level0)
+{
+    SharedBufferPool pool(
+        [this](size_t length, int& fd) {
+            fd = ++m_lastFd;
+            return OH_NN_SUCCESS;
+        },
+        [this](int fd, size_t length) {
+            m_releasedFds.emplace_back(fd);
+            return OH_NN_SUCCESS;
+        });
+    pool.SetHighWaterMark(8192);
+
+    int fd1 = -1;
+    int fd2 = -1;
+    int fd3 = -1;
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Allocate(4096, fd1));
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Allocate(4096, fd2));
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Allocate(4096, fd3));
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Release(fd1, 4096));
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Release(fd2, 4096));
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Release(fd3, 4096));
+    ASSERT_EQ(1, m_releasedFds.size());
+    EXPECT_EQ(fd1, m_releasedFds[0]);
+
+    OH_NN_BufferPoolStatistics statistics;
+    pool.GetStatistics(statistics);
+    EXPECT_EQ(8192, statistics.cachedBytes);
+    EXPECT_EQ(1, statistics.trimCount);
+
+    // Larger than the high-water mark, it is allocated with the exact length and never cached.
+    int largeFd = -1;
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Allocate(10000, largeFd));
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Release(largeFd, 10000));
+    EXPECT_EQ(largeFd, m_releasedFds.back());
+
+    pool.SetHighWaterMark(0);
+    EXPECT_EQ(4, m_releasedFds.size());
+    pool.GetStatistics(statistics);
+    EXPECT_EQ(0, statistics.cachedBytes);
+}
+/**
+ * @tc.name: sharedbufferpooltest_allocatemapped_001
+ * @tc.desc: Verify the reused buffer keeps its mapping, and the buffer too large to be pooled is released at once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(SharedBufferPoolTest, sharedbufferpooltest_allocatemapped_001, TestSize.Level0)
+{
+    SharedBufferPool pool(
+        [this](size_t length, int& fd) {
+            fd = memfd_create("shared_buffer_pool_test", 0);
+            if (fd < 0 || ftruncate(fd, length) != 0) {
+                return OH_NN_MEMORY_ERROR;
+            }
+            m_allocatedLengths.emplace_back(length);
+            return OH_NN_SUCCESS;
+        },
+        [this](int fd, size_t length) {
+            close(fd);
+            m_releasedFds.emplace_back(fd);
+            return OH_NN_SUCCESS;
+        });
+    pool.SetHighWaterMark(8192);
+
+    int fd = -1;
+    void* data = nullptr;
+    ASSERT_EQ(OH_NN_SUCCESS, pool.AllocateMapped(5000, fd, data));
+    ASSERT_NE(nullptr, data);
+    static_cast<char*>(data)[0] = 'a';
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Release(fd, 5000));
+
+    int reusedFd = -1;
+    void* reusedData = nullptr;
+    EXPECT_EQ(OH_NN_SUCCESS, pool.AllocateMapped(6000, reusedFd, reusedData));
+    EXPECT_EQ(fd, reusedFd);
+    EXPECT_EQ(data, reusedData);
+    EXPECT_EQ('a', static_cast<char*>(reusedData)[0]);
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Release(reusedFd, 6000));
+    EXPECT_TRUE(m_releasedFds.empty());
+
+    int largeFd = -1;
+    void* largeData = nullptr;
+    EXPECT_EQ(OH_NN_SUCCESS, pool.AllocateMapped(10000, largeFd, largeData));
+    EXPECT_NE(nullptr, largeData);
+    EXPECT_EQ(OH_NN_SUCCESS, pool.Release(largeFd, 10000));
+    ASSERT_EQ(1, m_releasedFds.size());
+    EXPECT_EQ(largeFd, m_releasedFds[0]);
+    ASSERT_EQ(2, m_allocatedLengths.size());
+    EXPECT_EQ(10000, m_allocatedLengths[1]);
+
+    pool.SetHighWaterMark(0);
+    ASSERT_EQ(2, m_releasedFds.size());
+    EXPECT_EQ(fd, m_releasedFds[1]);
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
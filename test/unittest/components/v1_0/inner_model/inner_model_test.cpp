@@ -22,6 +22,7 @@
 #include "inner_model.h"
 
 #include <sys/mman.h>
+#include <unistd.h>
 
 #include "lite_graph_to_hdi_model_v2_1.h"
 #include "device.h"
@@ -3157,6 +3158,88 @@ HWTEST_F(LiteGraphToHDIModelTest, litegraphtohdimodeltest_litegraph_to_hdimodel_
     EXPECT_EQ(MAP_FAILED, mmapPtr);
 }
 
+constexpr int32_t LARGE_WEIGHT_ELEMENT_NUM = 1024 * 1024;
+constexpr uint32_t LARGE_WEIGHT_NUM = 5;
+constexpr size_t LARGE_WEIGHT_SIZE = LARGE_WEIGHT_ELEMENT_NUM * sizeof(float);
+
+// A node adding weights of 20 MB to the input, the weights are converted in parallel. Every byte of weight i is i.
+std::shared_ptr<MSLITE::LiteGraph> CreateLargeWeightGraph(const std::vector<int32_t>& firstWeightDims)
+{
+    std::shared_ptr<MSLITE::LiteGraph> liteGraph = std::make_shared<MSLITE::LiteGraph>();
+    std::vector<int32_t> dims {LARGE_WEIGHT_ELEMENT_NUM};
+    liteGraph->all_tensors_.emplace_back(MSLITE::MindIR_Tensor_Create("input", MSLITE::DATA_TYPE_FLOAT32, dims,
+        MSLITE::FORMAT_NCHW, {}, {}));
+    MSLITE::LiteGraph::Node* node =
+        getNode(MSLITE::MindIR_AddFusion_CreatePrimitive(MSLITE::ACTIVATION_TYPE_NO_ACTIVATION));
+    node->input_indices_ = {0};
+    for (uint32_t i = 1; i <= LARGE_WEIGHT_NUM; ++i) {
+        std::vector<uint8_t> weight(LARGE_WEIGHT_SIZE, static_cast<uint8_t>(i));
+        liteGraph->all_tensors_.emplace_back(MSLITE::MindIR_Tensor_Create("weight", MSLITE::DATA_TYPE_FLOAT32,
+            (i == 1) ? firstWeightDims : dims, MSLITE::FORMAT_NCHW, weight, {}));
+        node->input_indices_.emplace_back(i);
+    }
+    liteGraph->all_tensors_.emplace_back(MSLITE::MindIR_Tensor_Create("output", MSLITE::DATA_TYPE_FLOAT32, dims,
+        MSLITE::FORMAT_NCHW, {}, {}));
+    node->output_indices_ = {LARGE_WEIGHT_NUM + 1};
+    liteGraph->all_nodes_.emplace_back(node);
+    liteGraph->input_indices_ = {0};
+    liteGraph->output_indices_ = {LARGE_WEIGHT_NUM + 1};
+    return liteGraph;
+}
+
+// The weights have to be laid out one after another, in the order of the tensors.
+void CheckLargeWeightConversion(const MSLITE::LiteGraph* liteGraph)
+{
+    int fd = memfd_create("largeWeights", 0);
+    ASSERT_NE(-1, fd);
+    ASSERT_EQ(0, ftruncate(fd, LARGE_WEIGHT_NUM * LARGE_WEIGHT_SIZE));
+    OHOS::HDI::Nnrt::V2_1::SharedBuffer tensorBuffer {fd, LARGE_WEIGHT_NUM * LARGE_WEIGHT_SIZE, 0,
+        LARGE_WEIGHT_NUM * LARGE_WEIGHT_SIZE};
+    OHOS::HDI::Nnrt::V2_1::Model* model = LiteGraph_To_HDIModel(liteGraph, tensorBuffer);
+    ASSERT_NE(nullptr, model);
+    ASSERT_EQ(LARGE_WEIGHT_NUM + 2, model->allTensors.size());
+    EXPECT_EQ(-1, model->allTensors[0].data.fd);
+    EXPECT_EQ(-1, model->allTensors[LARGE_WEIGHT_NUM + 1].data.fd);
+
+    uint8_t* mmapPtr = static_cast<uint8_t*>(mmap(nullptr, tensorBuffer.bufferSize, PROT_READ, MAP_SHARED, fd, 0));
+    ASSERT_NE(MAP_FAILED, mmapPtr);
+    for (uint32_t i = 1; i <= LARGE_WEIGHT_NUM; ++i) {
+        const auto& data = model->allTensors[i].data;
+        EXPECT_EQ(fd, data.fd);
+        EXPECT_EQ((i - 1) * LARGE_WEIGHT_SIZE, data.offset);
+        EXPECT_EQ(LARGE_WEIGHT_SIZE, data.dataSize);
+        EXPECT_EQ(i, mmapPtr[data.offset]);
+        EXPECT_EQ(i, mmapPtr[data.offset + data.dataSize - 1]);
+    }
+    munmap(mmapPtr, tensorBuffer.bufferSize);
+    HDIModel_Destroy(&model);
+    close(fd);
+}
+
+/**
+ * @tc.name: litegraphtohdimodeltest_litegraph_to_hdimodel_109
+ * @tc.desc: Verify the large weights copied in parallel are laid out like the sequential copy does.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LiteGraphToHDIModelTest, litegraphtohdimodeltest_litegraph_to_hdimodel_109, TestSize.Level0)
+{
+    LOGE("LiteGraph_To_HDIModel litegraphtohdimodeltest_litegraph_to_hdimodel_109");
+    std::shared_ptr<MSLITE::LiteGraph> liteGraph = CreateLargeWeightGraph({LARGE_WEIGHT_ELEMENT_NUM});
+    CheckLargeWeightConversion(liteGraph.get());
+}
+
+/**
+ * @tc.name: litegraphtohdimodeltest_litegraph_to_hdimodel_110
+ * @tc.desc: Verify the weights are copied sequentially if a weight does not match its shape.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LiteGraphToHDIModelTest, litegraphtohdimodeltest_litegraph_to_hdimodel_110, TestSize.Level0)
+{
+    LOGE("LiteGraph_To_HDIModel litegraphtohdimodeltest_litegraph_to_hdimodel_110");
+    std::shared_ptr<MSLITE::LiteGraph> liteGraph = CreateLargeWeightGraph({1});
+    CheckLargeWeightConversion(liteGraph.get());
+}
+
 /**
  * @tc.name: litegraphtohdimodeltest_hdimodel_destroy_001
  * @tc.desc: Verify the QuantParams function return nullptr in case of fd -1.
@@ -22,10 +22,13 @@
 #include "inner_model.h"
 
 #include <sys/mman.h>
+#include <unistd.h>
 
 #include "lite_graph_to_hdi_model_v2_0.h"
+#include "backend_manager.h"
 #include "device.h"
 #include "neural_network_runtime/neural_network_runtime_type.h"
+#include "neural_network_runtime_inner.h"
 #include "nnbackend.h"
 #include "ops_registry.h"
 #include "transform.h"
@@ -43,6 +46,7 @@ public:
     void SetLiteGraph(mindspore::lite::LiteGraph* liteGraph);
     void SetTensors();
     void SetIndices();
+    void AddDeadOperation();
 
 public:
     InnerModel m_innerModelTest;
@@ -107,6 +111,87 @@ void InnerModelTest::SetIndices()
     m_outputs.size = sizeof(m_outputIndexs) / sizeof(uint32_t);
 }
 
+// Adds a second Add of the same inputs to the model of SetTensors(), its output is not an output of the model.
+void InnerModelTest::AddDeadOperation()
+{
+    const int dim[2] = {2, 2};
+    const OH_NN_Tensor& tensor = {OH_NN_FLOAT32, 2, dim, nullptr, OH_NN_TENSOR};
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.AddTensor(tensor));
+    const OH_NN_Tensor& tensorParam = {OH_NN_INT8, 0, nullptr, nullptr, OH_NN_ADD_ACTIVATIONTYPE};
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.AddTensor(tensorParam));
+
+    uint32_t paramIndex = 5;
+    const int8_t activation = 0;
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.SetTensorValue(paramIndex,
+        static_cast<const void *>(&activation), sizeof(int8_t)));
+    uint32_t outputIndex = 4;
+    OH_NN_UInt32Array params {&paramIndex, 1};
+    OH_NN_UInt32Array outputs {&outputIndex, 1};
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.AddOperation(m_opType, params, m_inputs, outputs));
+}
+
+class MockPassDevice : public Device {
+public:
+    MOCK_METHOD1(GetDeviceName, OH_NN_ReturnCode(std::string&));
+    MOCK_METHOD1(GetVendorName, OH_NN_ReturnCode(std::string&));
+    MOCK_METHOD1(GetVersion, OH_NN_ReturnCode(std::string&));
+    MOCK_METHOD1(GetDeviceType, OH_NN_ReturnCode(OH_NN_DeviceType&));
+    MOCK_METHOD1(GetDeviceStatus, OH_NN_ReturnCode(DeviceStatus&));
+    MOCK_METHOD2(GetSupportedOperation, OH_NN_ReturnCode(std::shared_ptr<const mindspore::lite::LiteGraph>,
+        std::vector<bool>&));
+    MOCK_METHOD1(IsFloat16PrecisionSupported, OH_NN_ReturnCode(bool&));
+    MOCK_METHOD1(IsPerformanceModeSupported, OH_NN_ReturnCode(bool&));
+    MOCK_METHOD1(IsPrioritySupported, OH_NN_ReturnCode(bool&));
+    MOCK_METHOD1(IsDynamicInputSupported, OH_NN_ReturnCode(bool&));
+    MOCK_METHOD1(IsModelCacheSupported, OH_NN_ReturnCode(bool&));
+    MOCK_METHOD3(PrepareModel, OH_NN_ReturnCode(std::shared_ptr<const mindspore::lite::LiteGraph>,
+                                          const ModelConfig&,
+                                          std::shared_ptr<PreparedModel>&));
+    MOCK_METHOD3(PrepareModel, OH_NN_ReturnCode(const void*,
+                                          const ModelConfig&,
+                                          std::shared_ptr<PreparedModel>&));
+    MOCK_METHOD4(PrepareModelFromModelCache, OH_NN_ReturnCode(const std::vector<Buffer>&,
+                                                        const ModelConfig&,
+                                                        std::shared_ptr<PreparedModel>&,
+                                                        bool&));
+    MOCK_METHOD3(PrepareOfflineModel, OH_NN_ReturnCode(std::shared_ptr<const mindspore::lite::LiteGraph>,
+                                                 const ModelConfig&,
+                                                 std::shared_ptr<PreparedModel>&));
+    MOCK_METHOD1(AllocateBuffer, void*(size_t));
+    MOCK_METHOD2(AllocateTensorBuffer, void*(size_t, std::shared_ptr<TensorDesc>));
+    MOCK_METHOD2(AllocateTensorBuffer, void*(size_t, std::shared_ptr<NNTensor>));
+    MOCK_METHOD1(ReleaseBuffer, OH_NN_ReturnCode(const void*));
+    MOCK_METHOD2(AllocateBuffer, OH_NN_ReturnCode(size_t, int&));
+    MOCK_METHOD2(ReleaseBuffer, OH_NN_ReturnCode(int, size_t));
+    MOCK_METHOD1(ReadOpVersion, OH_NN_ReturnCode(int&));
+};
+
+const size_t PASS_BACKEND_ID = 20;
+
+// The device supports none of the nodes it is given, and records how many it is given.
+std::shared_ptr<Backend> CreatePassBackend(size_t& deviceNodeCount)
+{
+    std::shared_ptr<MockPassDevice> device = std::make_shared<MockPassDevice>();
+    EXPECT_CALL(*device, GetDeviceStatus(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(AVAILABLE), ::testing::Return(OH_NN_SUCCESS)));
+    std::string backendName = "pass";
+    EXPECT_CALL(*device, GetDeviceName(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(backendName), ::testing::Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*device, GetVendorName(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(backendName), ::testing::Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*device, GetVersion(::testing::_))
+        .WillRepeatedly(::testing::DoAll(::testing::SetArgReferee<0>(backendName), ::testing::Return(OH_NN_SUCCESS)));
+    EXPECT_CALL(*device, GetSupportedOperation(::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Invoke([&deviceNodeCount](std::shared_ptr<const mindspore::lite::LiteGraph> model,
+            std::vector<bool>& supportedOperations) {
+                deviceNodeCount = model->all_nodes_.size();
+                supportedOperations.assign(deviceNodeCount, false);
+                return OH_NN_SUCCESS;
+            }));
+    testing::Mock::AllowLeak(device.get());
+    return std::make_shared<NNBackend>(device, PASS_BACKEND_ID);
+}
+
 /**
  * @tc.name: inner_model_construct_nntensor_from_litegraph_001
  * @tc.desc: Verify the input_indices is empty of the construct_nntensor_from_litegraph function
@@ -443,6 +528,48 @@ HWTEST_F(InnerModelTest, inner_model_set_tensor_value_007, TestSize.Level1)
        x, sizeof(x)- 1));
 }
 
+/**
+ * @tc.name: inner_model_borrow_tensor_value_001
+ * @tc.desc: Verify the buffer is borrowed without a copy by the borrow_tensor_value function
+ * @tc.type: FUNC
+ */
+HWTEST_F(InnerModelTest, inner_model_borrow_tensor_value_001, TestSize.Level1)
+{
+    SetTensors();
+
+    uint32_t index = 3;
+    const int8_t activation = 0;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, m_innerModelTest.BorrowTensorValue(index, nullptr, sizeof(int8_t)));
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.BorrowTensorValue(index,
+       static_cast<const void *>(&activation), sizeof(int8_t)));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, m_innerModelTest.SetTensorValue(index,
+       static_cast<const void *>(&activation), sizeof(int8_t)));
+}
+
+/**
+ * @tc.name: inner_model_set_tensor_value_from_fd_001
+ * @tc.desc: Verify the value is mapped from an unaligned range of a file by the set_tensor_value_from_fd function
+ * @tc.type: FUNC
+ */
+HWTEST_F(InnerModelTest, inner_model_set_tensor_value_from_fd_001, TestSize.Level1)
+{
+    SetTensors();
+
+    int fd = memfd_create("inner_model_test", 0);
+    ASSERT_GE(fd, 0);
+    const int8_t activation[2] = {0, 0};
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(activation)), write(fd, activation, sizeof(activation)));
+
+    uint32_t index = 3;
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, m_innerModelTest.SetTensorValueFromFd(index, fd, sizeof(activation),
+        sizeof(int8_t)));
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.SetTensorValueFromFd(index, fd, 1, sizeof(int8_t)));
+    close(fd);
+
+    SetIndices();
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.AddOperation(m_opType, m_params, m_inputs, m_outputs));
+}
+
 /**
  * @tc.name: inner_model_add_operation_001
  * @tc.desc: Verify the success of the addoperation function
@@ -888,6 +1015,107 @@ HWTEST_F(InnerModelTest, inner_model_get_supported_operation_004, TestSize.Level
 
     EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, m_innerModelTest.GetSupportedOperations(deviceID, &isSupported, opCount));
 }
+
+/**
+ * @tc.name: inner_model_graph_pass_001
+ * @tc.desc: Verify the summary of the graph passes run by Build, and that GetSupportedOperations still reports one
+ *           result for each operation added by the user, the removed ones as supported.
+ * @tc.type: FUNC
+ */
+HWTEST_F(InnerModelTest, inner_model_graph_pass_001, TestSize.Level1)
+{
+    SetIndices();
+    SetTensors();
+    uint32_t index = 3;
+    const int8_t activation = 0;
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.SetTensorValue(index,
+        static_cast<const void *>(&activation), sizeof(int8_t)));
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.AddOperation(m_opType, m_params, m_inputs, m_outputs));
+    AddDeadOperation();
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.SpecifyInputsAndOutputs(m_inputs, m_outputs));
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.Build());
+
+    OH_NN_GraphPassSummary summary;
+    OH_NNModel* model = reinterpret_cast<OH_NNModel*>(&m_innerModelTest);
+    EXPECT_EQ(OH_NN_SUCCESS, OH_NNModel_GetGraphPassSummary(model, &summary));
+    EXPECT_EQ(2, summary.originalNodeCount);
+    EXPECT_EQ(1, summary.nodeCount);
+    EXPECT_EQ(1, summary.eliminatedCount);
+    EXPECT_EQ(0, summary.foldedCount);
+    EXPECT_EQ(1, summary.removedTensorCount);
+    EXPECT_EQ(1, m_innerModelTest.GetLiteGraphs()->all_nodes_.size());
+
+    size_t deviceNodeCount {0};
+    BackendManager& backendManager = BackendManager::GetInstance();
+    EXPECT_EQ(OH_NN_SUCCESS, backendManager.RegisterBackend("pass",
+        [&deviceNodeCount]() { return CreatePassBackend(deviceNodeCount); }));
+    const bool *isSupported = nullptr;
+    uint32_t opCount {0};
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.GetSupportedOperations(PASS_BACKEND_ID, &isSupported, opCount));
+    backendManager.RemoveBackend("pass");
+    EXPECT_EQ(1, deviceNodeCount);
+    ASSERT_EQ(2, opCount);
+    EXPECT_FALSE(isSupported[0]);
+    EXPECT_TRUE(isSupported[1]);
+}
+/**
+ * @tc.name: inner_model_graph_pass_002
+ * @tc.desc: Verify the graph passes left out by SetGraphPasses do not run, the dead operation is sent to the device.
+ * @tc.type: FUNC
+ */
+HWTEST_F(InnerModelTest, inner_model_graph_pass_002, TestSize.Level1)
+{
+    SetIndices();
+    SetTensors();
+    uint32_t index = 3;
+    const int8_t activation = 0;
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.SetTensorValue(index,
+        static_cast<const void *>(&activation), sizeof(int8_t)));
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.AddOperation(m_opType, m_params, m_inputs, m_outputs));
+    AddDeadOperation();
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.SpecifyInputsAndOutputs(m_inputs, m_outputs));
+    OH_NNModel* model = reinterpret_cast<OH_NNModel*>(&m_innerModelTest);
+    EXPECT_EQ(OH_NN_SUCCESS, OH_NNModel_SetGraphPasses(model,
+        OH_NN_GRAPH_PASS_CONSTANT_FOLDING | OH_NN_GRAPH_PASS_OPERATOR_FUSION));
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.Build());
+
+    OH_NN_GraphPassSummary summary;
+    EXPECT_EQ(OH_NN_SUCCESS, OH_NNModel_GetGraphPassSummary(model, &summary));
+    EXPECT_EQ(2, summary.originalNodeCount);
+    EXPECT_EQ(2, summary.nodeCount);
+    EXPECT_EQ(0, summary.eliminatedCount);
+    EXPECT_EQ(0, summary.mergedCount);
+    EXPECT_EQ(2, m_innerModelTest.GetLiteGraphs()->all_nodes_.size());
+}
+
+/**
+ * @tc.name: inner_model_graph_pass_003
+ * @tc.desc: Verify SetGraphPasses refuses an unknown pass, and is refused once the model is built.
+ * @tc.type: FUNC
+ */
+HWTEST_F(InnerModelTest, inner_model_graph_pass_003, TestSize.Level1)
+{
+    SetIndices();
+    SetTensors();
+    uint32_t index = 3;
+    const int8_t activation = 0;
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.SetTensorValue(index,
+        static_cast<const void *>(&activation), sizeof(int8_t)));
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.AddOperation(m_opType, m_params, m_inputs, m_outputs));
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.SpecifyInputsAndOutputs(m_inputs, m_outputs));
+    OH_NNModel* model = reinterpret_cast<OH_NNModel*>(&m_innerModelTest);
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, OH_NNModel_SetGraphPasses(model, OH_NN_GRAPH_PASS_ALL + 1));
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, OH_NNModel_SetGraphPasses(nullptr, OH_NN_GRAPH_PASS_NONE));
+    EXPECT_EQ(OH_NN_SUCCESS, OH_NNModel_SetGraphPasses(model, OH_NN_GRAPH_PASS_NONE));
+    EXPECT_EQ(OH_NN_SUCCESS, m_innerModelTest.Build());
+
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, OH_NNModel_SetGraphPasses(model, OH_NN_GRAPH_PASS_ALL));
+    EXPECT_EQ(OH_NN_OPERATION_FORBIDDEN, m_innerModelTest.SetGraphPasses(OH_NN_GRAPH_PASS_NONE));
+    OH_NN_GraphPassSummary summary;
+    EXPECT_EQ(OH_NN_SUCCESS, OH_NNModel_GetGraphPassSummary(model, &summary));
+    EXPECT_EQ(1, summary.nodeCount);
+    EXPECT_EQ(0, summary.removedTensorCount);
+}
 } // namespace UnitTest
 } // namespace NNRT
 
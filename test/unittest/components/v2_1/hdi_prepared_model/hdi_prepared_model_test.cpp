@@ -17,6 +17,8 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 
+#include <chrono>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -25,6 +27,7 @@
 #include "memory_manager.h"
 #include "transform.h"
 #include "test/unittest/common/v2_1/mock_idevice.h"
+#include "test/unittest/common/allocation_counter.h"
 #include "test/unittest/common/file_utils.h"
 #include "tensor.h"
 #include "nntensor.h"
@@ -32,6 +35,7 @@
 using namespace testing;
 using namespace testing::ext;
 using namespace OHOS::NeuralNetworkRuntime;
+
 namespace OHOS {
 namespace NeuralNetworkRuntime {
 namespace UnitTest {
@@ -43,6 +47,36 @@ protected:
     OH_NN_ReturnCode RunFail(std::vector<IOTensor>& inputs);
 };
 
+// A device prepared model without gmock bookkeeping, so that the allocations counted are the ones of NNRt.
+class FakeIPreparedModel : public V2_1::IPreparedModel {
+public:
+    int32_t ExportModelCache(std::vector<V2_1::SharedBuffer>& modelCache) override
+    {
+        return V2_1::NNRT_ReturnCode::NNRT_SUCCESS;
+    }
+
+    int32_t Run(const std::vector<V2_1::IOTensor>& inputs, const std::vector<V2_1::IOTensor>& outputs,
+        std::vector<std::vector<int32_t>>& outputsDims) override
+    {
+        outputsDims.resize(outputs.size());
+        for (size_t i = 0; i < outputs.size(); ++i) {
+            outputsDims[i].assign(outputs[i].dimensions.begin(), outputs[i].dimensions.end());
+        }
+        return V2_1::NNRT_ReturnCode::NNRT_SUCCESS;
+    }
+
+    int32_t GetInputDimRanges(std::vector<std::vector<uint32_t>>& minInputDims,
+        std::vector<std::vector<uint32_t>>& maxInputDims) override
+    {
+        return V2_1::NNRT_ReturnCode::NNRT_SUCCESS;
+    }
+
+    int32_t GetVersion(uint32_t& majorVer, uint32_t& minorVer) override
+    {
+        return V2_1::NNRT_ReturnCode::NNRT_SUCCESS;
+    }
+};
+
 class MockTensor : public Tensor {
 public:
     MOCK_METHOD1(SetTensorDesc, OH_NN_ReturnCode(const TensorDesc*));
@@ -766,6 +800,81 @@ HWTEST_F(HDIPreparedModelTest, hidpreparedmodel_run_022, TestSize.Level0)
     EXPECT_EQ(OH_NN_UNAVAILABLE_DEVICE, ret);
 }
 
+/**
+ * @tc.name: hidpreparedmodel_run_023
+ * @tc.desc: Verify the Run function does not allocate once the IOTensors are bound, and report the cost of a run.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HDIPreparedModelTest, hidpreparedmodel_run_023, TestSize.Level0)
+{
+    LOGE("Run hidpreparedmodel_run_023");
+    const size_t tensorNum = 4;
+    const size_t runTimes = 1000;
+    const int32_t tensorFd = 1;
+    const size_t tensorSize = 36;
+    float dataArray[tensorNum][9] {};
+    int32_t shape[2] = {3, 3};
+
+    TensorDesc tensorDesc;
+    tensorDesc.SetName("tensor_with_a_name_longer_than_the_small_string_buffer");
+    tensorDesc.SetDataType(OH_NN_FLOAT32);
+    tensorDesc.SetFormat(OH_NN_FORMAT_NCHW);
+    tensorDesc.SetShape(shape, 2);
+
+    size_t backendId = 1;
+    std::vector<NNTensor2_0*> nnTensors;
+    std::vector<NN_Tensor*> inputs;
+    std::vector<NN_Tensor*> outputs;
+    for (size_t i = 0; i < tensorNum; ++i) {
+        NNTensor2_0* nnTensor = new (std::nothrow) NNTensor2_0(backendId);
+        ASSERT_NE(nullptr, nnTensor);
+        EXPECT_EQ(OH_NN_SUCCESS, nnTensor->SetTensorDesc(&tensorDesc));
+        nnTensor->SetData(dataArray[i]);
+        nnTensor->SetFd(tensorFd);
+        nnTensor->SetSize(tensorSize);
+        nnTensor->SetOffset(0);
+        nnTensors.emplace_back(nnTensor);
+        if (i < tensorNum / 2) {
+            inputs.emplace_back(reinterpret_cast<NN_Tensor*>(nnTensor));
+        } else {
+            outputs.emplace_back(reinterpret_cast<NN_Tensor*>(nnTensor));
+        }
+    }
+
+    OHOS::sptr<V2_1::IPreparedModel> sp = OHOS::sptr<FakeIPreparedModel>(new (std::nothrow) FakeIPreparedModel());
+    EXPECT_NE(sp, nullptr);
+    std::unique_ptr<HDIPreparedModelV2_1> preparedModel = std::make_unique<HDIPreparedModelV2_1>(sp);
+
+    // The first run binds the IOTensors, the following runs only patch them.
+    std::vector<std::vector<int32_t>> outputsDims;
+    std::vector<bool> isOutputBufferEnough;
+    EXPECT_EQ(OH_NN_SUCCESS, preparedModel->Run(inputs, outputs, outputsDims, isOutputBufferEnough));
+
+    OH_NN_ReturnCode ret = OH_NN_SUCCESS;
+    size_t allocationCount = 0;
+    auto start = std::chrono::steady_clock::now();
+    {
+        ScopedAllocationCounter allocationCounter;
+        for (size_t i = 0; i < runTimes && ret == OH_NN_SUCCESS; ++i) {
+            ret = preparedModel->Run(inputs, outputs, outputsDims, isOutputBufferEnough);
+        }
+        allocationCount = allocationCounter.GetCount();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(OH_NN_SUCCESS, ret);
+    EXPECT_EQ(0, allocationCount);
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    LOGI("hidpreparedmodel_run_023: %{public}zu runs, %{public}lld ns per run, %{public}zu allocations.",
+        runTimes, static_cast<long long>(costNs / static_cast<int64_t>(runTimes)), allocationCount);
+
+    for (NNTensor2_0* nnTensor : nnTensors) {
+        // The data is owned by the test, do not let the tensor unmap it.
+        nnTensor->SetData(nullptr);
+        delete nnTensor;
+    }
+}
+
 /**
  * @tc.name: hidpreparedmodel_getmodelid_001
  * @tc.desc: Verify the Run function return invalid parameter in case of output invalid.
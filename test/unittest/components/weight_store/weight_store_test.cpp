@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "weight_store.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::NeuralNetworkRuntime;
+namespace OHOS {
+namespace NeuralNetworkRuntime {
+namespace UnitTest {
+class WeightStoreTest : public testing::Test {
+public:
+    WeightStoreTest() = default;
+    ~WeightStoreTest() = default;
+
+    void TearDown() override
+    {
+        for (auto& liteGraph : m_liteGraphs) {
+            for (auto& tensor : liteGraph->all_tensors_) {
+                mindspore::lite::MindIR_Tensor_Destroy(&tensor);
+            }
+        }
+        m_liteGraphs.clear();
+    }
+
+protected:
+    mindspore::lite::LiteGraph* CreateLiteGraph(const std::vector<std::vector<uint8_t>>& tensorData)
+    {
+        auto liteGraph = std::make_unique<mindspore::lite::LiteGraph>();
+        for (const auto& data : tensorData) {
+            std::vector<int32_t> dims {static_cast<int32_t>(data.size())};
+            liteGraph->all_tensors_.emplace_back(mindspore::lite::MindIR_Tensor_Create("tensor",
+                mindspore::lite::DATA_TYPE_UINT8, dims, mindspore::lite::FORMAT_NCHW, data, {}));
+        }
+        m_liteGraphs.emplace_back(std::move(liteGraph));
+        return m_liteGraphs.back().get();
+    }
+
+    // Every byte of the data of tensor i is i + 1, whatever the shape says.
+    mindspore::lite::LiteGraph* CreateFloatLiteGraph(size_t tensorNum, size_t dataSize,
+        const std::vector<int32_t>& dims)
+    {
+        auto liteGraph = std::make_unique<mindspore::lite::LiteGraph>();
+        for (size_t i = 0; i < tensorNum; ++i) {
+            std::vector<uint8_t> data(dataSize, static_cast<uint8_t>(i + 1));
+            liteGraph->all_tensors_.emplace_back(mindspore::lite::MindIR_Tensor_Create("tensor",
+                mindspore::lite::DATA_TYPE_FLOAT32, dims, mindspore::lite::FORMAT_NCHW, data, {}));
+        }
+        m_liteGraphs.emplace_back(std::move(liteGraph));
+        return m_liteGraphs.back().get();
+    }
+
+    WeightStore CreateWeightStore()
+    {
+        return WeightStore(
+            [this](size_t length, int& fd) {
+                fd = memfd_create("weight_store_test", 0);
+                if (fd < 0 || ftruncate(fd, length) != 0) {
+                    return OH_NN_MEMORY_ERROR;
+                }
+                ++m_allocateCount;
+                return OH_NN_SUCCESS;
+            },
+            [this](int fd, size_t length) {
+                close(fd);
+                ++m_releaseCount;
+                return OH_NN_SUCCESS;
+            });
+    }
+
+protected:
+    std::vector<std::unique_ptr<mindspore::lite::LiteGraph>> m_liteGraphs;
+    size_t m_allocateCount {0};
+    size_t m_releaseCount {0};
+};
+
+/**
+ * @tc.name: weightstoretest_acquire_001
+ * @tc.desc: Verify the graphs with the same tensor data share one blob while it is alive, which is released after
+ *           the last user.
+ * @tc.type: FUNC
+ */
+HWTEST_F(WeightStoreTest, weightstoretest_acquire_001, TestSize.Level0)
+{
+    WeightStore store = CreateWeightStore();
+    auto liteGraph = CreateLiteGraph({{1, 2, 3}, {}, {4, 5}});
+    auto sameGraph = CreateLiteGraph({{1, 2, 3}, {}, {4, 5}});
+
+    std::shared_ptr<const WeightBlob> blob;
+    EXPECT_EQ(OH_NN_SUCCESS, store.Acquire(liteGraph, blob));
+    ASSERT_NE(nullptr, blob);
+    EXPECT_EQ(5, blob->size);
+    EXPECT_EQ((std::vector<size_t> {3, 0, 2}), blob->dataSizes);
+    EXPECT_EQ(std::vector<uint8_t>({1, 2, 3, 4, 5}), std::vector<uint8_t>(blob->data, blob->data + blob->size));
+
+    // The graph is compared with the blob before anything is allocated, a share does not upload the weights again.
+    std::shared_ptr<const WeightBlob> sharedBlob;
+    EXPECT_EQ(OH_NN_SUCCESS, store.Acquire(sameGraph, sharedBlob));
+    EXPECT_EQ(blob, sharedBlob);
+    EXPECT_EQ(1, m_allocateCount);
+    EXPECT_EQ(0, m_releaseCount);
+    EXPECT_EQ(1, store.GetShareCount());
+
+    blob.reset();
+    EXPECT_EQ(0, m_releaseCount);
+    sharedBlob.reset();
+    EXPECT_EQ(1, m_releaseCount);
+
+    EXPECT_EQ(OH_NN_SUCCESS, store.Acquire(liteGraph, blob));
+    EXPECT_EQ(2, m_allocateCount);
+    EXPECT_EQ(1, store.GetShareCount());
+}
+
+/**
+ * @tc.name: weightstoretest_acquire_002
+ * @tc.desc: Verify the graphs with other tensor data or another split of the same bytes do not share the blob.
+ * @tc.type: FUNC
+ */
+HWTEST_F(WeightStoreTest, weightstoretest_acquire_002, TestSize.Level0)
+{
+    WeightStore store = CreateWeightStore();
+    std::shared_ptr<const WeightBlob> blob;
+    EXPECT_EQ(OH_NN_SUCCESS, store.Acquire(CreateLiteGraph({{1, 2, 3}, {4, 5}}), blob));
+
+    std::shared_ptr<const WeightBlob> otherBlob;
+    EXPECT_EQ(OH_NN_SUCCESS, store.Acquire(CreateLiteGraph({{1, 2, 3}, {4, 6}}), otherBlob));
+    EXPECT_NE(blob, otherBlob);
+
+    std::shared_ptr<const WeightBlob> splitBlob;
+    EXPECT_EQ(OH_NN_SUCCESS, store.Acquire(CreateLiteGraph({{1, 2}, {3, 4, 5}}), splitBlob));
+    EXPECT_NE(blob, splitBlob);
+    EXPECT_EQ(3, m_allocateCount);
+    EXPECT_EQ(0, m_releaseCount);
+    EXPECT_EQ(0, store.GetShareCount());
+
+    std::shared_ptr<const WeightBlob> emptyBlob;
+    EXPECT_EQ(OH_NN_SUCCESS, store.Acquire(CreateLiteGraph({{}, {}}), emptyBlob));
+    ASSERT_NE(nullptr, emptyBlob);
+    EXPECT_EQ(-1, emptyBlob->fd);
+    EXPECT_EQ((std::vector<size_t> {0, 0}), emptyBlob->dataSizes);
+    EXPECT_EQ(3, m_allocateCount);
+
+    EXPECT_EQ(OH_NN_INVALID_PARAMETER, store.Acquire(nullptr, blob));
+}
+
+/**
+ * @tc.name: weightstoretest_acquire_003
+ * @tc.desc: Verify large weights, which are copied in parallel, get the layout of the sequential copy, and are
+ *           compared with the graph in parallel too.
+ * @tc.type: FUNC
+ */
+HWTEST_F(WeightStoreTest, weightstoretest_acquire_003, TestSize.Level0)
+{
+    // 20 MB of weights, above the size copied in parallel.
+    constexpr size_t tensorNum = 5;
+    constexpr size_t dataSize = 4 * 1024 * 1024;
+    WeightStore store = CreateWeightStore();
+    std::shared_ptr<const WeightBlob> blob;
+    EXPECT_EQ(OH_NN_SUCCESS, store.Acquire(CreateFloatLiteGraph(tensorNum, dataSize, {1024, 1024}), blob));
+    ASSERT_NE(nullptr, blob);
+    EXPECT_EQ(std::vector<size_t>(tensorNum, dataSize), blob->dataSizes);
+    for (size_t i = 0; i < tensorNum; ++i) {
+        const uint8_t* data = blob->data + i * dataSize;
+        EXPECT_TRUE(std::all_of(data, data + dataSize, [i](uint8_t value) { return value == i + 1; }));
+    }
+
+    // The same data under shapes it does not match shares the blob as well.
+    std::shared_ptr<const WeightBlob> fallbackBlob;
+    EXPECT_EQ(OH_NN_SUCCESS, store.Acquire(CreateFloatLiteGraph(tensorNum, dataSize, {1024}), fallbackBlob));
+    EXPECT_EQ(blob, fallbackBlob);
+    EXPECT_EQ(1, store.GetShareCount());
+    EXPECT_EQ(1, m_allocateCount);
+    EXPECT_EQ(0, m_releaseCount);
+
+    // A difference in the last byte is found by the parallel compare, the weights are uploaded on their own.
+    auto otherGraph = CreateFloatLiteGraph(tensorNum, dataSize, {1024, 1024});
+    std::vector<uint8_t> otherData(dataSize, static_cast<uint8_t>(tensorNum));
+    otherData.back() = 0;
+    mindspore::lite::MindIR_Tensor_SetData(&otherGraph->all_tensors_.back(), otherData);
+    std::shared_ptr<const WeightBlob> otherBlob;
+    EXPECT_EQ(OH_NN_SUCCESS, store.Acquire(otherGraph, otherBlob));
+    EXPECT_NE(blob, otherBlob);
+    EXPECT_EQ(2, m_allocateCount);
+    EXPECT_EQ(0, otherBlob->data[otherBlob->size - 1]);
+}
+} // namespace UnitTest
+} // namespace NeuralNetworkRuntime
+} // namespace OHOS
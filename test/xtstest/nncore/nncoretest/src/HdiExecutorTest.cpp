@@ -103,7 +103,7 @@ HWTEST_F(ExecutorTest, SUB_AI_NNRt_Core_Func_North_Set_Executor_OnRunDone_0100,
 /**
  * @tc.name   SUB_AI_NNRt_Core_Func_North_Set_Executor_OnRunDone_0200
  * @tc.number SUB_AI_NNRt_Core_Func_North_Set_Executor_OnRunDone_0200
- * @tc.desc   在推理完成时设置executor，合法参数返回不支持
+ * @tc.desc   在推理完成时设置executor，合法参数返回成功
  * @tc.type   FUNCTION
  * @tc.size   MEDIUMTEST
  * @tc.level  LEVEL1
@@ -113,7 +113,7 @@ HWTEST_F(ExecutorTest, SUB_AI_NNRt_Core_Func_North_Set_Executor_OnRunDone_0200,
     NN_OnRunDone onRunDone= RunDone;
     OH_NNExecutor *executor = nullptr;
     CreateExecutor(&executor);
-    ASSERT_EQ(OH_NN_OPERATION_FORBIDDEN, OH_NNExecutor_SetOnRunDone(executor, onRunDone));
+    ASSERT_EQ(OH_NN_SUCCESS, OH_NNExecutor_SetOnRunDone(executor, onRunDone));
     OH_NNExecutor_Destroy(&executor);
 }
 
@@ -136,7 +136,7 @@ HWTEST_F(ExecutorTest, SUB_AI_NNRt_Core_Func_North_Set_Executor_Service_Died_010
 /**
  * @tc.name   SUB_AI_NNRt_Core_Func_North_Set_Executor_Service_Died_0200
  * @tc.number SUB_AI_NNRt_Core_Func_North_Set_Executor_Service_Died_0200
- * @tc.desc   合法参数，返回不支持
+ * @tc.desc   合法参数，返回成功
  * @tc.type   FUNCTION
  * @tc.size   MEDIUMTEST
  * @tc.level  LEVEL1
@@ -147,7 +147,7 @@ HWTEST_F(ExecutorTest, SUB_AI_NNRt_Core_Func_North_Set_Executor_Service_Died_020
     OH_NNExecutor *executor = nullptr;
     CreateExecutor(&executor);
 
-    ASSERT_EQ(OH_NN_OPERATION_FORBIDDEN, OH_NNExecutor_SetOnServiceDied(executor, onServiceDied));
+    ASSERT_EQ(OH_NN_SUCCESS, OH_NNExecutor_SetOnServiceDied(executor, onServiceDied));
     OH_NNExecutor_Destroy(&executor);
 }
 
@@ -476,7 +476,7 @@ HWTEST_F(ExecutorTest, SUB_AI_NNRt_Core_Func_North_Executor_RunASync_0500, Funct
 /**
  * @tc.name   SUB_AI_NNRt_Core_Func_North_Executor_RunASync_0600
  * @tc.number SUB_AI_NNRt_Core_Func_North_Executor_RunASync_0600
- * @tc.desc   executor async推理，定长模型返回不支持
+ * @tc.desc   executor async推理，未设置NN_OnRunDone返回不支持
  * @tc.type   FUNCTION
  * @tc.size   MEDIUMTEST
  * @tc.level  LEVEL1